@@ -10,10 +10,15 @@
 #include "client/client_malloc_override.h"
 #include "shared/ipc.h"
 #include "shared/log.h"
+#include "shared/parallel_copy.h"
 #include "shared/rpc.h"
 #include "shared/shmem.h"
+#include "shared/stats.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <filesystem>
+#include <sys/prctl.h>
 #include <unistd.h>
 
 namespace Cal::Client {
@@ -21,6 +26,8 @@ namespace Cal::Client {
 ClientConnection::ClientConnection() {
     Cal::Utils::initDynamicVerbosity();
     this->usesSharedVaForRpcChannel = Cal::Utils::getCalEnvFlag(calUseSharedVaForRpcChannel, true);
+    auto parallelCopyHelpersCount = static_cast<size_t>(std::max<int64_t>(Cal::Utils::getCalEnvI64(calParallelCopyHelpersEnvName, 2), 0));
+    this->parallelCopy = std::make_unique<Cal::Utils::ParallelCopy>(parallelCopyHelpersCount);
     auto cpuInfoOpt = cpuInfo.read();
     if (cpuInfoOpt) {
         this->cpuInfo = cpuInfoOpt.value();
@@ -37,6 +44,14 @@ ClientConnection::~ClientConnection() {
     }
 }
 
+Cal::Rpc::ChannelClient &ClientConnection::getRpcChannel() const {
+    return this->rpcChannels->getChannelForThisThread();
+}
+
+Cal::Rpc::ChannelClient &ClientConnection::getPrimaryRpcChannel() const {
+    return this->rpcChannels->getPrimaryChannel();
+}
+
 std::unique_ptr<Cal::Ipc::ClientConnectionFactory> ClientConnection::createConnectionFactory() {
     log<Verbosity::debug>("Creating connection factory based on local named socket");
     return std::make_unique<Cal::Ipc::NamedSocketClientConnectionFactory>();
@@ -101,7 +116,18 @@ void ClientConnection::connect() {
         return;
     }
     log<Verbosity::debug>("Handshake successful (CAL service pid : %d)", serviceConfig.pid);
-    this->globalShmemImporter = std::make_unique<Cal::Ipc::ShmemImporter>(Cal::Ipc::getCalShmemPathBase(serviceConfig.pid));
+    if (serviceConfig.memfdShmem) {
+        log<Verbosity::debug>("Service uses anonymous memfd shmems - these will be imported over the control connection");
+    }
+    if (serviceConfig.directTransfers) {
+        // with Yama's restricted ptrace, service can access client's memory only when client allows it explicitly (EINVAL means Yama is not used)
+        if ((0 != prctl(PR_SET_PTRACER, static_cast<unsigned long>(serviceConfig.pid), 0, 0, 0)) && (EINVAL != errno)) {
+            log<Verbosity::debug>("Could not allow CAL service to access client's memory directly (errno : %d) - hostptr memory will be transferred through shmems", errno);
+        } else {
+            log<Verbosity::debug>("CAL service will transfer hostptr memory directly from/to client's memory");
+        }
+    }
+    this->globalShmemImporter = std::make_unique<Cal::Ipc::ShmemImporter>(Cal::Ipc::getCalShmemPathBase(serviceConfig.pid), serviceConfig.memfdShmem ? this->connection.get() : nullptr);
     this->usmShmemImporter = std::make_unique<Cal::Usm::UsmShmemImporter>(*this->globalShmemImporter);
 
     serviceDebugBreakEnv(serviceConfig.assignedClientOrdinal);
@@ -155,7 +181,13 @@ void ClientConnection::connect() {
     log<Verbosity::info>("USM HEAP : %p - %p (size : %zx)", initialUsmHeap.base(), Cal::Utils::moveByBytes(initialUsmHeap.base(), initialUsmHeap.size()), initialUsmHeap.size());
 
     log<Verbosity::debug>("Creating RPC channel");
-    rpcChannel = std::make_unique<Cal::Rpc::ChannelClient>(*this->connection, *this->globalShmemImporter, *this->usmShmemImporter);
+    auto maxRpcChannelsCount = static_cast<size_t>(std::max<int64_t>(Cal::Utils::getCalEnvI64(calRpcChannelsCountEnvName, 1), 1));
+    rpcChannels = std::make_unique<Cal::Rpc::ChannelClientPool>(*this->connection, *this->globalShmemImporter, *this->usmShmemImporter, maxRpcChannelsCount);
+    auto stats = Cal::Stats::StatsShmem::open(Cal::Stats::getStatsShmemPath(serviceConfig.pid, serviceConfig.assignedClientOrdinal), false);
+    if (stats) {
+        log<Verbosity::debug>("Reporting RPC calls statistics to %s", stats->getPath().c_str());
+        rpcChannels->setStats(std::move(stats));
+    }
     Cal::Rpc::ChannelClient::ClientSynchronizationMethod clientSynchMethod = Cal::Rpc::ChannelClient::activePolling;
     if (Cal::Utils::getCalEnvFlag(calUseSemaphoresInChannelClientEnvName, true)) {
         clientSynchMethod = Cal::Rpc::ChannelClient::semaphores;
@@ -163,7 +195,10 @@ void ClientConnection::connect() {
     if (Cal::Utils::getCalEnvFlag(calUseSemaphoresThresholdInChannelClientEnvName, false)) {
         clientSynchMethod = Cal::Rpc::ChannelClient::latencyBased;
     }
-    if (false == rpcChannel->init(clientSynchMethod, this->usesSharedVaForRpcChannel)) {
+    if (Cal::Utils::getCalEnvFlag(calUseFutexInChannelClientEnvName, false)) {
+        clientSynchMethod = Cal::Rpc::ChannelClient::futex;
+    }
+    if (false == rpcChannels->init(clientSynchMethod, this->usesSharedVaForRpcChannel)) {
         log<Verbosity::critical>("Failed to initialize RPC channel client");
         this->connection.reset();
         return;
@@ -27,9 +27,14 @@ namespace Usm {
 class UsmShmemImporter;
 }
 
+namespace Utils {
+class ParallelCopy;
+}
+
 namespace Rpc {
 class ChannelClient;
-}
+class ChannelClientPool;
+} // namespace Rpc
 
 namespace Client {
 
@@ -54,13 +59,16 @@ class ClientConnection {
         return *this->mallocShmemExporter;
     }
 
+    Cal::Utils::ParallelCopy &getParallelCopy() const {
+        return *this->parallelCopy;
+    }
+
     Cal::Ipc::Connection &getConnection() const {
         return *this->connection;
     }
 
-    Cal::Rpc::ChannelClient &getRpcChannel() const {
-        return *this->rpcChannel;
-    }
+    Cal::Rpc::ChannelClient &getRpcChannel() const;
+    Cal::Rpc::ChannelClient &getPrimaryRpcChannel() const;
 
     const Cal::Utils::CpuInfo &getCpuInfo() const {
         return this->cpuInfo;
@@ -96,7 +104,8 @@ class ClientConnection {
     std::unique_ptr<Cal::Usm::UsmShmemImporter> usmShmemImporter;
     std::unique_ptr<Cal::Client::MallocOverride::MallocShmemExporter> mallocShmemExporter;
     std::unique_ptr<Cal::Ipc::Connection> connection;
-    std::unique_ptr<Cal::Rpc::ChannelClient> rpcChannel;
+    std::unique_ptr<Cal::Rpc::ChannelClientPool> rpcChannels;
+    std::unique_ptr<Cal::Utils::ParallelCopy> parallelCopy;
     Cal::Utils::AddressRange initialUsmHeap;
     Cal::Utils::CpuInfo cpuInfo;
 
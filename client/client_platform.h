@@ -11,6 +11,7 @@
 #include "client/icd/icd_global_state.h"
 #include "shared/api_types.h"
 #include "shared/ipc.h"
+#include "shared/parallel_copy.h"
 #include "shared/shmem_transfer_desc.h"
 #include "shared/usm.h"
 
@@ -67,6 +68,10 @@ class IcdPlatform {
         return globalState.getRpcChannel();
     }
 
+    Cal::Rpc::ChannelClient &getPrimaryRpcChannel() const {
+        return globalState.getPrimaryRpcChannel();
+    }
+
     Cal::Ipc::Connection &getConnection() const {
         return globalState.getConnection();
     }
@@ -268,27 +273,42 @@ class IcdPlatform {
     }
 
     bool writeRequiredMemory(const std::vector<Cal::Rpc::TransferDesc> &transferDescs) {
-        for (const auto &transfer : transferDescs) {
-            if (transfer.shmemId != -1) {
-                auto shmem = globalState.getGlobalShmemImporter().open(transfer.shmemId, transfer.underlyingSize, nullptr);
-                if (!shmem.isValid()) {
-                    log<Verbosity::error>("Cannot map shared memory to perform transfer from client to service!");
-                    return false;
-                }
+        auto &shmemImporter = globalState.getGlobalShmemImporter();
+        std::vector<Cal::Ipc::ShmemImporter::AllocationT> mappings;
+        std::vector<Cal::Utils::ParallelCopy::CopyDesc> copies;
+        mappings.reserve(transferDescs.size());
+        copies.reserve(transferDescs.size());
 
-                const auto destinationAddress = reinterpret_cast<uintptr_t>(shmem.getMmappedPtr()) + transfer.offsetFromResourceStart;
-                const auto source = reinterpret_cast<const void *>(transfer.clientAddress);
-                auto destination = reinterpret_cast<void *>(destinationAddress);
-
-                std::memcpy(destination, source, transfer.bytesCountToCopy);
-                globalState.getGlobalShmemImporter().release(shmem);
-            } else {
+        bool success = true;
+        for (const auto &transfer : transferDescs) {
+            if (transfer.shmemId == -1) {
                 log<Verbosity::error>("Incorrect shmem file descriptor to perform transfer from client to service!");
-                return false;
+                success = false;
+                break;
             }
+
+            auto shmem = shmemImporter.openCached(transfer.shmemId, transfer.underlyingSize);
+            if (!shmem.isValid()) {
+                log<Verbosity::error>("Cannot map shared memory to perform transfer from client to service!");
+                success = false;
+                break;
+            }
+
+            const auto source = reinterpret_cast<const void *>(transfer.clientAddress);
+            auto destination = Cal::Utils::moveByBytes(shmem.getMmappedPtr(), transfer.offsetFromResourceStart);
+            copies.push_back({destination, source, transfer.bytesCountToCopy});
+            mappings.push_back(shmem);
         }
 
-        return true;
+        if (success) {
+            globalState.getParallelCopy().copy(copies);
+        }
+
+        for (const auto &shmem : mappings) {
+            shmemImporter.releaseCached(shmem);
+        }
+
+        return success;
     }
 
     PageFaultManager &getPageFaultManager() {
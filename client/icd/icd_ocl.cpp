@@ -14,6 +14,7 @@
 #include "generated_rpc_messages_ocl.h"
 #include "include/cal.h"
 #include "shared/log.h"
+#include "shared/transfer_copy.h"
 #include "shared/usm.h"
 #include "shared/utils.h"
 
@@ -330,7 +331,7 @@ cl_mem clCreateBuffer(cl_context context, cl_mem_flags flags, size_t size, void
         } else {
             std::unique_ptr<void, std::function<void(void *)>> standaloneHostPtrAlloc{static_cast<IcdOclContext *>(context)->getStagingAreaManager().allocateStagingArea(size), [context](void *ptrToMarkAsUnused) { static_cast<IcdOclContext *>(context)->getStagingAreaManager().deallocateStagingArea(ptrToMarkAsUnused); }};
             void *standaloneHostPtr = standaloneHostPtrAlloc.get();
-            memcpy(Cal::Utils::toAddress(standaloneHostPtr), host_ptr, host_ptr ? size : 0u);
+            Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standaloneHostPtr), host_ptr, host_ptr ? size : 0u);
             auto useHostPtrFlags = flags & (~(CL_MEM_ALLOC_HOST_PTR | CL_MEM_COPY_HOST_PTR));
             useHostPtrFlags |= CL_MEM_USE_HOST_PTR;
             retMem = clCreateBufferRpcHelperNotUseHostPtrZeroCopyMallocShmem(context, useHostPtrFlags, size, standaloneHostPtr, errcode_ret);
@@ -567,13 +568,13 @@ void *IcdOclPlatform::translateMappedPointer(cl_mem buffer, void *ptr, size_t of
             if (parentMemObj) {
                 auto standaloneHostPtr = parentMemObj->asLocalObject()->standaloneHostPtrAllocation.get();
                 if (standaloneHostPtr) {
-                    memcpy(parentMemObj->asLocalObject()->apiHostPtr, standaloneHostPtr, parentMemObj->asLocalObject()->size);
+                    Cal::Utils::TransferCopy::copy(parentMemObj->asLocalObject()->apiHostPtr, standaloneHostPtr, parentMemObj->asLocalObject()->size);
                     return Cal::Utils::moveByBytes(apiHostPtr, offset);
                 }
             } else {
                 auto standaloneHostPtr = buffer->asLocalObject()->standaloneHostPtrAllocation.get();
                 if (standaloneHostPtr) {
-                    memcpy(apiHostPtr, standaloneHostPtr, buffer->asLocalObject()->size);
+                    Cal::Utils::TransferCopy::copy(apiHostPtr, standaloneHostPtr, buffer->asLocalObject()->size);
                     return Cal::Utils::moveByBytes(apiHostPtr, offset);
                 }
             }
@@ -594,14 +595,14 @@ void *IcdOclPlatform::translateUnMappedPointer(cl_mem buffer, void *ptr) {
         if (parentMemObj) {
             auto standaloneHostPtr = parentMemObj->asLocalObject()->standaloneHostPtrAllocation.get();
             if (standaloneHostPtr) {
-                memcpy(standaloneHostPtr, parentMemObj->asLocalObject()->apiHostPtr, parentMemObj->asLocalObject()->size);
+                Cal::Utils::TransferCopy::copy(standaloneHostPtr, parentMemObj->asLocalObject()->apiHostPtr, parentMemObj->asLocalObject()->size);
                 auto offset = Cal::Utils::byteDistanceAbs(ptr, parentMemObj->asLocalObject()->apiHostPtr);
                 return Cal::Utils::moveByBytes(standaloneHostPtr, offset);
             }
         } else {
             auto standaloneHostPtr = buffer->asLocalObject()->standaloneHostPtrAllocation.get();
             if (standaloneHostPtr) {
-                memcpy(standaloneHostPtr, apiHostPtr, buffer->asLocalObject()->size);
+                Cal::Utils::TransferCopy::copy(standaloneHostPtr, apiHostPtr, buffer->asLocalObject()->size);
                 auto offset = Cal::Utils::byteDistanceAbs(ptr, apiHostPtr);
                 return Cal::Utils::moveByBytes(standaloneHostPtr, offset);
             }
@@ -612,7 +613,7 @@ void *IcdOclPlatform::translateUnMappedPointer(cl_mem buffer, void *ptr) {
 
 void IcdOclPlatform::handleCallbacks(IcdOclPlatform *platform) {
     log<Verbosity::debug>("Starting callbacks handler");
-    auto &channel = platform->getRpcChannel();
+    auto &channel = platform->getPrimaryRpcChannel();
     while (true) {
         log<Verbosity::debug>("Waiting for callbacks");
         auto status = channel.waitForCallbacks();
@@ -738,7 +739,7 @@ bool IcdOclPlatform::hasCallbacksHandler() {
 IcdOclContext::IcdOclContext(cl_context remoteObject, Cal::Shared::SingleReference &&parent,
                              Cal::Shared::RefCounted<_cl_context, IcdOclTypePrinter>::CleanupFuncT cleanupFunc)
     : Cal::Shared::RefCountedWithParent<_cl_context, IcdOclTypePrinter>(remoteObject, std::move(parent), cleanupFunc),
-      stagingAreaManager([this](size_t size) { return this->allocateStagingArea(size); }, [this](void *ptr) { return this->deallocateStagingAreas(ptr); }) {
+      stagingAreaManager([this](size_t size) { return this->allocateStagingArea(size); }, [this](void *ptr) { return this->deallocateStagingAreas(ptr); }, Cal::Utils::IdleTrimmer::readConfig()) {
     Cal::Client::Icd::icdGlobalState.registerAtExit(this, [this](const void *key) { this->globalReleaseCallback(); });
     this->skipTransferOnHostPtrMatch = Cal::Utils::getCalEnvFlag(calIcdBufferRecycleEnvName);
 }
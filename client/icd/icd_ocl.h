@@ -11,6 +11,7 @@
 #include "client/icd/icd_global_state.h"
 #include "client/icd/icd_kernel_arg_cache.h"
 #include "client/icd/icd_page_fault_manager.h"
+#include "shared/idle_trimmer.h"
 #include "shared/ipc.h"
 #include "shared/ocl_fat_def.h"
 #include "shared/ref_counted.h"
@@ -287,6 +288,7 @@ struct IcdOclMem : Cal::Shared::RefCountedWithParent<_cl_mem, IcdOclTypePrinter>
     cl_mem_flags flags = 0U;
     IcdOclContext *parent = nullptr;
     IcdOclMem *parentMemObj = nullptr;
+    Cal::Utils::IdleTrimmer::ClockT::time_point recycledAt = {};
 
     IcdOclContext *getContext() const {
         return parent;
@@ -314,6 +316,9 @@ struct ClBufferRecycler {
 
     ClBufferRecycler() {
         this->allowedReuseSizeTotal = Cal::Utils::getCalEnvI64(calIcdBufferRecycleEnvName, 0) * Cal::Utils::MB;
+        if (this->allowedReuseSizeTotal > 0) {
+            this->idleTrimmer = Cal::Utils::IdleTrimmer{Cal::Utils::IdleTrimmer::readConfig()};
+        }
 
         size_t leftBound = 0U;
         size_t rightBound = minBucketSize;
@@ -493,9 +498,16 @@ struct ClBufferRecycler {
     }
 
     bool tryRecycleClBuffer(cl_mem mem) {
-        if (isCleaningUp) {
+        if (isCleaningUp || isTrimming) {
             return false;
         }
+        auto now = Cal::Utils::IdleTrimmer::ClockT::time_point{};
+        if (idleTrimmer.isEnabled()) { // trimming is piggybacked on releases of buffers
+            now = Cal::Utils::IdleTrimmer::ClockT::now();
+            if (idleTrimmer.shouldTrim(now)) {
+                this->trimIdleClBuffers(now);
+            }
+        }
         auto memObject = mem->asLocalObject();
         if (memObject->peekRefCount() > 1) {
             return false;
@@ -520,6 +532,7 @@ struct ClBufferRecycler {
             return false;
         }
 
+        memObject->recycledAt = now;
         if (false == buckets[bucketId].tryRecycleClBuffer(mem)) {
             return false;
         }
@@ -577,6 +590,45 @@ struct ClBufferRecycler {
         return recycledBuffer;
     }
 
+    // releases recycled buffers that were not reused for longer than idle timeout (except for low watermark of most recently recycled ones)
+    size_t trimIdleClBuffers(Cal::Utils::IdleTrimmer::ClockT::time_point now) {
+        std::vector<IcdOclMem *> buffersToRelease;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            std::vector<std::pair<size_t, size_t>> positions; // bucket id, position in bucket
+            std::vector<Cal::Utils::IdleTrimmer::ClockT::time_point> recycledAt;
+            for (size_t bucketId = 0; bucketId < buckets.size(); ++bucketId) {
+                for (size_t i = 0; i < buckets[bucketId].objects.size(); ++i) {
+                    positions.emplace_back(bucketId, i);
+                    recycledAt.push_back(buckets[bucketId].objects[i]->recycledAt);
+                }
+            }
+
+            auto toTrim = idleTrimmer.selectEntriesToTrim(recycledAt, now);
+            for (auto it = toTrim.rbegin(); it != toTrim.rend(); ++it) { // from the back, so that positions stay valid
+                auto [bucketId, i] = positions[*it];
+                auto &bucket = buckets[bucketId];
+                auto buffer = bucket.objects[i];
+                bucket.objects.erase(bucket.objects.begin() + i);
+                bucket.currentRecycleSizeTotal -= buffer->size;
+                --bucket.currentRecycleCountTotal;
+                currentRecycleSizeTotal -= buffer->size;
+                --currentRecycleCountTotal;
+                buffersToRelease.push_back(buffer);
+            }
+        }
+
+        isTrimming = true; // released buffers must not get recycled again
+        for (auto buffer : buffersToRelease) {
+            Cal::Client::Icd::Ocl::clReleaseMemObject(buffer);
+        }
+        isTrimming = false;
+        if (false == buffersToRelease.empty()) {
+            log<Verbosity::debug>("Released %zu idle recycled cl_mem buffers", buffersToRelease.size());
+        }
+        return buffersToRelease.size();
+    }
+
     void cleanup() {
         isCleaningUp = true;
         for (auto &bucket : buckets) {
@@ -594,6 +646,8 @@ struct ClBufferRecycler {
     }
 
     std::atomic_bool isCleaningUp = false;
+    static inline thread_local bool isTrimming = false;
+    Cal::Utils::IdleTrimmer idleTrimmer; // enabled together with recycling
 };
 
 struct InfoCache {
@@ -748,13 +802,11 @@ struct IcdOclCommandQueue : Cal::Shared::RefCountedWithParent<_cl_command_queue,
             tmp.swap(temporaryAllocations.allocations);
         }
 
-        if (tmp.empty()) {
-            return;
+        for (auto &allocation : tmp) {
+            auto &channel = allocation.get_deleter().getChannel(); // allocations could come from different (per-thread) channels
+            auto channelLock = channel.lock();
+            allocation.reset();
         }
-
-        auto &channel = tmp[0].get_deleter().getChannel();
-        auto channelLock = channel.lock();
-        tmp.clear();
     }
 
     void beforeReleaseCallback() {
@@ -11,14 +11,18 @@
 #include "shared/control_messages.h"
 #include "shared/ipc.h"
 
+#include <algorithm>
 #include <atomic>
 #include <csignal>
 #include <cstdlib>
 #include <limits>
 #include <mutex>
+#include <vector>
 
 namespace Cal::Client::Icd {
 
+// Tracks placement of shared allocations in chunks (of migrationChunkSize bytes), so that CPU access to a part of
+// a large allocation migrates (and changes protection of) only the touched chunks instead of the whole allocation.
 class PageFaultManager {
   public:
     enum class Placement : uint32_t {
@@ -26,13 +30,16 @@ class PageFaultManager {
         HOST
     };
 
+    static constexpr uint64_t defaultMigrationChunkSize = 64 * Cal::Utils::KB;
+
     PageFaultManager(Cal::Ipc::Connection &connection)
         : PageFaultManager(connection, Cal::Utils::getCalEnvFlag(calSharedAllocations, true),
                            Cal::Utils::getCalEnvFlag(calDumpStackOnUnhandledPagefault, false),
-                           Cal::Utils::getCalEnvFlag(calDebugBreakOnUnhandledPageFaultEnvName, false)) {}
+                           Cal::Utils::getCalEnvFlag(calDebugBreakOnUnhandledPageFaultEnvName, false),
+                           Cal::Utils::getCalEnvI64(calSharedAllocationsMigrationChunkSizeEnvName, defaultMigrationChunkSize / Cal::Utils::KB) * Cal::Utils::KB) {}
 
     PageFaultManager(Cal::Ipc::Connection &connection, bool sharedAllocationsEnabled,
-                     bool dumpStackOnUnhandledPageFault, bool breakOnUnhandledPageFault)
+                     bool dumpStackOnUnhandledPageFault, bool breakOnUnhandledPageFault, int64_t migrationChunkSize = defaultMigrationChunkSize)
         : connection(connection), dumpStackOnUnhandledPageFault(dumpStackOnUnhandledPageFault),
           breakOnUnhandledPageFault(breakOnUnhandledPageFault) {
         this->sharedAllocationsEnabled = sharedAllocationsEnabled;
@@ -40,6 +47,10 @@ class PageFaultManager {
             return;
         }
 
+        // protection can be changed only for whole pages
+        this->migrationChunkSize = Cal::Utils::alignUpPow2<Cal::Utils::pageSize4KB>(static_cast<uint64_t>(std::max<int64_t>(migrationChunkSize, Cal::Utils::pageSize4KB)));
+        log<Verbosity::debug>("Shared allocations are migrated in chunks of %llu bytes", static_cast<unsigned long long>(this->migrationChunkSize));
+
         this->pageFaultHandler = [&](int signal, siginfo_t *info, void *context) {
             this->pageFaultHandlerImpl(signal, info, context);
         };
@@ -62,13 +73,17 @@ class PageFaultManager {
         return this->sharedAllocationsEnabled;
     }
 
+    uint64_t getMigrationChunkSize() const {
+        return this->migrationChunkSize;
+    }
+
     void registerSharedAlloc(void *hostPtr, uint64_t size, Placement placement) {
         if (!this->sharedAllocationsEnabled) {
             return;
         }
         log<Verbosity::debug>("New shared alloc %p", hostPtr);
         std::lock_guard<std::mutex> lock(this->mtx);
-        this->sharedAllocMap.try_emplace(hostPtr, size, placement);
+        this->sharedAllocMap.try_emplace(hostPtr, size, (size + this->migrationChunkSize - 1) / this->migrationChunkSize, placement);
         if (placement == Placement::DEVICE) {
             Cal::Sys::mprotect(hostPtr, size, PROT_NONE);
         }
@@ -120,9 +135,11 @@ class PageFaultManager {
   protected:
     struct SharedAllocDesc {
         uint64_t size = 0;
-        Placement placement = Placement::HOST;
+        std::vector<Placement> chunksPlacement; // preallocated, so that page fault handler never allocates
+        size_t chunksOnHostCount = 0;
 
-        SharedAllocDesc(uint64_t size, Placement placement) : size(size), placement(placement) {}
+        SharedAllocDesc(uint64_t size, size_t chunksCount, Placement placement)
+            : size(size), chunksPlacement(chunksCount, placement), chunksOnHostCount((placement == Placement::HOST) ? chunksCount : 0) {}
     };
 
     void moveAllocationToGpuImpl(const void *hostPtr) {
@@ -135,12 +152,27 @@ class PageFaultManager {
 
     void moveAllocationToGpuImplIt(boost::container::flat_map<void *, SharedAllocDesc>::iterator &it) {
         if (it == this->sharedAllocMap.end() ||
-            it->second.placement == Placement::DEVICE) {
+            it->second.chunksOnHostCount == 0) {
             return;
         }
         log<Verbosity::debug>("Moving to GPU placement alloc %p", it->first);
-        Cal::Sys::mprotect(it->first, it->second.size, PROT_NONE);
-        it->second.placement = Placement::DEVICE;
+        auto &chunksPlacement = it->second.chunksPlacement;
+        auto base = reinterpret_cast<uintptr_t>(it->first);
+        for (size_t runStart = 0; runStart < chunksPlacement.size();) {
+            if (chunksPlacement[runStart] == Placement::DEVICE) {
+                ++runStart;
+                continue;
+            }
+            auto runEnd = runStart;
+            for (; (runEnd < chunksPlacement.size()) && (chunksPlacement[runEnd] == Placement::HOST); ++runEnd) {
+                chunksPlacement[runEnd] = Placement::DEVICE;
+            }
+            auto runOffset = runStart * this->migrationChunkSize;
+            auto runSize = std::min<uint64_t>(runEnd * this->migrationChunkSize, it->second.size) - runOffset;
+            Cal::Sys::mprotect(reinterpret_cast<void *>(base + runOffset), runSize, PROT_NONE);
+            runStart = runEnd;
+        }
+        it->second.chunksOnHostCount = 0;
     }
 
     void pageFaultHandlerImpl(int signal, siginfo_t *info, void *context) {
@@ -181,15 +213,20 @@ class PageFaultManager {
             return false;
         }
 
-        if (sharedAllocDesc->second.placement == Placement::HOST) {
+        auto chunkId = (reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(sharedAllocDesc->first)) / this->migrationChunkSize;
+        auto &chunkPlacement = sharedAllocDesc->second.chunksPlacement[chunkId];
+        if (chunkPlacement == Placement::HOST) {
             log<Verbosity::debug>("Memory already accessible by host");
             return true;
         }
 
+        auto chunkOffset = chunkId * this->migrationChunkSize;
+        auto chunkPtr = reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(sharedAllocDesc->first) + chunkOffset);
+        auto chunkSize = std::min<uint64_t>(this->migrationChunkSize, sharedAllocDesc->second.size - chunkOffset);
         {
             auto connectionLock = this->connection.lock();
 
-            Cal::Messages::ReqPageFault reqPageFault(ptr);
+            Cal::Messages::ReqPageFault reqPageFault(chunkPtr, chunkSize);
             if (this->connection.send(reqPageFault) == false) {
                 log<Verbosity::error>("Error while sending page fault request on address %p", ptr);
                 return false;
@@ -202,8 +239,9 @@ class PageFaultManager {
             }
         }
 
-        sharedAllocDesc->second.placement = Placement::HOST;
-        Cal::Sys::mprotect(sharedAllocDesc->first, sharedAllocDesc->second.size, PROT_READ | PROT_WRITE);
+        chunkPlacement = Placement::HOST;
+        ++sharedAllocDesc->second.chunksOnHostCount;
+        Cal::Sys::mprotect(chunkPtr, chunkSize, PROT_READ | PROT_WRITE);
         log<Verbosity::debug>("Page fault verified successfully on address %p", ptr);
         return true;
     }
@@ -215,11 +253,15 @@ class PageFaultManager {
     boost::container::flat_map<void *, SharedAllocDesc> sharedAllocMap;
     std::mutex mtx;
 
+    // allocations never overlap, so the only candidate is the last one starting at or below hostPtr
     boost::container::flat_map<void *, SharedAllocDesc>::iterator findSharedAlloc(const void *hostPtr) {
-        for (auto iter = this->sharedAllocMap.begin(), end = this->sharedAllocMap.end(); iter != end; ++iter) {
-            if (hostPtr >= iter->first && hostPtr < reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(iter->first) + iter->second.size)) {
-                return iter;
-            }
+        auto iter = this->sharedAllocMap.upper_bound(const_cast<void *>(hostPtr));
+        if (iter == this->sharedAllocMap.begin()) {
+            return this->sharedAllocMap.end();
+        }
+        --iter;
+        if (hostPtr < reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(iter->first) + iter->second.size)) {
+            return iter;
         }
         return this->sharedAllocMap.end();
     }
@@ -228,6 +270,7 @@ class PageFaultManager {
     bool sharedAllocationsEnabled = true;
     bool dumpStackOnUnhandledPageFault = false;
     bool breakOnUnhandledPageFault = false;
+    uint64_t migrationChunkSize = defaultMigrationChunkSize;
 };
 
 } // namespace Cal::Client::Icd
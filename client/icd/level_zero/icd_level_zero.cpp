@@ -77,7 +77,8 @@ void initializeL0RedirectionLibraryIfNeeded() {
 IcdL0Context::IcdL0Context(ze_context_handle_t remoteObject, Cal::Shared::SingleReference &&parent, CleanupFuncT cleanupFunc)
     : Cal::Shared::RefCountedWithParent<_ze_context_handle_t, Logic::IcdL0TypePrinter>(remoteObject, std::move(parent), cleanupFunc),
       stagingAreaManager([this](size_t size) { return this->allocateStagingArea(size); },
-                         [this](void *ptr) { return this->deallocateStagingAreas(ptr); }) {}
+                         [this](void *ptr) { return this->deallocateStagingAreas(ptr); },
+                         Cal::Utils::IdleTrimmer::readConfig()) {}
 
 void IcdL0Context::beforeReleaseCallback() {
     this->getStagingAreaManager().clearStagingAreaAllocations();
@@ -209,8 +210,17 @@ ze_result_t IcdL0CommandList::writeRequiredMemory() {
         log<Verbosity::error>("Could not get memory blocks to write from service! Execution of command list would be invalid!");
         return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
+    transferDescs.resize(transferDescsCount); // service might have copied some of them on its own
 
     auto globalL0Platform = Cal::Client::Icd::icdGlobalState.getL0Platform();
+    auto &dirtyPagesTracker = globalL0Platform->getDirtyPagesTracker();
+    if (dirtyPagesTracker.isEnabled()) {
+        if (nullptr == dirtyPagesRegistration) {
+            dirtyPagesRegistration = dirtyPagesTracker.createRegistration();
+        }
+        transferDescs = dirtyPagesTracker.selectModified(*dirtyPagesRegistration, transferDescs);
+    }
+
     if (!globalL0Platform->writeRequiredMemory(transferDescs)) {
         log<Verbosity::error>("Could not write required memory from user's stack/heap! Execution of command list would be invalid!");
         return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
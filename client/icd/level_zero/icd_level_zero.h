@@ -15,6 +15,7 @@
 #include "client/icd/level_zero/api_type_wrapper/handles_definitions.h"
 #include "client/icd/level_zero/api_type_wrapper/kernel_wrapper.h"
 #include "client/icd/level_zero/api_type_wrapper/module_wrapper.h"
+#include "client/icd/level_zero/logic/dirty_pages_tracker.h"
 #include "client/icd/level_zero/logic/hostptr_copies_reader.h"
 #include "client/icd/level_zero/logic/properties_cache.h"
 #include "client/icd/level_zero/logic/types_printer.h"
@@ -142,6 +143,7 @@ class IcdL0CommandList : public Cal::Shared::RefCountedWithParent<_ze_command_li
     void clearRequiredMemoryTransfers() {
         std::lock_guard lock{memoryToWriteMutex};
         memoryToWrite.clear();
+        dirtyPagesRegistration.reset();
     }
 
     bool sharedIndirectAccessSet = false;
@@ -182,6 +184,7 @@ class IcdL0CommandList : public Cal::Shared::RefCountedWithParent<_ze_command_li
     CommandListType commandListType{CommandListType::Regular};
     std::mutex memoryToWriteMutex{};
     std::vector<ChunkEntry> memoryToWrite{};
+    std::shared_ptr<Logic::DirtyPagesTracker::Registration> dirtyPagesRegistration;
 
     std::vector<const void *> usedAllocations{};
 };
@@ -296,6 +299,9 @@ class IcdL0Platform : public Cal::Client::Icd::IcdPlatform, public _ze_driver_ha
         if (0 != Cal::Utils::getCalEnvI64(calCommandQueueSynchronizePollingTimeoutDivisorEnvName, 0)) {
             calCommandQueueSynchronizePollingTimeoutDivisor = Cal::Utils::getCalEnvI64(calCommandQueueSynchronizePollingTimeoutDivisorEnvName, 0);
         }
+        if (Cal::Utils::getCalEnvFlag(calL0TrackDirtyPagesEnvName, false)) {
+            dirtyPagesTracker.init();
+        }
     }
 
     ze_driver_handle_t asRemoteObject() {
@@ -554,6 +560,10 @@ class IcdL0Platform : public Cal::Client::Icd::IcdPlatform, public _ze_driver_ha
         return hostptrCopiesReader;
     }
 
+    Logic::DirtyPagesTracker &getDirtyPagesTracker() {
+        return dirtyPagesTracker;
+    }
+
     Logic::PropertiesCache::VectorTuple<ze_driver_properties_t,
                                         ze_driver_ipc_properties_t,
                                         ze_driver_extension_properties_t,
@@ -700,6 +710,7 @@ class IcdL0Platform : public Cal::Client::Icd::IcdPlatform, public _ze_driver_ha
     std::unordered_map<const void *, Cal::Utils::RemoteFd> ipcPtrToRemoteFdMap;
 
     Logic::HostptrCopiesReader hostptrCopiesReader;
+    Logic::DirtyPagesTracker dirtyPagesTracker;
 };
 
 } // namespace LevelZero
@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "dirty_pages_tracker.h"
+
+#include "shared/log.h"
+#include "shared/utils.h"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace Cal::Client::Icd::LevelZero::Logic {
+
+bool DirtyPagesTracker::Registration::tracks(const std::vector<Cal::Rpc::TransferDesc> &transferDescs) const {
+    if (transfers.size() != transferDescs.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < transferDescs.size(); ++i) {
+        const auto &tracked = transfers[i].desc;
+        const auto &requested = transferDescs[i];
+        if ((tracked.shmemId != requested.shmemId) || (tracked.underlyingSize != requested.underlyingSize) || (tracked.offsetFromResourceStart != requested.offsetFromResourceStart) ||
+            (tracked.clientAddress != requested.clientAddress) || (tracked.bytesCountToCopy != requested.bytesCountToCopy)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DirtyPagesTracker::Registration::track(const std::vector<Cal::Rpc::TransferDesc> &transferDescs) {
+    transfers.clear();
+    transfers.reserve(transferDescs.size());
+    for (const auto &desc : transferDescs) {
+        auto firstPage = desc.clientAddress & ~(pageSize - 1);
+        auto endPage = Cal::Utils::alignUpPow2<pageSize>(desc.clientAddress + desc.bytesCountToCopy);
+        transfers.push_back(TrackedTransfer{desc, firstPage, std::vector<bool>((endPage - firstPage) / pageSize, true)});
+    }
+}
+
+DirtyPagesTracker::~DirtyPagesTracker() {
+    if (-1 != pagemapFd) {
+        close(pagemapFd);
+    }
+    if (-1 != clearRefsFd) {
+        close(clearRefsFd);
+    }
+}
+
+bool DirtyPagesTracker::init() {
+    pagemapFd = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+    clearRefsFd = open("/proc/self/clear_refs", O_WRONLY | O_CLOEXEC);
+    if ((-1 == pagemapFd) || (-1 == clearRefsFd)) {
+        log<Verbosity::info>("Could not open /proc/self/pagemap or /proc/self/clear_refs - dirty pages tracking is disabled");
+        return false;
+    }
+
+    // kernels without CONFIG_MEM_SOFT_DIRTY accept clearing of the bits, but never set them
+    std::vector<uint8_t> probeStorage(2 * pageSize);
+    auto probe = Cal::Utils::alignUpPow2<pageSize>(probeStorage.data());
+    std::vector<bool> probeBits;
+    *reinterpret_cast<volatile uint8_t *>(probe) = 1U;
+    if (false == clearSoftDirtyBits()) {
+        return false;
+    }
+    *reinterpret_cast<volatile uint8_t *>(probe) = 2U;
+    if ((false == readSoftDirtyBits(reinterpret_cast<uintptr_t>(probe), 1U, probeBits)) || (false == probeBits[0])) {
+        log<Verbosity::info>("Soft-dirty bits are not supported by the kernel - dirty pages tracking is disabled");
+        return false;
+    }
+
+    log<Verbosity::debug>("Enabled tracking of dirty pages for command lists' hostptr transfers");
+    enabled = true;
+    return true;
+}
+
+std::shared_ptr<DirtyPagesTracker::Registration> DirtyPagesTracker::createRegistration() {
+    auto registration = std::make_shared<Registration>();
+    std::lock_guard<std::mutex> lock(mutex);
+    registrations.push_back(registration);
+    return registration;
+}
+
+std::vector<Cal::Rpc::TransferDesc> DirtyPagesTracker::selectModified(Registration &registration, const std::vector<Cal::Rpc::TransferDesc> &transferDescs) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (false == registration.tracks(transferDescs)) {
+        log<Verbosity::bloat>("Transfers of command list have changed - all of them will be performed");
+        registration.track(transferDescs);
+    }
+
+    std::vector<Cal::Rpc::TransferDesc> modified;
+    std::vector<bool> softDirtyBits;
+    for (auto &transfer : registration.transfers) {
+        auto pagesCount = transfer.pendingDirtyPages.size();
+        if (false == readSoftDirtyBits(transfer.firstPage, pagesCount, softDirtyBits)) {
+            softDirtyBits.assign(pagesCount, true);
+        }
+
+        const auto transferBegin = transfer.desc.clientAddress;
+        const auto transferEnd = transferBegin + transfer.desc.bytesCountToCopy;
+        size_t page = 0U;
+        while (page < pagesCount) {
+            if ((false == transfer.pendingDirtyPages[page]) && (false == softDirtyBits[page])) {
+                ++page;
+                continue;
+            }
+            auto firstDirtyPage = page;
+            while ((page < pagesCount) && (transfer.pendingDirtyPages[page] || softDirtyBits[page])) {
+                ++page;
+            }
+
+            auto begin = std::max(transfer.firstPage + firstDirtyPage * pageSize, transferBegin);
+            auto end = std::min(transfer.firstPage + page * pageSize, transferEnd);
+            auto part = transfer.desc;
+            part.clientAddress = begin;
+            part.offsetFromResourceStart += begin - transferBegin;
+            part.bytesCountToCopy = end - begin;
+            modified.push_back(part);
+        }
+        transfer.pendingDirtyPages.assign(pagesCount, false);
+    }
+
+    // bits are about to be cleared - remember modifications of pages tracked for other command lists
+    auto remaining = registrations.begin();
+    for (auto &weakRegistration : registrations) {
+        auto other = weakRegistration.lock();
+        if (nullptr == other) {
+            continue;
+        }
+        *remaining++ = weakRegistration;
+        if (other.get() == &registration) {
+            continue;
+        }
+        for (auto &transfer : other->transfers) {
+            auto pagesCount = transfer.pendingDirtyPages.size();
+            if (false == readSoftDirtyBits(transfer.firstPage, pagesCount, softDirtyBits)) {
+                softDirtyBits.assign(pagesCount, true);
+            }
+            for (size_t page = 0; page < pagesCount; ++page) {
+                transfer.pendingDirtyPages[page] = transfer.pendingDirtyPages[page] || softDirtyBits[page];
+            }
+        }
+    }
+    registrations.erase(remaining, registrations.end());
+
+    if (false == clearSoftDirtyBits()) {
+        log<Verbosity::error>("Could not clear soft-dirty bits - pages modified earlier will be transferred again");
+    }
+
+    log<Verbosity::bloat>("Dirty pages tracking reduced %zu transfers to %zu", transferDescs.size(), modified.size());
+    return modified;
+}
+
+bool DirtyPagesTracker::readSoftDirtyBits(uintptr_t firstPage, size_t pagesCount, std::vector<bool> &outBits) {
+    std::vector<uint64_t> entries(pagesCount);
+    auto dst = reinterpret_cast<char *>(entries.data());
+    size_t bytesToRead = pagesCount * sizeof(uint64_t);
+    off_t offset = static_cast<off_t>((firstPage / pageSize) * sizeof(uint64_t));
+    while (bytesToRead > 0) {
+        auto bytesRead = pread(pagemapFd, dst, bytesToRead, offset);
+        if (bytesRead <= 0) {
+            log<Verbosity::debug>("Could not read page map entries of range %p (pages : %zu)", reinterpret_cast<void *>(firstPage), pagesCount);
+            return false;
+        }
+        dst += bytesRead;
+        offset += bytesRead;
+        bytesToRead -= static_cast<size_t>(bytesRead);
+    }
+
+    outBits.resize(pagesCount);
+    for (size_t i = 0; i < pagesCount; ++i) {
+        outBits[i] = (0 != (entries[i] & pagemapSoftDirtyBit));
+    }
+    return true;
+}
+
+bool DirtyPagesTracker::clearSoftDirtyBits() {
+    constexpr char clearSoftDirty[] = "4";
+    if (1 != write(clearRefsFd, clearSoftDirty, 1)) {
+        log<Verbosity::debug>("Could not clear soft-dirty bits");
+        return false;
+    }
+    return true;
+}
+
+} // namespace Cal::Client::Icd::LevelZero::Logic
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/shmem_transfer_desc.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Cal::Client::Icd::LevelZero::Logic {
+
+// Selects pages of user's stack/heap that were modified since they were last transferred to the service on execution of
+// given command list. Modifications are detected with soft-dirty bits of page table entries (/proc/self/pagemap).
+// These bits can be cleared only for the whole process at once, so before clearing them, modifications of pages
+// tracked for other command lists are accumulated in their registrations.
+// Note : writes performed concurrently with execution of command list (i.e. while the bits are collected) may be missed.
+class DirtyPagesTracker {
+  public:
+    static constexpr size_t pageSize = 4096U;
+    static constexpr uint64_t pagemapSoftDirtyBit = 1ULL << 55;
+
+    // per-command list state - all of its pages are considered modified until its transfers get tracked
+    class Registration {
+      protected:
+        friend DirtyPagesTracker;
+
+        struct TrackedTransfer {
+            Cal::Rpc::TransferDesc desc;
+            uintptr_t firstPage{};
+            std::vector<bool> pendingDirtyPages;
+        };
+
+        bool tracks(const std::vector<Cal::Rpc::TransferDesc> &transferDescs) const;
+        void track(const std::vector<Cal::Rpc::TransferDesc> &transferDescs);
+
+        std::vector<TrackedTransfer> transfers;
+    };
+
+    DirtyPagesTracker() = default;
+    mockable ~DirtyPagesTracker();
+
+    DirtyPagesTracker(const DirtyPagesTracker &) = delete;
+    DirtyPagesTracker &operator=(const DirtyPagesTracker &) = delete;
+
+    bool init();
+
+    bool isEnabled() const {
+        return enabled;
+    }
+
+    std::shared_ptr<Registration> createRegistration();
+
+    // returns parts of transferDescs that cover pages modified since previous call for given registration
+    std::vector<Cal::Rpc::TransferDesc> selectModified(Registration &registration, const std::vector<Cal::Rpc::TransferDesc> &transferDescs);
+
+  protected:
+    mockable bool readSoftDirtyBits(uintptr_t firstPage, size_t pagesCount, std::vector<bool> &outBits);
+    mockable bool clearSoftDirtyBits();
+
+    bool enabled = false;
+    int pagemapFd = -1;
+    int clearRefsFd = -1;
+
+    std::mutex mutex;
+    std::vector<std::weak_ptr<Registration>> registrations;
+};
+
+} // namespace Cal::Client::Icd::LevelZero::Logic
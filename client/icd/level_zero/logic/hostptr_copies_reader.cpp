@@ -10,6 +10,7 @@
 #include "client/icd/icd_global_state.h"
 #include "generated_rpc_messages_level_zero.h"
 #include "shared/ipc.h"
+#include "shared/parallel_copy.h"
 #include "shared/rpc.h"
 #include "shared/shmem.h"
 
@@ -52,29 +53,41 @@ std::vector<Cal::Rpc::TransferDesc> HostptrCopiesReader::getHostptrCopiesToUpdat
 
 bool HostptrCopiesReader::copyMappedMemory(Cal::Ipc::ShmemImporter &shmemImporter,
                                            const std::vector<Cal::Rpc::TransferDesc> &transferDescs) {
+    std::vector<Cal::Ipc::ShmemImporter::AllocationT> mappings;
+    std::vector<Cal::Utils::ParallelCopy::CopyDesc> copies;
+    mappings.reserve(transferDescs.size());
+    copies.reserve(transferDescs.size());
+
+    bool success = true;
     for (const auto &transfer : transferDescs) {
         if (transfer.shmemId != -1) { // Perform transfer via shmem
-            auto shmem = shmemImporter.open(transfer.shmemId, transfer.underlyingSize, nullptr);
+            auto shmem = shmemImporter.openCached(transfer.shmemId, transfer.underlyingSize);
             if (!shmem.isValid()) {
                 log<Verbosity::error>("Cannot map shared memory to perform transfer from service to client!");
-                return false;
+                success = false;
+                break;
             }
 
-            const auto sourceAddress = reinterpret_cast<uintptr_t>(shmem.getMmappedPtr()) + transfer.offsetFromResourceStart;
-            const auto source = reinterpret_cast<const void *>(sourceAddress);
+            const auto source = Cal::Utils::moveByBytes(shmem.getMmappedPtr(), transfer.offsetFromResourceStart);
             const auto destination = reinterpret_cast<void *>(transfer.clientAddress);
-
-            std::memcpy(destination, source, transfer.bytesCountToCopy);
-            shmemImporter.release(shmem);
+            copies.push_back({destination, source, transfer.bytesCountToCopy});
+            mappings.push_back(shmem);
         } else { // Perform transfer via USM
             const auto source = reinterpret_cast<const void *>(transfer.offsetFromResourceStart);
             const auto destination = reinterpret_cast<void *>(usmToHostAddressMap[source]);
-
-            std::memcpy(destination, source, transfer.bytesCountToCopy);
+            copies.push_back({destination, source, transfer.bytesCountToCopy});
         }
     }
 
-    return true;
+    if (success) {
+        Cal::Client::Icd::icdGlobalState.getParallelCopy().copy(copies);
+    }
+
+    for (const auto &shmem : mappings) {
+        shmemImporter.releaseCached(shmem);
+    }
+
+    return success;
 }
 
 } // namespace Cal::Client::Icd::LevelZero::Logic
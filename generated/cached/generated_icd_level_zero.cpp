@@ -9,6 +9,7 @@
 
 #include "client/icd/icd_global_state.h"
 #include "shared/rpc.h"
+#include "shared/transfer_copy.h"
 #include "shared/utils.h"
 
 #include "client/icd/level_zero/icd_level_zero.h"
@@ -7307,7 +7308,7 @@ ze_result_t zeCommandListAppendMemoryCopyImmediate_Local_Local (ze_command_list_
         standalone_srcptr = standalone_srcptr_alloc.get();
         globalPlatform->getHostptrCopiesReader().addToMap(standalone_srcptr, reinterpret_cast<uintptr_t>(srcptr));
         hCommandList->asLocalObject()->registerTemporaryAllocation(srcptr, size, std::move(standalone_srcptr_alloc));
-        memcpy(Cal::Utils::toAddress(standalone_srcptr), srcptr, size);
+        Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standalone_srcptr), srcptr, size);
     }
     auto channelLock = channel.lock();
     using CommandT = Cal::Rpc::LevelZero::ZeCommandListAppendMemoryCopyImmediate_Local_LocalRpcM;
@@ -7489,7 +7490,7 @@ ze_result_t zeCommandListAppendMemoryCopyImmediate_Usm_Local (ze_command_list_ha
         standalone_srcptr = standalone_srcptr_alloc.get();
         globalPlatform->getHostptrCopiesReader().addToMap(standalone_srcptr, reinterpret_cast<uintptr_t>(srcptr));
         hCommandList->asLocalObject()->registerTemporaryAllocation(srcptr, size, std::move(standalone_srcptr_alloc));
-        memcpy(Cal::Utils::toAddress(standalone_srcptr), srcptr, size);
+        Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standalone_srcptr), srcptr, size);
     }
     auto channelLock = channel.lock();
     using CommandT = Cal::Rpc::LevelZero::ZeCommandListAppendMemoryCopyImmediate_Usm_LocalRpcM;
@@ -7652,7 +7653,7 @@ ze_result_t zeCommandListAppendMemoryCopyImmediate_Shared_Local (ze_command_list
         standalone_srcptr = standalone_srcptr_alloc.get();
         globalPlatform->getHostptrCopiesReader().addToMap(standalone_srcptr, reinterpret_cast<uintptr_t>(srcptr));
         hCommandList->asLocalObject()->registerTemporaryAllocation(srcptr, size, std::move(standalone_srcptr_alloc));
-        memcpy(Cal::Utils::toAddress(standalone_srcptr), srcptr, size);
+        Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standalone_srcptr), srcptr, size);
     }
     auto channelLock = channel.lock();
     using CommandT = Cal::Rpc::LevelZero::ZeCommandListAppendMemoryCopyImmediate_Shared_LocalRpcM;
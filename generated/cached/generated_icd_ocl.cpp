@@ -9,6 +9,7 @@
 
 #include "client/icd/icd_global_state.h"
 #include "shared/rpc.h"
+#include "shared/transfer_copy.h"
 #include "shared/utils.h"
 
 #include "client/icd/icd_page_fault_manager.h"
@@ -2557,7 +2558,7 @@ cl_int clEnqueueReadImage (cl_command_queue command_queue, cl_mem image, cl_bool
         return command->returnValue();
     }
     command->copyToCaller(dynMemTraits);
-    memcpy(ptr, standalone_ptr, Cal::Client::Icd::Ocl::getImageReadWriteHostMemorySize(image, src_origin, region, row_pitch, slice_pitch));
+    Cal::Utils::TransferCopy::copy(ptr, standalone_ptr, Cal::Client::Icd::Ocl::getImageReadWriteHostMemorySize(image, src_origin, region, row_pitch, slice_pitch));
     if(event)
     {
         event[0] = globalPlatform->translateNewRemoteObjectToLocalObject(event[0], command_queue);
@@ -2583,7 +2584,7 @@ cl_int clEnqueueWriteImage (cl_command_queue command_queue, cl_mem image, cl_boo
     const auto dynMemTraits = CommandT::Captures::DynamicTraits::calculate(command_queue, image, blocking_write, origin, region, input_row_pitch, input_slice_pitch, ptr, num_events_in_wait_list, event_wait_list, event);
     auto commandSpace = channel.getCmdSpace<CommandT>(dynMemTraits.totalDynamicSize);
     auto command = new(commandSpace) CommandT(dynMemTraits, command_queue, image, blocking_write, origin, region, input_row_pitch, input_slice_pitch, ptr, num_events_in_wait_list, event_wait_list, event);
-    memcpy(Cal::Utils::toAddress(standalone_ptr), ptr, Cal::Client::Icd::Ocl::getImageReadWriteHostMemorySize(image, origin, region, input_row_pitch, input_slice_pitch));
+    Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standalone_ptr), ptr, Cal::Client::Icd::Ocl::getImageReadWriteHostMemorySize(image, origin, region, input_row_pitch, input_slice_pitch));
     command->copyFromCaller(dynMemTraits);
     command->args.ptr = reinterpret_cast<const void*>(standalone_ptr);
     command->args.command_queue = command_queue->asLocalObject()->asRemoteObject();
@@ -4003,7 +4004,7 @@ cl_int clEnqueueWriteBuffer_Local (cl_command_queue command_queue, cl_mem buffer
     const auto dynMemTraits = CommandT::Captures::DynamicTraits::calculate(command_queue, buffer, blocking_write, offset, size, ptr, num_events_in_wait_list, event_wait_list, event);
     auto commandSpace = channel.getCmdSpace<CommandT>(dynMemTraits.totalDynamicSize);
     auto command = new(commandSpace) CommandT(dynMemTraits, command_queue, buffer, blocking_write, offset, size, ptr, num_events_in_wait_list, event_wait_list, event);
-    memcpy(Cal::Utils::toAddress(standalone_ptr), ptr, size);
+    Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standalone_ptr), ptr, size);
     command->copyFromCaller(dynMemTraits);
     command->args.ptr = reinterpret_cast<const void*>(standalone_ptr);
     command->args.command_queue = command_queue->asLocalObject()->asRemoteObject();
@@ -4170,7 +4171,7 @@ cl_int clEnqueueWriteBufferRect_Local (cl_command_queue command_queue, cl_mem bu
     const auto dynMemTraits = CommandT::Captures::DynamicTraits::calculate(command_queue, buffer, blocking_write, buffer_origin, host_origin, region, buffer_row_pitch, buffer_slice_pitch, host_row_pitch, host_slice_pitch, ptr, num_events_in_wait_list, event_wait_list, event);
     auto commandSpace = channel.getCmdSpace<CommandT>(dynMemTraits.totalDynamicSize);
     auto command = new(commandSpace) CommandT(dynMemTraits, command_queue, buffer, blocking_write, buffer_origin, host_origin, region, buffer_row_pitch, buffer_slice_pitch, host_row_pitch, host_slice_pitch, ptr, num_events_in_wait_list, event_wait_list, event);
-    memcpy(Cal::Utils::toAddress(standalone_ptr), ptr, Cal::Utils::getBufferRectSizeInBytes(host_origin, region, host_row_pitch, host_slice_pitch));
+    Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standalone_ptr), ptr, Cal::Utils::getBufferRectSizeInBytes(host_origin, region, host_row_pitch, host_slice_pitch));
     command->copyFromCaller(dynMemTraits);
     command->args.ptr = reinterpret_cast<const void*>(standalone_ptr);
     command->args.command_queue = command_queue->asLocalObject()->asRemoteObject();
@@ -4374,7 +4375,7 @@ cl_int clEnqueueReadBuffer_Local (cl_command_queue command_queue, cl_mem buffer,
       }
     }
     command->copyToCaller(dynMemTraits);
-    memcpy(ptr, standalone_ptr, size);
+    Cal::Utils::TransferCopy::copy(ptr, standalone_ptr, size);
     if(event)
     {
         event[0] = globalPlatform->translateNewRemoteObjectToLocalObject(event[0], command_queue);
@@ -4550,7 +4551,7 @@ cl_int clEnqueueReadBufferRect_Local (cl_command_queue command_queue, cl_mem buf
       }
     }
     command->copyToCaller(dynMemTraits);
-    memcpy(ptr, standalone_ptr, Cal::Utils::getBufferRectSizeInBytes(host_origin, region, host_row_pitch, host_slice_pitch));
+    Cal::Utils::TransferCopy::copy(ptr, standalone_ptr, Cal::Utils::getBufferRectSizeInBytes(host_origin, region, host_row_pitch, host_slice_pitch));
     if(event)
     {
         event[0] = globalPlatform->translateNewRemoteObjectToLocalObject(event[0], command_queue);
@@ -4699,7 +4700,7 @@ cl_int clEnqueueSVMMemcpy_Local_Local (cl_command_queue command_queue, cl_bool b
     const auto dynMemTraits = CommandT::Captures::DynamicTraits::calculate(command_queue, blocking, dst_ptr, src_ptr, size, num_events_in_wait_list, event_wait_list, event);
     auto commandSpace = channel.getCmdSpace<CommandT>(dynMemTraits.totalDynamicSize);
     auto command = new(commandSpace) CommandT(dynMemTraits, command_queue, blocking, dst_ptr, src_ptr, size, num_events_in_wait_list, event_wait_list, event);
-    memcpy(Cal::Utils::toAddress(standalone_src_ptr), src_ptr, size);
+    Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standalone_src_ptr), src_ptr, size);
     command->copyFromCaller(dynMemTraits);
     command->args.dst_ptr = reinterpret_cast<void*>(standalone_dst_ptr);
     command->args.src_ptr = reinterpret_cast<const void*>(standalone_src_ptr);
@@ -4734,7 +4735,7 @@ cl_int clEnqueueSVMMemcpy_Local_Local (cl_command_queue command_queue, cl_bool b
       }
     }
     command->copyToCaller(dynMemTraits);
-    memcpy(dst_ptr, standalone_dst_ptr, size);
+    Cal::Utils::TransferCopy::copy(dst_ptr, standalone_dst_ptr, size);
     if(event)
     {
         event[0] = globalPlatform->translateNewRemoteObjectToLocalObject(event[0], command_queue);
@@ -4798,7 +4799,7 @@ cl_int clEnqueueSVMMemcpy_Local_Usm (cl_command_queue command_queue, cl_bool blo
       }
     }
     command->copyToCaller(dynMemTraits);
-    memcpy(dst_ptr, standalone_dst_ptr, size);
+    Cal::Utils::TransferCopy::copy(dst_ptr, standalone_dst_ptr, size);
     if(event)
     {
         event[0] = globalPlatform->translateNewRemoteObjectToLocalObject(event[0], command_queue);
@@ -4862,7 +4863,7 @@ cl_int clEnqueueSVMMemcpy_Local_Shared (cl_command_queue command_queue, cl_bool
       }
     }
     command->copyToCaller(dynMemTraits);
-    memcpy(dst_ptr, standalone_dst_ptr, size);
+    Cal::Utils::TransferCopy::copy(dst_ptr, standalone_dst_ptr, size);
     if(event)
     {
         event[0] = globalPlatform->translateNewRemoteObjectToLocalObject(event[0], command_queue);
@@ -4893,7 +4894,7 @@ cl_int clEnqueueSVMMemcpy_Usm_Local (cl_command_queue command_queue, cl_bool blo
     const auto dynMemTraits = CommandT::Captures::DynamicTraits::calculate(command_queue, blocking, dst_ptr, src_ptr, size, num_events_in_wait_list, event_wait_list, event);
     auto commandSpace = channel.getCmdSpace<CommandT>(dynMemTraits.totalDynamicSize);
     auto command = new(commandSpace) CommandT(dynMemTraits, command_queue, blocking, dst_ptr, src_ptr, size, num_events_in_wait_list, event_wait_list, event);
-    memcpy(Cal::Utils::toAddress(standalone_src_ptr), src_ptr, size);
+    Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standalone_src_ptr), src_ptr, size);
     command->copyFromCaller(dynMemTraits);
     command->args.src_ptr = reinterpret_cast<const void*>(standalone_src_ptr);
     command->args.command_queue = command_queue->asLocalObject()->asRemoteObject();
@@ -5069,7 +5070,7 @@ cl_int clEnqueueSVMMemcpy_Shared_Local (cl_command_queue command_queue, cl_bool
     const auto dynMemTraits = CommandT::Captures::DynamicTraits::calculate(command_queue, blocking, dst_ptr, src_ptr, size, num_events_in_wait_list, event_wait_list, event);
     auto commandSpace = channel.getCmdSpace<CommandT>(dynMemTraits.totalDynamicSize);
     auto command = new(commandSpace) CommandT(dynMemTraits, command_queue, blocking, dst_ptr, src_ptr, size, num_events_in_wait_list, event_wait_list, event);
-    memcpy(Cal::Utils::toAddress(standalone_src_ptr), src_ptr, size);
+    Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standalone_src_ptr), src_ptr, size);
     command->copyFromCaller(dynMemTraits);
     command->args.src_ptr = reinterpret_cast<const void*>(standalone_src_ptr);
     command->args.command_queue = command_queue->asLocalObject()->asRemoteObject();
@@ -5251,7 +5252,7 @@ cl_int clEnqueueMemcpyINTEL_Local_Local (cl_command_queue command_queue, cl_bool
     const auto dynMemTraits = CommandT::Captures::DynamicTraits::calculate(command_queue, blocking, dstPtr, srcPtr, size, num_events_in_wait_list, event_wait_list, event);
     auto commandSpace = channel.getCmdSpace<CommandT>(dynMemTraits.totalDynamicSize);
     auto command = new(commandSpace) CommandT(dynMemTraits, command_queue, blocking, dstPtr, srcPtr, size, num_events_in_wait_list, event_wait_list, event);
-    memcpy(Cal::Utils::toAddress(standalone_srcPtr), srcPtr, size);
+    Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standalone_srcPtr), srcPtr, size);
     command->copyFromCaller(dynMemTraits);
     command->args.dstPtr = reinterpret_cast<void*>(standalone_dstPtr);
     command->args.srcPtr = reinterpret_cast<const void*>(standalone_srcPtr);
@@ -5286,7 +5287,7 @@ cl_int clEnqueueMemcpyINTEL_Local_Local (cl_command_queue command_queue, cl_bool
       }
     }
     command->copyToCaller(dynMemTraits);
-    memcpy(dstPtr, standalone_dstPtr, size);
+    Cal::Utils::TransferCopy::copy(dstPtr, standalone_dstPtr, size);
     if(event)
     {
         event[0] = globalPlatform->translateNewRemoteObjectToLocalObject(event[0], command_queue);
@@ -5350,7 +5351,7 @@ cl_int clEnqueueMemcpyINTEL_Local_Usm (cl_command_queue command_queue, cl_bool b
       }
     }
     command->copyToCaller(dynMemTraits);
-    memcpy(dstPtr, standalone_dstPtr, size);
+    Cal::Utils::TransferCopy::copy(dstPtr, standalone_dstPtr, size);
     if(event)
     {
         event[0] = globalPlatform->translateNewRemoteObjectToLocalObject(event[0], command_queue);
@@ -5414,7 +5415,7 @@ cl_int clEnqueueMemcpyINTEL_Local_Shared (cl_command_queue command_queue, cl_boo
       }
     }
     command->copyToCaller(dynMemTraits);
-    memcpy(dstPtr, standalone_dstPtr, size);
+    Cal::Utils::TransferCopy::copy(dstPtr, standalone_dstPtr, size);
     if(event)
     {
         event[0] = globalPlatform->translateNewRemoteObjectToLocalObject(event[0], command_queue);
@@ -5445,7 +5446,7 @@ cl_int clEnqueueMemcpyINTEL_Usm_Local (cl_command_queue command_queue, cl_bool b
     const auto dynMemTraits = CommandT::Captures::DynamicTraits::calculate(command_queue, blocking, dstPtr, srcPtr, size, num_events_in_wait_list, event_wait_list, event);
     auto commandSpace = channel.getCmdSpace<CommandT>(dynMemTraits.totalDynamicSize);
     auto command = new(commandSpace) CommandT(dynMemTraits, command_queue, blocking, dstPtr, srcPtr, size, num_events_in_wait_list, event_wait_list, event);
-    memcpy(Cal::Utils::toAddress(standalone_srcPtr), srcPtr, size);
+    Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standalone_srcPtr), srcPtr, size);
     command->copyFromCaller(dynMemTraits);
     command->args.srcPtr = reinterpret_cast<const void*>(standalone_srcPtr);
     command->args.command_queue = command_queue->asLocalObject()->asRemoteObject();
@@ -5621,7 +5622,7 @@ cl_int clEnqueueMemcpyINTEL_Shared_Local (cl_command_queue command_queue, cl_boo
     const auto dynMemTraits = CommandT::Captures::DynamicTraits::calculate(command_queue, blocking, dstPtr, srcPtr, size, num_events_in_wait_list, event_wait_list, event);
     auto commandSpace = channel.getCmdSpace<CommandT>(dynMemTraits.totalDynamicSize);
     auto command = new(commandSpace) CommandT(dynMemTraits, command_queue, blocking, dstPtr, srcPtr, size, num_events_in_wait_list, event_wait_list, event);
-    memcpy(Cal::Utils::toAddress(standalone_srcPtr), srcPtr, size);
+    Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standalone_srcPtr), srcPtr, size);
     command->copyFromCaller(dynMemTraits);
     command->args.srcPtr = reinterpret_cast<const void*>(standalone_srcPtr);
     command->args.command_queue = command_queue->asLocalObject()->asRemoteObject();
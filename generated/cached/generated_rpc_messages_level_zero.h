@@ -10,6 +10,7 @@
 
 #include "shared/rpc_message.h"
 #include "shared/shmem_transfer_desc.h"
+#include "shared/transfer_copy.h"
 
 #include "shared/l0_opaque_list_serialization.h"
 #include "level_zero/ze_api.h"
@@ -241,6 +242,7 @@ struct ZetMetricGroupGetRpcM {
     static constexpr uint16_t messageSubtype = 0;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -320,7 +322,7 @@ struct ZetMetricGroupGetRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phMetricGroups){
-            memcpy(args.phMetricGroups, captures.phMetricGroups, dynMemTraits.phMetricGroups.size);
+            Cal::Utils::TransferCopy::copy(args.phMetricGroups, captures.phMetricGroups, dynMemTraits.phMetricGroups.size);
         }
     }
 };
@@ -330,6 +332,7 @@ struct ZetMetricGroupGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 1;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -551,6 +554,7 @@ struct ZetMetricGroupGetGlobalTimestampsExpRpcM {
     static constexpr uint16_t messageSubtype = 2;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -626,6 +630,7 @@ struct ZetMetricGroupGetExportDataExpRpcM {
     static constexpr uint16_t messageSubtype = 3;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -719,13 +724,13 @@ struct ZetMetricGroupGetExportDataExpRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.pRawData){
-            memcpy(asMemcpyDstT(captures.getPRawData()), args.pRawData, dynMemTraits.pRawData.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPRawData()), args.pRawData, dynMemTraits.pRawData.size);
         }
         if(args.pExportDataSize){
             captures.pExportDataSize = *args.pExportDataSize;
         }
         if(args.pExportData){
-            memcpy(asMemcpyDstT(captures.getPExportData()), args.pExportData, dynMemTraits.pExportData.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPExportData()), args.pExportData, dynMemTraits.pExportData.size);
         }
     }
 
@@ -734,7 +739,7 @@ struct ZetMetricGroupGetExportDataExpRpcM {
             *args.pExportDataSize = captures.pExportDataSize;
         }
         if(args.pExportData){
-            memcpy(args.pExportData, captures.getPExportData(), dynMemTraits.pExportData.size);
+            Cal::Utils::TransferCopy::copy(args.pExportData, captures.getPExportData(), dynMemTraits.pExportData.size);
         }
     }
 };
@@ -744,6 +749,7 @@ struct ZetMetricGroupCalculateMetricValuesRpcM {
     static constexpr uint16_t messageSubtype = 4;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -841,13 +847,13 @@ struct ZetMetricGroupCalculateMetricValuesRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.pRawData){
-            memcpy(asMemcpyDstT(captures.getPRawData()), args.pRawData, dynMemTraits.pRawData.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPRawData()), args.pRawData, dynMemTraits.pRawData.size);
         }
         if(args.pMetricValueCount){
             captures.pMetricValueCount = *args.pMetricValueCount;
         }
         if(args.pMetricValues){
-            memcpy(asMemcpyDstT(captures.getPMetricValues()), args.pMetricValues, dynMemTraits.pMetricValues.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPMetricValues()), args.pMetricValues, dynMemTraits.pMetricValues.size);
         }
     }
 
@@ -856,7 +862,7 @@ struct ZetMetricGroupCalculateMetricValuesRpcM {
             *args.pMetricValueCount = captures.pMetricValueCount;
         }
         if(args.pMetricValues){
-            memcpy(args.pMetricValues, captures.getPMetricValues(), dynMemTraits.pMetricValues.size);
+            Cal::Utils::TransferCopy::copy(args.pMetricValues, captures.getPMetricValues(), dynMemTraits.pMetricValues.size);
         }
     }
 };
@@ -866,6 +872,7 @@ struct ZetMetricGroupCalculateMultipleMetricValuesExpRpcM {
     static constexpr uint16_t messageSubtype = 5;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -982,7 +989,7 @@ struct ZetMetricGroupCalculateMultipleMetricValuesExpRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.pRawData){
-            memcpy(asMemcpyDstT(captures.getPRawData()), args.pRawData, dynMemTraits.pRawData.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPRawData()), args.pRawData, dynMemTraits.pRawData.size);
         }
         if(args.pSetCount){
             captures.pSetCount = *args.pSetCount;
@@ -991,10 +998,10 @@ struct ZetMetricGroupCalculateMultipleMetricValuesExpRpcM {
             captures.pTotalMetricValueCount = *args.pTotalMetricValueCount;
         }
         if(args.pMetricCounts){
-            memcpy(asMemcpyDstT(captures.getPMetricCounts()), args.pMetricCounts, dynMemTraits.pMetricCounts.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPMetricCounts()), args.pMetricCounts, dynMemTraits.pMetricCounts.size);
         }
         if(args.pMetricValues){
-            memcpy(asMemcpyDstT(captures.getPMetricValues()), args.pMetricValues, dynMemTraits.pMetricValues.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPMetricValues()), args.pMetricValues, dynMemTraits.pMetricValues.size);
         }
     }
 
@@ -1006,10 +1013,10 @@ struct ZetMetricGroupCalculateMultipleMetricValuesExpRpcM {
             *args.pTotalMetricValueCount = captures.pTotalMetricValueCount;
         }
         if(args.pMetricCounts){
-            memcpy(args.pMetricCounts, captures.getPMetricCounts(), dynMemTraits.pMetricCounts.size);
+            Cal::Utils::TransferCopy::copy(args.pMetricCounts, captures.getPMetricCounts(), dynMemTraits.pMetricCounts.size);
         }
         if(args.pMetricValues){
-            memcpy(args.pMetricValues, captures.getPMetricValues(), dynMemTraits.pMetricValues.size);
+            Cal::Utils::TransferCopy::copy(args.pMetricValues, captures.getPMetricValues(), dynMemTraits.pMetricValues.size);
         }
     }
 };
@@ -1019,6 +1026,7 @@ struct ZetMetricGetRpcM {
     static constexpr uint16_t messageSubtype = 6;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -1098,7 +1106,7 @@ struct ZetMetricGetRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phMetrics){
-            memcpy(args.phMetrics, captures.phMetrics, dynMemTraits.phMetrics.size);
+            Cal::Utils::TransferCopy::copy(args.phMetrics, captures.phMetrics, dynMemTraits.phMetrics.size);
         }
     }
 };
@@ -1108,6 +1116,7 @@ struct ZetMetricGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 7;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -1177,6 +1186,7 @@ struct ZetContextActivateMetricGroupsRpcM {
     static constexpr uint16_t messageSubtype = 8;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -1250,7 +1260,7 @@ struct ZetContextActivateMetricGroupsRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phMetricGroups){
-            memcpy(asMemcpyDstT(captures.phMetricGroups), args.phMetricGroups, dynMemTraits.phMetricGroups.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phMetricGroups), args.phMetricGroups, dynMemTraits.phMetricGroups.size);
         }
     }
 };
@@ -1260,6 +1270,7 @@ struct ZetMetricStreamerOpenRpcM {
     static constexpr uint16_t messageSubtype = 9;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -1349,6 +1360,7 @@ struct ZetMetricStreamerReadDataRpcM {
     static constexpr uint16_t messageSubtype = 10;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -1426,6 +1438,7 @@ struct ZetMetricStreamerReadDataRpcHelperRpcM {
     static constexpr uint16_t messageSubtype = 11;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -1503,6 +1516,7 @@ struct ZetMetricStreamerCloseRpcM {
     static constexpr uint16_t messageSubtype = 12;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -1555,6 +1569,7 @@ struct ZetMetricQueryPoolCreateRpcM {
     static constexpr uint16_t messageSubtype = 13;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -1637,6 +1652,7 @@ struct ZetMetricQueryPoolDestroyRpcM {
     static constexpr uint16_t messageSubtype = 14;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -1689,6 +1705,7 @@ struct ZetMetricQueryCreateRpcM {
     static constexpr uint16_t messageSubtype = 15;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -1756,6 +1773,7 @@ struct ZetMetricQueryDestroyRpcM {
     static constexpr uint16_t messageSubtype = 16;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -1808,6 +1826,7 @@ struct ZetMetricQueryResetRpcM {
     static constexpr uint16_t messageSubtype = 17;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -1860,6 +1879,7 @@ struct ZetMetricQueryGetDataRpcM {
     static constexpr uint16_t messageSubtype = 18;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -1939,7 +1959,7 @@ struct ZetMetricQueryGetDataRpcM {
             *args.pRawDataSize = captures.pRawDataSize;
         }
         if(args.pRawData){
-            memcpy(args.pRawData, captures.pRawData, dynMemTraits.pRawData.size);
+            Cal::Utils::TransferCopy::copy(args.pRawData, captures.pRawData, dynMemTraits.pRawData.size);
         }
     }
 };
@@ -1949,6 +1969,7 @@ struct ZetCommandListAppendMetricQueryBeginRpcM {
     static constexpr uint16_t messageSubtype = 19;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -2005,6 +2026,7 @@ struct ZetCommandListAppendMetricQueryEndRpcM {
     static constexpr uint16_t messageSubtype = 20;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -2082,7 +2104,7 @@ struct ZetCommandListAppendMetricQueryEndRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -2092,6 +2114,7 @@ struct ZetCommandListAppendMetricMemoryBarrierRpcM {
     static constexpr uint16_t messageSubtype = 21;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -2144,6 +2167,7 @@ struct ZetCommandListAppendMetricStreamerMarkerRpcM {
     static constexpr uint16_t messageSubtype = 22;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -2209,6 +2233,7 @@ struct ZetDeviceGetDebugPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 23;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -2430,6 +2455,7 @@ struct ZetDebugAttachRpcM {
     static constexpr uint16_t messageSubtype = 24;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -2504,6 +2530,7 @@ struct ZetDebugDetachRpcM {
     static constexpr uint16_t messageSubtype = 25;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -2556,6 +2583,7 @@ struct ZetKernelGetProfileInfoRpcM {
     static constexpr uint16_t messageSubtype = 26;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -2625,6 +2653,7 @@ struct ZesDeviceResetRpcM {
     static constexpr uint16_t messageSubtype = 27;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -2681,6 +2710,7 @@ struct ZesDeviceResetExtRpcM {
     static constexpr uint16_t messageSubtype = 28;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -2737,6 +2767,7 @@ struct ZesDeviceEnumPowerDomainsRpcM {
     static constexpr uint16_t messageSubtype = 29;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -2810,7 +2841,7 @@ struct ZesDeviceEnumPowerDomainsRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.phPower){
-            memcpy(asMemcpyDstT(captures.phPower), args.phPower, dynMemTraits.phPower.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phPower), args.phPower, dynMemTraits.phPower.size);
         }
     }
 
@@ -2819,7 +2850,7 @@ struct ZesDeviceEnumPowerDomainsRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phPower){
-            memcpy(args.phPower, captures.phPower, dynMemTraits.phPower.size);
+            Cal::Utils::TransferCopy::copy(args.phPower, captures.phPower, dynMemTraits.phPower.size);
         }
     }
 };
@@ -2829,6 +2860,7 @@ struct ZesDeviceGetCardPowerDomainRpcM {
     static constexpr uint16_t messageSubtype = 30;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -2898,6 +2930,7 @@ struct ZesPowerGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 31;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -3179,6 +3212,7 @@ struct ZesPowerGetEnergyCounterRpcM {
     static constexpr uint16_t messageSubtype = 32;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -3248,6 +3282,7 @@ struct ZesPowerGetLimitsRpcM {
     static constexpr uint16_t messageSubtype = 33;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -3339,6 +3374,7 @@ struct ZesPowerSetLimitsRpcM {
     static constexpr uint16_t messageSubtype = 34;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -3418,6 +3454,7 @@ struct ZesPowerGetLimitsExtRpcM {
     static constexpr uint16_t messageSubtype = 35;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -3491,7 +3528,7 @@ struct ZesPowerGetLimitsExtRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.pSustained){
-            memcpy(asMemcpyDstT(captures.pSustained), args.pSustained, dynMemTraits.pSustained.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.pSustained), args.pSustained, dynMemTraits.pSustained.size);
         }
     }
 
@@ -3500,7 +3537,7 @@ struct ZesPowerGetLimitsExtRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.pSustained){
-            memcpy(args.pSustained, captures.pSustained, dynMemTraits.pSustained.size);
+            Cal::Utils::TransferCopy::copy(args.pSustained, captures.pSustained, dynMemTraits.pSustained.size);
         }
     }
 };
@@ -3510,6 +3547,7 @@ struct ZesPowerSetLimitsExtRpcM {
     static constexpr uint16_t messageSubtype = 36;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -3583,7 +3621,7 @@ struct ZesPowerSetLimitsExtRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.pSustained){
-            memcpy(asMemcpyDstT(captures.pSustained), args.pSustained, dynMemTraits.pSustained.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.pSustained), args.pSustained, dynMemTraits.pSustained.size);
         }
     }
 };
@@ -3593,6 +3631,7 @@ struct ZesPowerGetEnergyThresholdRpcM {
     static constexpr uint16_t messageSubtype = 37;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -3662,6 +3701,7 @@ struct ZesPowerSetEnergyThresholdRpcM {
     static constexpr uint16_t messageSubtype = 38;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -3718,6 +3758,7 @@ struct ZesDeviceEventRegisterRpcM {
     static constexpr uint16_t messageSubtype = 39;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -3774,6 +3815,7 @@ struct ZesDriverEventListenRpcM {
     static constexpr uint16_t messageSubtype = 40;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -3857,7 +3899,7 @@ struct ZesDriverEventListenRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phDevices){
-            memcpy(asMemcpyDstT(captures.phDevices), args.phDevices, dynMemTraits.phDevices.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phDevices), args.phDevices, dynMemTraits.phDevices.size);
         }
         if(args.pNumDeviceEvents){
             captures.pNumDeviceEvents = *args.pNumDeviceEvents;
@@ -3882,6 +3924,7 @@ struct ZesDriverEventListenExRpcM {
     static constexpr uint16_t messageSubtype = 41;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -3965,7 +4008,7 @@ struct ZesDriverEventListenExRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phDevices){
-            memcpy(asMemcpyDstT(captures.phDevices), args.phDevices, dynMemTraits.phDevices.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phDevices), args.phDevices, dynMemTraits.phDevices.size);
         }
         if(args.pNumDeviceEvents){
             captures.pNumDeviceEvents = *args.pNumDeviceEvents;
@@ -3990,6 +4033,7 @@ struct ZesDeviceEnumTemperatureSensorsRpcM {
     static constexpr uint16_t messageSubtype = 42;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -4063,7 +4107,7 @@ struct ZesDeviceEnumTemperatureSensorsRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.phTemperature){
-            memcpy(asMemcpyDstT(captures.phTemperature), args.phTemperature, dynMemTraits.phTemperature.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phTemperature), args.phTemperature, dynMemTraits.phTemperature.size);
         }
     }
 
@@ -4072,7 +4116,7 @@ struct ZesDeviceEnumTemperatureSensorsRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phTemperature){
-            memcpy(args.phTemperature, captures.phTemperature, dynMemTraits.phTemperature.size);
+            Cal::Utils::TransferCopy::copy(args.phTemperature, captures.phTemperature, dynMemTraits.phTemperature.size);
         }
     }
 };
@@ -4082,6 +4126,7 @@ struct ZesTemperatureGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 43;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -4151,6 +4196,7 @@ struct ZesTemperatureGetConfigRpcM {
     static constexpr uint16_t messageSubtype = 44;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -4220,6 +4266,7 @@ struct ZesTemperatureSetConfigRpcM {
     static constexpr uint16_t messageSubtype = 45;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -4283,6 +4330,7 @@ struct ZesTemperatureGetStateRpcM {
     static constexpr uint16_t messageSubtype = 46;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -4352,6 +4400,7 @@ struct ZesDeviceEnumRasErrorSetsRpcM {
     static constexpr uint16_t messageSubtype = 47;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -4425,7 +4474,7 @@ struct ZesDeviceEnumRasErrorSetsRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.phRas){
-            memcpy(asMemcpyDstT(captures.phRas), args.phRas, dynMemTraits.phRas.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phRas), args.phRas, dynMemTraits.phRas.size);
         }
     }
 
@@ -4434,7 +4483,7 @@ struct ZesDeviceEnumRasErrorSetsRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phRas){
-            memcpy(args.phRas, captures.phRas, dynMemTraits.phRas.size);
+            Cal::Utils::TransferCopy::copy(args.phRas, captures.phRas, dynMemTraits.phRas.size);
         }
     }
 };
@@ -4444,6 +4493,7 @@ struct ZesRasGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 48;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -4513,6 +4563,7 @@ struct ZesRasGetConfigRpcM {
     static constexpr uint16_t messageSubtype = 49;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -4582,6 +4633,7 @@ struct ZesRasSetConfigRpcM {
     static constexpr uint16_t messageSubtype = 50;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -4645,6 +4697,7 @@ struct ZesRasGetStateRpcM {
     static constexpr uint16_t messageSubtype = 51;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -4705,6 +4758,7 @@ struct ZesDeviceEnumFrequencyDomainsRpcM {
     static constexpr uint16_t messageSubtype = 52;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -4778,7 +4832,7 @@ struct ZesDeviceEnumFrequencyDomainsRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.phFrequency){
-            memcpy(asMemcpyDstT(captures.phFrequency), args.phFrequency, dynMemTraits.phFrequency.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phFrequency), args.phFrequency, dynMemTraits.phFrequency.size);
         }
     }
 
@@ -4787,7 +4841,7 @@ struct ZesDeviceEnumFrequencyDomainsRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phFrequency){
-            memcpy(args.phFrequency, captures.phFrequency, dynMemTraits.phFrequency.size);
+            Cal::Utils::TransferCopy::copy(args.phFrequency, captures.phFrequency, dynMemTraits.phFrequency.size);
         }
     }
 };
@@ -4797,6 +4851,7 @@ struct ZesFrequencyGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 53;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -4866,6 +4921,7 @@ struct ZesFrequencyGetAvailableClocksRpcM {
     static constexpr uint16_t messageSubtype = 54;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -4939,7 +4995,7 @@ struct ZesFrequencyGetAvailableClocksRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.phFrequency){
-            memcpy(asMemcpyDstT(captures.phFrequency), args.phFrequency, dynMemTraits.phFrequency.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phFrequency), args.phFrequency, dynMemTraits.phFrequency.size);
         }
     }
 
@@ -4948,7 +5004,7 @@ struct ZesFrequencyGetAvailableClocksRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phFrequency){
-            memcpy(args.phFrequency, captures.phFrequency, dynMemTraits.phFrequency.size);
+            Cal::Utils::TransferCopy::copy(args.phFrequency, captures.phFrequency, dynMemTraits.phFrequency.size);
         }
     }
 };
@@ -4958,6 +5014,7 @@ struct ZesFrequencyGetRangeRpcM {
     static constexpr uint16_t messageSubtype = 55;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5027,6 +5084,7 @@ struct ZesFrequencySetRangeRpcM {
     static constexpr uint16_t messageSubtype = 56;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5090,6 +5148,7 @@ struct ZesFrequencyGetStateRpcM {
     static constexpr uint16_t messageSubtype = 57;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5159,6 +5218,7 @@ struct ZesFrequencyGetThrottleTimeRpcM {
     static constexpr uint16_t messageSubtype = 58;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5228,6 +5288,7 @@ struct ZesFrequencyOcGetCapabilitiesRpcM {
     static constexpr uint16_t messageSubtype = 59;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5297,6 +5358,7 @@ struct ZesFrequencyOcGetVoltageTargetRpcM {
     static constexpr uint16_t messageSubtype = 60;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5357,6 +5419,7 @@ struct ZesFrequencyOcSetVoltageTargetRpcM {
     static constexpr uint16_t messageSubtype = 61;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5417,6 +5480,7 @@ struct ZesFrequencyOcSetModeRpcM {
     static constexpr uint16_t messageSubtype = 62;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5473,6 +5537,7 @@ struct ZesFrequencyOcGetModeRpcM {
     static constexpr uint16_t messageSubtype = 63;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5529,6 +5594,7 @@ struct ZesFrequencyOcGetIccMaxRpcM {
     static constexpr uint16_t messageSubtype = 64;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5585,6 +5651,7 @@ struct ZesFrequencyOcSetIccMaxRpcM {
     static constexpr uint16_t messageSubtype = 65;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5641,6 +5708,7 @@ struct ZesFrequencyOcGetTjMaxRpcM {
     static constexpr uint16_t messageSubtype = 66;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5697,6 +5765,7 @@ struct ZesFrequencyOcSetTjMaxRpcM {
     static constexpr uint16_t messageSubtype = 67;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5753,6 +5822,7 @@ struct ZesDeviceEnumEngineGroupsRpcM {
     static constexpr uint16_t messageSubtype = 68;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5826,7 +5896,7 @@ struct ZesDeviceEnumEngineGroupsRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.phEngine){
-            memcpy(asMemcpyDstT(captures.phEngine), args.phEngine, dynMemTraits.phEngine.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phEngine), args.phEngine, dynMemTraits.phEngine.size);
         }
     }
 
@@ -5835,7 +5905,7 @@ struct ZesDeviceEnumEngineGroupsRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phEngine){
-            memcpy(args.phEngine, captures.phEngine, dynMemTraits.phEngine.size);
+            Cal::Utils::TransferCopy::copy(args.phEngine, captures.phEngine, dynMemTraits.phEngine.size);
         }
     }
 };
@@ -5845,6 +5915,7 @@ struct ZesDeviceEnumSchedulersRpcM {
     static constexpr uint16_t messageSubtype = 69;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -5918,7 +5989,7 @@ struct ZesDeviceEnumSchedulersRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.phScheduler){
-            memcpy(asMemcpyDstT(captures.phScheduler), args.phScheduler, dynMemTraits.phScheduler.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phScheduler), args.phScheduler, dynMemTraits.phScheduler.size);
         }
     }
 
@@ -5927,7 +5998,7 @@ struct ZesDeviceEnumSchedulersRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phScheduler){
-            memcpy(args.phScheduler, captures.phScheduler, dynMemTraits.phScheduler.size);
+            Cal::Utils::TransferCopy::copy(args.phScheduler, captures.phScheduler, dynMemTraits.phScheduler.size);
         }
     }
 };
@@ -5937,6 +6008,7 @@ struct ZesSchedulerGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 70;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -6006,6 +6078,7 @@ struct ZesSchedulerGetCurrentModeRpcM {
     static constexpr uint16_t messageSubtype = 71;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -6075,6 +6148,7 @@ struct ZesSchedulerGetTimeoutModePropertiesRpcM {
     static constexpr uint16_t messageSubtype = 72;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -6148,6 +6222,7 @@ struct ZesSchedulerGetTimesliceModePropertiesRpcM {
     static constexpr uint16_t messageSubtype = 73;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -6221,6 +6296,7 @@ struct ZesSchedulerSetTimeoutModeRpcM {
     static constexpr uint16_t messageSubtype = 74;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -6298,6 +6374,7 @@ struct ZesSchedulerSetTimesliceModeRpcM {
     static constexpr uint16_t messageSubtype = 75;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -6375,6 +6452,7 @@ struct ZesSchedulerSetExclusiveModeRpcM {
     static constexpr uint16_t messageSubtype = 76;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -6444,6 +6522,7 @@ struct ZesSchedulerSetComputeUnitDebugModeRpcM {
     static constexpr uint16_t messageSubtype = 77;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -6513,6 +6592,7 @@ struct ZesEngineGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 78;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -6582,6 +6662,7 @@ struct ZesEngineGetActivityRpcM {
     static constexpr uint16_t messageSubtype = 79;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -6651,6 +6732,7 @@ struct ZesDeviceGetStateRpcM {
     static constexpr uint16_t messageSubtype = 80;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -6714,6 +6796,7 @@ struct ZesDeviceProcessesGetStateRpcM {
     static constexpr uint16_t messageSubtype = 81;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -6787,7 +6870,7 @@ struct ZesDeviceProcessesGetStateRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.pProcesses){
-            memcpy(asMemcpyDstT(captures.pProcesses), args.pProcesses, dynMemTraits.pProcesses.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.pProcesses), args.pProcesses, dynMemTraits.pProcesses.size);
         }
     }
 
@@ -6796,7 +6879,7 @@ struct ZesDeviceProcessesGetStateRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.pProcesses){
-            memcpy(args.pProcesses, captures.pProcesses, dynMemTraits.pProcesses.size);
+            Cal::Utils::TransferCopy::copy(args.pProcesses, captures.pProcesses, dynMemTraits.pProcesses.size);
         }
     }
 };
@@ -6806,6 +6889,7 @@ struct ZesDevicePciGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 82;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -6869,6 +6953,7 @@ struct ZesDevicePciGetStateRpcM {
     static constexpr uint16_t messageSubtype = 83;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -6932,6 +7017,7 @@ struct ZesDevicePciGetBarsRpcM {
     static constexpr uint16_t messageSubtype = 84;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -7064,7 +7150,7 @@ struct ZesDevicePciGetBarsRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.pProperties){
-            memcpy(asMemcpyDstT(captures.getPProperties()), args.pProperties, dynMemTraits.pProperties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPProperties()), args.pProperties, dynMemTraits.pProperties.size);
         }
         using Cal::Utils::alignUpPow2;
 
@@ -7118,7 +7204,7 @@ struct ZesDevicePciGetBarsRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.pProperties){
-            memcpy(args.pProperties, captures.getPProperties(), dynMemTraits.pProperties.size);
+            Cal::Utils::TransferCopy::copy(args.pProperties, captures.getPProperties(), dynMemTraits.pProperties.size);
         }
         using Cal::Utils::alignUpPow2;
 
@@ -7171,6 +7257,7 @@ struct ZesDevicePciGetStatsRpcM {
     static constexpr uint16_t messageSubtype = 85;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -7234,6 +7321,7 @@ struct ZesDeviceGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 86;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -7303,6 +7391,7 @@ struct ZesDeviceEnumMemoryModulesRpcM {
     static constexpr uint16_t messageSubtype = 87;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -7376,7 +7465,7 @@ struct ZesDeviceEnumMemoryModulesRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.phMemory){
-            memcpy(asMemcpyDstT(captures.phMemory), args.phMemory, dynMemTraits.phMemory.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phMemory), args.phMemory, dynMemTraits.phMemory.size);
         }
     }
 
@@ -7385,7 +7474,7 @@ struct ZesDeviceEnumMemoryModulesRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phMemory){
-            memcpy(args.phMemory, captures.phMemory, dynMemTraits.phMemory.size);
+            Cal::Utils::TransferCopy::copy(args.phMemory, captures.phMemory, dynMemTraits.phMemory.size);
         }
     }
 };
@@ -7395,6 +7484,7 @@ struct ZesMemoryGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 88;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -7464,6 +7554,7 @@ struct ZesMemoryGetStateRpcM {
     static constexpr uint16_t messageSubtype = 89;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -7533,6 +7624,7 @@ struct ZesMemoryGetBandwidthRpcM {
     static constexpr uint16_t messageSubtype = 90;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -7602,6 +7694,7 @@ struct ZesDeviceEnumPerformanceFactorDomainsRpcM {
     static constexpr uint16_t messageSubtype = 91;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -7675,7 +7768,7 @@ struct ZesDeviceEnumPerformanceFactorDomainsRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.phPerf){
-            memcpy(asMemcpyDstT(captures.phPerf), args.phPerf, dynMemTraits.phPerf.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phPerf), args.phPerf, dynMemTraits.phPerf.size);
         }
     }
 
@@ -7684,7 +7777,7 @@ struct ZesDeviceEnumPerformanceFactorDomainsRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phPerf){
-            memcpy(args.phPerf, captures.phPerf, dynMemTraits.phPerf.size);
+            Cal::Utils::TransferCopy::copy(args.phPerf, captures.phPerf, dynMemTraits.phPerf.size);
         }
     }
 };
@@ -7694,6 +7787,7 @@ struct ZesPerformanceFactorGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 92;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -7763,6 +7857,7 @@ struct ZesPerformanceFactorGetConfigRpcM {
     static constexpr uint16_t messageSubtype = 93;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -7832,6 +7927,7 @@ struct ZesPerformanceFactorSetConfigRpcM {
     static constexpr uint16_t messageSubtype = 94;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -7888,6 +7984,7 @@ struct ZesDeviceEnumStandbyDomainsRpcM {
     static constexpr uint16_t messageSubtype = 95;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -7961,7 +8058,7 @@ struct ZesDeviceEnumStandbyDomainsRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.phStandby){
-            memcpy(asMemcpyDstT(captures.phStandby), args.phStandby, dynMemTraits.phStandby.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phStandby), args.phStandby, dynMemTraits.phStandby.size);
         }
     }
 
@@ -7970,7 +8067,7 @@ struct ZesDeviceEnumStandbyDomainsRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phStandby){
-            memcpy(args.phStandby, captures.phStandby, dynMemTraits.phStandby.size);
+            Cal::Utils::TransferCopy::copy(args.phStandby, captures.phStandby, dynMemTraits.phStandby.size);
         }
     }
 };
@@ -7980,6 +8077,7 @@ struct ZesStandbyGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 96;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -8049,6 +8147,7 @@ struct ZesStandbyGetModeRpcM {
     static constexpr uint16_t messageSubtype = 97;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -8112,6 +8211,7 @@ struct ZesStandbySetModeRpcM {
     static constexpr uint16_t messageSubtype = 98;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -8168,6 +8268,7 @@ struct ZeInitRpcM {
     static constexpr uint16_t messageSubtype = 99;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -8220,6 +8321,7 @@ struct ZeCommandListAppendMemoryRangesBarrierRpcM {
     static constexpr uint16_t messageSubtype = 100;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -8330,13 +8432,13 @@ struct ZeCommandListAppendMemoryRangesBarrierRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.pRangeSizes){
-            memcpy(asMemcpyDstT(captures.getPRangeSizes()), args.pRangeSizes, dynMemTraits.pRangeSizes.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPRangeSizes()), args.pRangeSizes, dynMemTraits.pRangeSizes.size);
         }
         if(args.pRanges){
-            memcpy(asMemcpyDstT(captures.getPRanges()), args.pRanges, dynMemTraits.pRanges.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPRanges()), args.pRanges, dynMemTraits.pRanges.size);
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -8346,6 +8448,7 @@ struct ZeContextSystemBarrierRpcM {
     static constexpr uint16_t messageSubtype = 101;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -8402,6 +8505,7 @@ struct ZeCommandListCreateRpcM {
     static constexpr uint16_t messageSubtype = 102;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -8480,6 +8584,7 @@ struct ZeCommandListCreateImmediateRpcM {
     static constexpr uint16_t messageSubtype = 103;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -8558,6 +8663,7 @@ struct ZeCommandListDestroyRpcM {
     static constexpr uint16_t messageSubtype = 104;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -8610,6 +8716,7 @@ struct ZeCommandListCloseRpcM {
     static constexpr uint16_t messageSubtype = 105;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -8662,6 +8769,7 @@ struct ZeCommandListResetRpcM {
     static constexpr uint16_t messageSubtype = 106;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -8715,6 +8823,7 @@ struct ZeCommandQueueCreateRpcM {
     static constexpr uint16_t messageSubtype = 107;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -8793,6 +8902,7 @@ struct ZeCommandQueueDestroyRpcM {
     static constexpr uint16_t messageSubtype = 108;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -8845,6 +8955,7 @@ struct ZeCommandQueueExecuteCommandListsRpcM {
     static constexpr uint16_t messageSubtype = 109;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -8918,7 +9029,7 @@ struct ZeCommandQueueExecuteCommandListsRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phCommandLists){
-            memcpy(asMemcpyDstT(captures.phCommandLists), args.phCommandLists, dynMemTraits.phCommandLists.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phCommandLists), args.phCommandLists, dynMemTraits.phCommandLists.size);
         }
     }
 };
@@ -8928,6 +9039,7 @@ struct ZeCommandQueueExecuteCommandListsCopyMemoryRpcHelperRpcM {
     static constexpr uint16_t messageSubtype = 110;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -9017,7 +9129,7 @@ struct ZeCommandQueueExecuteCommandListsCopyMemoryRpcHelperRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.chunks){
-            memcpy(asMemcpyDstT(captures.getChunks()), args.chunks, dynMemTraits.chunks.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getChunks()), args.chunks, dynMemTraits.chunks.size);
         }
         if(args.transferDescsCount){
             captures.transferDescsCount = *args.transferDescsCount;
@@ -9029,7 +9141,7 @@ struct ZeCommandQueueExecuteCommandListsCopyMemoryRpcHelperRpcM {
             *args.transferDescsCount = captures.transferDescsCount;
         }
         if(args.transferDescs){
-            memcpy(args.transferDescs, captures.getTransferDescs(), dynMemTraits.transferDescs.size);
+            Cal::Utils::TransferCopy::copy(args.transferDescs, captures.getTransferDescs(), dynMemTraits.transferDescs.size);
         }
     }
 };
@@ -9039,6 +9151,7 @@ struct ZeCommandQueueSynchronizeRpcM {
     static constexpr uint16_t messageSubtype = 111;
     static constexpr float latency = 2.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -9095,6 +9208,7 @@ struct ZeContextCreateRpcM {
     static constexpr uint16_t messageSubtype = 112;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -9278,6 +9392,7 @@ struct ZeContextCreateExRpcM {
     static constexpr uint16_t messageSubtype = 113;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -9419,7 +9534,7 @@ struct ZeContextCreateExRpcM {
             captures.desc = *args.desc;
         }
         if(args.phDevices){
-            memcpy(asMemcpyDstT(captures.getPhDevices()), args.phDevices, dynMemTraits.phDevices.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhDevices()), args.phDevices, dynMemTraits.phDevices.size);
         }
         using Cal::Utils::alignUpPow2;
 
@@ -9480,6 +9595,7 @@ struct ZeContextDestroyRpcM {
     static constexpr uint16_t messageSubtype = 114;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -9532,6 +9648,7 @@ struct ZeContextGetStatusRpcM {
     static constexpr uint16_t messageSubtype = 115;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -9589,6 +9706,7 @@ struct ZeCommandListAppendMemoryFillRpcHelperUsm2UsmRpcM {
     static constexpr uint16_t messageSubtype = 116;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -9678,7 +9796,7 @@ struct ZeCommandListAppendMemoryFillRpcHelperUsm2UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -9688,6 +9806,7 @@ struct ZeCommandListAppendMemoryFillRpcHelperUsm2MallocRpcM {
     static constexpr uint16_t messageSubtype = 117;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -9777,7 +9896,7 @@ struct ZeCommandListAppendMemoryFillRpcHelperUsm2MallocRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -9787,6 +9906,7 @@ struct ZeCommandListAppendMemoryFillRpcHelperMalloc2UsmRpcM {
     static constexpr uint16_t messageSubtype = 118;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -9891,10 +10011,10 @@ struct ZeCommandListAppendMemoryFillRpcHelperMalloc2UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.pattern){
-            memcpy(asMemcpyDstT(captures.getPattern()), args.pattern, dynMemTraits.pattern.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPattern()), args.pattern, dynMemTraits.pattern.size);
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -9904,6 +10024,7 @@ struct ZeCommandListAppendMemoryFillRpcHelperMalloc2MallocRpcM {
     static constexpr uint16_t messageSubtype = 119;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -10008,10 +10129,10 @@ struct ZeCommandListAppendMemoryFillRpcHelperMalloc2MallocRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.pattern){
-            memcpy(asMemcpyDstT(captures.getPattern()), args.pattern, dynMemTraits.pattern.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPattern()), args.pattern, dynMemTraits.pattern.size);
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -10029,6 +10150,7 @@ struct ZeCommandListAppendMemoryPrefetchRpcM {
     static constexpr uint16_t messageSubtype = 120;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -10090,6 +10212,7 @@ struct ZeDeviceGetRpcM {
     static constexpr uint16_t messageSubtype = 121;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -10169,7 +10292,7 @@ struct ZeDeviceGetRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phDevices){
-            memcpy(args.phDevices, captures.phDevices, dynMemTraits.phDevices.size);
+            Cal::Utils::TransferCopy::copy(args.phDevices, captures.phDevices, dynMemTraits.phDevices.size);
         }
     }
 };
@@ -10179,6 +10302,7 @@ struct ZeDeviceGetSubDevicesRpcM {
     static constexpr uint16_t messageSubtype = 122;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -10258,7 +10382,7 @@ struct ZeDeviceGetSubDevicesRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phSubdevices){
-            memcpy(args.phSubdevices, captures.phSubdevices, dynMemTraits.phSubdevices.size);
+            Cal::Utils::TransferCopy::copy(args.phSubdevices, captures.phSubdevices, dynMemTraits.phSubdevices.size);
         }
     }
 };
@@ -10268,6 +10392,7 @@ struct ZeDeviceGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 123;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -10489,6 +10614,7 @@ struct ZeDeviceGetComputePropertiesRpcM {
     static constexpr uint16_t messageSubtype = 124;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -10558,6 +10684,7 @@ struct ZeDeviceGetModulePropertiesRpcM {
     static constexpr uint16_t messageSubtype = 125;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -10839,6 +10966,7 @@ struct ZeDeviceGetCommandQueueGroupPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 126;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -10912,7 +11040,7 @@ struct ZeDeviceGetCommandQueueGroupPropertiesRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.pCommandQueueGroupProperties){
-            memcpy(asMemcpyDstT(captures.pCommandQueueGroupProperties), args.pCommandQueueGroupProperties, dynMemTraits.pCommandQueueGroupProperties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.pCommandQueueGroupProperties), args.pCommandQueueGroupProperties, dynMemTraits.pCommandQueueGroupProperties.size);
         }
     }
 
@@ -10921,7 +11049,7 @@ struct ZeDeviceGetCommandQueueGroupPropertiesRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.pCommandQueueGroupProperties){
-            memcpy(args.pCommandQueueGroupProperties, captures.pCommandQueueGroupProperties, dynMemTraits.pCommandQueueGroupProperties.size);
+            Cal::Utils::TransferCopy::copy(args.pCommandQueueGroupProperties, captures.pCommandQueueGroupProperties, dynMemTraits.pCommandQueueGroupProperties.size);
         }
     }
 };
@@ -10931,6 +11059,7 @@ struct ZeDeviceGetMemoryPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 127;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -11063,7 +11192,7 @@ struct ZeDeviceGetMemoryPropertiesRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.pMemProperties){
-            memcpy(asMemcpyDstT(captures.getPMemProperties()), args.pMemProperties, dynMemTraits.pMemProperties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPMemProperties()), args.pMemProperties, dynMemTraits.pMemProperties.size);
         }
         using Cal::Utils::alignUpPow2;
 
@@ -11117,7 +11246,7 @@ struct ZeDeviceGetMemoryPropertiesRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.pMemProperties){
-            memcpy(args.pMemProperties, captures.getPMemProperties(), dynMemTraits.pMemProperties.size);
+            Cal::Utils::TransferCopy::copy(args.pMemProperties, captures.getPMemProperties(), dynMemTraits.pMemProperties.size);
         }
         using Cal::Utils::alignUpPow2;
 
@@ -11170,6 +11299,7 @@ struct ZeDeviceGetMemoryAccessPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 128;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -11239,6 +11369,7 @@ struct ZeDeviceGetCachePropertiesRpcM {
     static constexpr uint16_t messageSubtype = 129;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -11371,7 +11502,7 @@ struct ZeDeviceGetCachePropertiesRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.pCacheProperties){
-            memcpy(asMemcpyDstT(captures.getPCacheProperties()), args.pCacheProperties, dynMemTraits.pCacheProperties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPCacheProperties()), args.pCacheProperties, dynMemTraits.pCacheProperties.size);
         }
         using Cal::Utils::alignUpPow2;
 
@@ -11425,7 +11556,7 @@ struct ZeDeviceGetCachePropertiesRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.pCacheProperties){
-            memcpy(args.pCacheProperties, captures.getPCacheProperties(), dynMemTraits.pCacheProperties.size);
+            Cal::Utils::TransferCopy::copy(args.pCacheProperties, captures.getPCacheProperties(), dynMemTraits.pCacheProperties.size);
         }
         using Cal::Utils::alignUpPow2;
 
@@ -11478,6 +11609,7 @@ struct ZeDeviceGetImagePropertiesRpcM {
     static constexpr uint16_t messageSubtype = 130;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -11547,6 +11679,7 @@ struct ZeDeviceGetExternalMemoryPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 131;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -11616,6 +11749,7 @@ struct ZeDeviceGetP2PPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 132;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -11841,6 +11975,7 @@ struct ZeDeviceCanAccessPeerRpcM {
     static constexpr uint16_t messageSubtype = 133;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -11908,6 +12043,7 @@ struct ZeDeviceGetStatusRpcM {
     static constexpr uint16_t messageSubtype = 134;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -11960,6 +12096,7 @@ struct ZeDeviceGetGlobalTimestampsRpcM {
     static constexpr uint16_t messageSubtype = 135;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -12031,6 +12168,7 @@ struct ZeDeviceReserveCacheExtRpcM {
     static constexpr uint16_t messageSubtype = 136;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -12091,6 +12229,7 @@ struct ZeDeviceSetCacheAdviceExtRpcM {
     static constexpr uint16_t messageSubtype = 137;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -12155,6 +12294,7 @@ struct ZeDriverGetRpcM {
     static constexpr uint16_t messageSubtype = 138;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -12230,7 +12370,7 @@ struct ZeDriverGetRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phDrivers){
-            memcpy(args.phDrivers, captures.phDrivers, dynMemTraits.phDrivers.size);
+            Cal::Utils::TransferCopy::copy(args.phDrivers, captures.phDrivers, dynMemTraits.phDrivers.size);
         }
     }
 };
@@ -12240,6 +12380,7 @@ struct ZeDriverGetApiVersionRpcM {
     static constexpr uint16_t messageSubtype = 139;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -12303,6 +12444,7 @@ struct ZeDriverGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 140;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -12372,6 +12514,7 @@ struct ZeDriverGetIpcPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 141;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -12441,6 +12584,7 @@ struct ZeDriverGetExtensionPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 142;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -12514,7 +12658,7 @@ struct ZeDriverGetExtensionPropertiesRpcM {
             captures.pCount = *args.pCount;
         }
         if(args.pExtensionProperties){
-            memcpy(asMemcpyDstT(captures.pExtensionProperties), args.pExtensionProperties, dynMemTraits.pExtensionProperties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.pExtensionProperties), args.pExtensionProperties, dynMemTraits.pExtensionProperties.size);
         }
     }
 
@@ -12523,7 +12667,7 @@ struct ZeDriverGetExtensionPropertiesRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.pExtensionProperties){
-            memcpy(args.pExtensionProperties, captures.pExtensionProperties, dynMemTraits.pExtensionProperties.size);
+            Cal::Utils::TransferCopy::copy(args.pExtensionProperties, captures.pExtensionProperties, dynMemTraits.pExtensionProperties.size);
         }
     }
 };
@@ -12534,6 +12678,7 @@ struct ZeDriverGetLastErrorDescriptionRpcM {
     static constexpr uint16_t messageSubtype = 143;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -12590,6 +12735,7 @@ struct ZeDriverGetLastErrorDescriptionRpcHelperRpcM {
     static constexpr uint16_t messageSubtype = 144;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -12658,7 +12804,7 @@ struct ZeDriverGetLastErrorDescriptionRpcHelperRpcM {
     
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
-            memcpy(args.pString, captures.pString, dynMemTraits.pString.size);
+            Cal::Utils::TransferCopy::copy(args.pString, captures.pString, dynMemTraits.pString.size);
     }
 };
 static_assert(std::is_standard_layout_v<ZeDriverGetLastErrorDescriptionRpcHelperRpcM>);
@@ -12667,6 +12813,7 @@ struct ZeEventPoolCreateRpcM {
     static constexpr uint16_t messageSubtype = 145;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -12749,7 +12896,7 @@ struct ZeEventPoolCreateRpcM {
             captures.desc = *args.desc;
         }
         if(args.phDevices){
-            memcpy(asMemcpyDstT(captures.phDevices), args.phDevices, dynMemTraits.phDevices.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phDevices), args.phDevices, dynMemTraits.phDevices.size);
         }
     }
 
@@ -12765,6 +12912,7 @@ struct ZeEventPoolDestroyRpcM {
     static constexpr uint16_t messageSubtype = 146;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -12817,6 +12965,7 @@ struct ZeEventCreateRpcM {
     static constexpr uint16_t messageSubtype = 147;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -12891,6 +13040,7 @@ struct ZeEventDestroyRpcM {
     static constexpr uint16_t messageSubtype = 148;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -12943,6 +13093,7 @@ struct ZeEventPoolGetIpcHandleRpcM {
     static constexpr uint16_t messageSubtype = 149;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13006,6 +13157,7 @@ struct ZeEventPoolOpenIpcHandleRpcM {
     static constexpr uint16_t messageSubtype = 150;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13073,6 +13225,7 @@ struct ZeEventPoolCloseIpcHandleRpcM {
     static constexpr uint16_t messageSubtype = 151;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13125,6 +13278,7 @@ struct ZeEventPoolPutIpcHandleRpcM {
     static constexpr uint16_t messageSubtype = 152;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13181,6 +13335,7 @@ struct ZeCommandListAppendBarrierRpcM {
     static constexpr uint16_t messageSubtype = 153;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13254,7 +13409,7 @@ struct ZeCommandListAppendBarrierRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -13264,6 +13419,7 @@ struct ZeCommandListAppendSignalEventRpcM {
     static constexpr uint16_t messageSubtype = 154;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13320,6 +13476,7 @@ struct ZeCommandListAppendWaitOnEventsRpcM {
     static constexpr uint16_t messageSubtype = 155;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13389,7 +13546,7 @@ struct ZeCommandListAppendWaitOnEventsRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phEvents){
-            memcpy(asMemcpyDstT(captures.phEvents), args.phEvents, dynMemTraits.phEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phEvents), args.phEvents, dynMemTraits.phEvents.size);
         }
     }
 };
@@ -13399,6 +13556,7 @@ struct ZeEventHostSignalRpcM {
     static constexpr uint16_t messageSubtype = 156;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13451,6 +13609,7 @@ struct ZeEventHostSynchronizeRpcM {
     static constexpr uint16_t messageSubtype = 157;
     static constexpr float latency = 2.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13507,6 +13666,7 @@ struct ZeEventQueryStatusRpcM {
     static constexpr uint16_t messageSubtype = 158;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13559,6 +13719,7 @@ struct ZeCommandListAppendEventResetRpcM {
     static constexpr uint16_t messageSubtype = 159;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13615,6 +13776,7 @@ struct ZeEventHostResetRpcM {
     static constexpr uint16_t messageSubtype = 160;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13667,6 +13829,7 @@ struct ZeEventQueryKernelTimestampRpcM {
     static constexpr uint16_t messageSubtype = 161;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13730,6 +13893,7 @@ struct ZeCommandListAppendQueryKernelTimestampsRpcM {
     static constexpr uint16_t messageSubtype = 162;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13844,16 +14008,16 @@ struct ZeCommandListAppendQueryKernelTimestampsRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phEvents){
-            memcpy(asMemcpyDstT(captures.getPhEvents()), args.phEvents, dynMemTraits.phEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhEvents()), args.phEvents, dynMemTraits.phEvents.size);
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.dstptr){
-            memcpy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
+            Cal::Utils::TransferCopy::copy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
         }
     }
 };
@@ -13863,6 +14027,7 @@ struct ZeEventQueryTimestampsExpRpcM {
     static constexpr uint16_t messageSubtype = 163;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -13946,7 +14111,7 @@ struct ZeEventQueryTimestampsExpRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.pTimestamps){
-            memcpy(args.pTimestamps, captures.pTimestamps, dynMemTraits.pTimestamps.size);
+            Cal::Utils::TransferCopy::copy(args.pTimestamps, captures.pTimestamps, dynMemTraits.pTimestamps.size);
         }
     }
 };
@@ -13957,6 +14122,7 @@ struct ZeEventQueryKernelTimestampsExtRpcHelperRpcM {
     static constexpr uint16_t messageSubtype = 164;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -14059,10 +14225,10 @@ struct ZeEventQueryKernelTimestampsExtRpcHelperRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.pResultsTimestamps){
-            memcpy(args.pResultsTimestamps, captures.getPResultsTimestamps(), dynMemTraits.pResultsTimestamps.size);
+            Cal::Utils::TransferCopy::copy(args.pResultsTimestamps, captures.getPResultsTimestamps(), dynMemTraits.pResultsTimestamps.size);
         }
         if(args.pResultsSynchronizedTimestamps){
-            memcpy(args.pResultsSynchronizedTimestamps, captures.getPResultsSynchronizedTimestamps(), dynMemTraits.pResultsSynchronizedTimestamps.size);
+            Cal::Utils::TransferCopy::copy(args.pResultsSynchronizedTimestamps, captures.getPResultsSynchronizedTimestamps(), dynMemTraits.pResultsSynchronizedTimestamps.size);
         }
     }
 };
@@ -14072,6 +14238,7 @@ struct ZeFabricVertexGetExpRpcM {
     static constexpr uint16_t messageSubtype = 165;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -14151,7 +14318,7 @@ struct ZeFabricVertexGetExpRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phVertices){
-            memcpy(args.phVertices, captures.phVertices, dynMemTraits.phVertices.size);
+            Cal::Utils::TransferCopy::copy(args.phVertices, captures.phVertices, dynMemTraits.phVertices.size);
         }
     }
 };
@@ -14161,6 +14328,7 @@ struct ZeFabricVertexGetSubVerticesExpRpcM {
     static constexpr uint16_t messageSubtype = 166;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -14240,7 +14408,7 @@ struct ZeFabricVertexGetSubVerticesExpRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phSubvertices){
-            memcpy(args.phSubvertices, captures.phSubvertices, dynMemTraits.phSubvertices.size);
+            Cal::Utils::TransferCopy::copy(args.phSubvertices, captures.phSubvertices, dynMemTraits.phSubvertices.size);
         }
     }
 };
@@ -14250,6 +14418,7 @@ struct ZeFabricVertexGetPropertiesExpRpcM {
     static constexpr uint16_t messageSubtype = 167;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -14471,6 +14640,7 @@ struct ZeFabricVertexGetDeviceExpRpcM {
     static constexpr uint16_t messageSubtype = 168;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -14540,6 +14710,7 @@ struct ZeDeviceGetFabricVertexExpRpcM {
     static constexpr uint16_t messageSubtype = 169;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -14609,6 +14780,7 @@ struct ZeFabricEdgeGetExpRpcM {
     static constexpr uint16_t messageSubtype = 170;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -14692,7 +14864,7 @@ struct ZeFabricEdgeGetExpRpcM {
             *args.pCount = captures.pCount;
         }
         if(args.phEdges){
-            memcpy(args.phEdges, captures.phEdges, dynMemTraits.phEdges.size);
+            Cal::Utils::TransferCopy::copy(args.phEdges, captures.phEdges, dynMemTraits.phEdges.size);
         }
     }
 };
@@ -14702,6 +14874,7 @@ struct ZeFabricEdgeGetVerticesExpRpcM {
     static constexpr uint16_t messageSubtype = 171;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -14779,6 +14952,7 @@ struct ZeFabricEdgeGetPropertiesExpRpcM {
     static constexpr uint16_t messageSubtype = 172;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -15000,6 +15174,7 @@ struct ZeFenceCreateRpcM {
     static constexpr uint16_t messageSubtype = 173;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -15074,6 +15249,7 @@ struct ZeFenceDestroyRpcM {
     static constexpr uint16_t messageSubtype = 174;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -15126,6 +15302,7 @@ struct ZeFenceHostSynchronizeRpcM {
     static constexpr uint16_t messageSubtype = 175;
     static constexpr float latency = 2.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -15182,6 +15359,7 @@ struct ZeFenceQueryStatusRpcM {
     static constexpr uint16_t messageSubtype = 176;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -15234,6 +15412,7 @@ struct ZeFenceResetRpcM {
     static constexpr uint16_t messageSubtype = 177;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -15286,6 +15465,7 @@ struct ZeKernelSetGlobalOffsetExpRpcM {
     static constexpr uint16_t messageSubtype = 178;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -15350,6 +15530,7 @@ struct ZeImageGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 179;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -15536,6 +15717,7 @@ struct ZeImageCreateRpcM {
     static constexpr uint16_t messageSubtype = 180;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -15726,6 +15908,7 @@ struct ZeImageDestroyRpcM {
     static constexpr uint16_t messageSubtype = 181;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -15778,6 +15961,7 @@ struct ZeKernelSchedulingHintExpRpcM {
     static constexpr uint16_t messageSubtype = 182;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -15841,6 +16025,7 @@ struct ZeModuleInspectLinkageExtRpcM {
     static constexpr uint16_t messageSubtype = 183;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -15919,7 +16104,7 @@ struct ZeModuleInspectLinkageExtRpcM {
             captures.pInspectDesc = *args.pInspectDesc;
         }
         if(args.phModules){
-            memcpy(asMemcpyDstT(captures.phModules), args.phModules, dynMemTraits.phModules.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phModules), args.phModules, dynMemTraits.phModules.size);
         }
     }
 
@@ -15941,6 +16126,7 @@ struct ZeMemAllocSharedRpcM {
     static constexpr uint16_t messageSubtype = 184;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -16232,6 +16418,7 @@ struct ZeMemAllocDeviceRpcM {
     static constexpr uint16_t messageSubtype = 185;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -16433,6 +16620,7 @@ struct ZeMemAllocHostRpcM {
     static constexpr uint16_t messageSubtype = 186;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -16628,6 +16816,7 @@ struct ZeMemFreeRpcM {
     static constexpr uint16_t messageSubtype = 187;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -16684,6 +16873,7 @@ struct ZeMemGetAllocPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 188;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -16917,6 +17107,7 @@ struct ZeMemGetAddressRangeRpcM {
     static constexpr uint16_t messageSubtype = 189;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -16992,6 +17183,7 @@ struct ZeMemGetIpcHandleRpcM {
     static constexpr uint16_t messageSubtype = 190;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -17059,6 +17251,7 @@ struct ZeMemOpenIpcHandleRpcM {
     static constexpr uint16_t messageSubtype = 191;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -17138,6 +17331,7 @@ struct ZeMemCloseIpcHandleRpcM {
     static constexpr uint16_t messageSubtype = 192;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -17199,6 +17393,7 @@ struct ZeMemPutIpcHandleRpcM {
     static constexpr uint16_t messageSubtype = 193;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -17255,6 +17450,7 @@ struct ZexMemGetIpcHandlesRpcM {
     static constexpr uint16_t messageSubtype = 194;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -17338,7 +17534,7 @@ struct ZexMemGetIpcHandlesRpcM {
             *args.numIpcHandles = captures.numIpcHandles;
         }
         if(args.pIpcHandles){
-            memcpy(args.pIpcHandles, captures.pIpcHandles, dynMemTraits.pIpcHandles.size);
+            Cal::Utils::TransferCopy::copy(args.pIpcHandles, captures.pIpcHandles, dynMemTraits.pIpcHandles.size);
         }
     }
 };
@@ -17348,6 +17544,7 @@ struct ZexMemOpenIpcHandlesRpcM {
     static constexpr uint16_t messageSubtype = 195;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -17430,7 +17627,7 @@ struct ZexMemOpenIpcHandlesRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.pIpcHandles){
-            memcpy(asMemcpyDstT(captures.pIpcHandles), args.pIpcHandles, dynMemTraits.pIpcHandles.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.pIpcHandles), args.pIpcHandles, dynMemTraits.pIpcHandles.size);
         }
     }
 
@@ -17446,6 +17643,7 @@ struct ZeMemFreeExtRpcM {
     static constexpr uint16_t messageSubtype = 196;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -17625,6 +17823,7 @@ struct ZeMemGetIpcHandleFromFileDescriptorExpRpcM {
     static constexpr uint16_t messageSubtype = 197;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -17692,6 +17891,7 @@ struct ZeMemGetFileDescriptorFromIpcHandleExpRpcM {
     static constexpr uint16_t messageSubtype = 198;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -17759,6 +17959,7 @@ struct ZeModuleCreateRpcM {
     static constexpr uint16_t messageSubtype = 199;
     static constexpr float latency = 2.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -18539,6 +18740,7 @@ struct ZeModuleDestroyRpcM {
     static constexpr uint16_t messageSubtype = 200;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -18591,6 +18793,7 @@ struct ZeModuleDynamicLinkRpcM {
     static constexpr uint16_t messageSubtype = 201;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -18661,7 +18864,7 @@ struct ZeModuleDynamicLinkRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phModules){
-            memcpy(asMemcpyDstT(captures.phModules), args.phModules, dynMemTraits.phModules.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phModules), args.phModules, dynMemTraits.phModules.size);
         }
         if(args.phLinkLog){
             captures.phLinkLog = *args.phLinkLog;
@@ -18680,6 +18883,7 @@ struct ZeModuleBuildLogDestroyRpcM {
     static constexpr uint16_t messageSubtype = 202;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -18732,6 +18936,7 @@ struct ZeModuleBuildLogGetStringRpcM {
     static constexpr uint16_t messageSubtype = 203;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -18811,7 +19016,7 @@ struct ZeModuleBuildLogGetStringRpcM {
             *args.pSize = captures.pSize;
         }
         if(args.pBuildLog){
-            memcpy(args.pBuildLog, captures.pBuildLog, dynMemTraits.pBuildLog.size);
+            Cal::Utils::TransferCopy::copy(args.pBuildLog, captures.pBuildLog, dynMemTraits.pBuildLog.size);
         }
     }
 };
@@ -18821,6 +19026,7 @@ struct ZeModuleGetNativeBinaryRpcM {
     static constexpr uint16_t messageSubtype = 204;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -18900,7 +19106,7 @@ struct ZeModuleGetNativeBinaryRpcM {
             *args.pSize = captures.pSize;
         }
         if(args.pModuleNativeBinary){
-            memcpy(args.pModuleNativeBinary, captures.pModuleNativeBinary, dynMemTraits.pModuleNativeBinary.size);
+            Cal::Utils::TransferCopy::copy(args.pModuleNativeBinary, captures.pModuleNativeBinary, dynMemTraits.pModuleNativeBinary.size);
         }
     }
 };
@@ -18910,6 +19116,7 @@ struct ZeModuleGetGlobalPointerRpcM {
     static constexpr uint16_t messageSubtype = 205;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -18985,7 +19192,7 @@ struct ZeModuleGetGlobalPointerRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.pGlobalName){
-            memcpy(asMemcpyDstT(captures.pGlobalName), args.pGlobalName, dynMemTraits.pGlobalName.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.pGlobalName), args.pGlobalName, dynMemTraits.pGlobalName.size);
         }
         if(args.pSize){
             captures.pSize = *args.pSize;
@@ -19011,6 +19218,7 @@ struct ZeModuleGetKernelNamesRpcHelperRpcM {
     static constexpr uint16_t messageSubtype = 206;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -19090,7 +19298,7 @@ struct ZeModuleGetKernelNamesRpcHelperRpcM {
             *args.totalLength = captures.totalLength;
         }
         if(args.namesBuffer){
-            memcpy(args.namesBuffer, captures.namesBuffer, dynMemTraits.namesBuffer.size);
+            Cal::Utils::TransferCopy::copy(args.namesBuffer, captures.namesBuffer, dynMemTraits.namesBuffer.size);
         }
     }
 };
@@ -19100,6 +19308,7 @@ struct ZeModuleGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 207;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -19169,6 +19378,7 @@ struct ZeKernelCreateRpcM {
     static constexpr uint16_t messageSubtype = 208;
     static constexpr float latency = 0.5;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -19344,6 +19554,7 @@ struct ZeKernelDestroyRpcM {
     static constexpr uint16_t messageSubtype = 209;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -19396,6 +19607,7 @@ struct ZeModuleGetFunctionPointerRpcM {
     static constexpr uint16_t messageSubtype = 210;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -19466,7 +19678,7 @@ struct ZeModuleGetFunctionPointerRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.pFunctionName){
-            memcpy(asMemcpyDstT(captures.pFunctionName), args.pFunctionName, dynMemTraits.pFunctionName.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.pFunctionName), args.pFunctionName, dynMemTraits.pFunctionName.size);
         }
     }
 
@@ -19481,7 +19693,8 @@ struct ZeKernelSetGroupSizeRpcM {
     Cal::Rpc::RpcMessageHeader header;
     static constexpr uint16_t messageSubtype = 211;
     static constexpr float latency = 0.0;
-    static constexpr CallCategory category = CallCategory::Other;
+    static constexpr CallCategory category = CallCategory::Compute;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = ze_result_t;
@@ -19546,6 +19759,7 @@ struct ZeKernelSuggestGroupSizeRpcM {
     static constexpr uint16_t messageSubtype = 212;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -19637,6 +19851,7 @@ struct ZeKernelSuggestMaxCooperativeGroupCountRpcM {
     static constexpr uint16_t messageSubtype = 213;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -19699,7 +19914,8 @@ struct ZeKernelSetArgumentValueRpcM {
     Cal::Rpc::RpcMessageHeader header;
     static constexpr uint16_t messageSubtype = 214;
     static constexpr float latency = 0.0;
-    static constexpr CallCategory category = CallCategory::Other;
+    static constexpr CallCategory category = CallCategory::Compute;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = ze_result_t;
@@ -19773,7 +19989,7 @@ struct ZeKernelSetArgumentValueRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.pArgValue){
-            memcpy(asMemcpyDstT(captures.pArgValue), args.pArgValue, dynMemTraits.pArgValue.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.pArgValue), args.pArgValue, dynMemTraits.pArgValue.size);
         }
     }
 };
@@ -19782,7 +19998,8 @@ struct ZeKernelSetIndirectAccessRpcM {
     Cal::Rpc::RpcMessageHeader header;
     static constexpr uint16_t messageSubtype = 215;
     static constexpr float latency = 0.0;
-    static constexpr CallCategory category = CallCategory::Other;
+    static constexpr CallCategory category = CallCategory::Compute;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = ze_result_t;
@@ -19839,6 +20056,7 @@ struct ZeKernelGetIndirectAccessRpcM {
     static constexpr uint16_t messageSubtype = 216;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -19903,6 +20121,7 @@ struct ZeKernelGetSourceAttributesRpcHelperRpcM {
     static constexpr uint16_t messageSubtype = 217;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -19976,7 +20195,7 @@ struct ZeKernelGetSourceAttributesRpcHelperRpcM {
             captures.pSize = *args.pSize;
         }
         if(args.pString){
-            memcpy(asMemcpyDstT(captures.pString), args.pString, dynMemTraits.pString.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.pString), args.pString, dynMemTraits.pString.size);
         }
     }
 
@@ -19985,7 +20204,7 @@ struct ZeKernelGetSourceAttributesRpcHelperRpcM {
             *args.pSize = captures.pSize;
         }
         if(args.pString){
-            memcpy(args.pString, captures.pString, dynMemTraits.pString.size);
+            Cal::Utils::TransferCopy::copy(args.pString, captures.pString, dynMemTraits.pString.size);
         }
     }
 };
@@ -19995,6 +20214,7 @@ struct ZeKernelSetCacheConfigRpcM {
     static constexpr uint16_t messageSubtype = 218;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -20051,6 +20271,7 @@ struct ZeKernelGetPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 219;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -20272,6 +20493,7 @@ struct ZeKernelGetNameRpcM {
     static constexpr uint16_t messageSubtype = 220;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -20351,7 +20573,7 @@ struct ZeKernelGetNameRpcM {
             *args.pSize = captures.pSize;
         }
         if(args.pName){
-            memcpy(args.pName, captures.pName, dynMemTraits.pName.size);
+            Cal::Utils::TransferCopy::copy(args.pName, captures.pName, dynMemTraits.pName.size);
         }
     }
 };
@@ -20360,7 +20582,8 @@ struct ZeCommandListAppendLaunchKernelRpcM {
     Cal::Rpc::RpcMessageHeader header;
     static constexpr uint16_t messageSubtype = 221;
     static constexpr float latency = 0.0;
-    static constexpr CallCategory category = CallCategory::Other;
+    static constexpr CallCategory category = CallCategory::Compute;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = ze_result_t;
@@ -20446,7 +20669,7 @@ struct ZeCommandListAppendLaunchKernelRpcM {
             captures.pLaunchFuncArgs = *args.pLaunchFuncArgs;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -20455,7 +20678,8 @@ struct ZeCommandListAppendLaunchCooperativeKernelRpcM {
     Cal::Rpc::RpcMessageHeader header;
     static constexpr uint16_t messageSubtype = 222;
     static constexpr float latency = 0.0;
-    static constexpr CallCategory category = CallCategory::Other;
+    static constexpr CallCategory category = CallCategory::Compute;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = ze_result_t;
@@ -20541,7 +20765,7 @@ struct ZeCommandListAppendLaunchCooperativeKernelRpcM {
             captures.pLaunchFuncArgs = *args.pLaunchFuncArgs;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -20551,6 +20775,7 @@ struct ZeCommandListAppendLaunchKernelIndirectRpcM {
     static constexpr uint16_t messageSubtype = 223;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -20632,7 +20857,7 @@ struct ZeCommandListAppendLaunchKernelIndirectRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -20642,6 +20867,7 @@ struct ZeCommandListAppendLaunchMultipleKernelsIndirectRpcM {
     static constexpr uint16_t messageSubtype = 224;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -20746,10 +20972,10 @@ struct ZeCommandListAppendLaunchMultipleKernelsIndirectRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phKernels){
-            memcpy(asMemcpyDstT(captures.getPhKernels()), args.phKernels, dynMemTraits.phKernels.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhKernels()), args.phKernels, dynMemTraits.phKernels.size);
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -20759,6 +20985,7 @@ struct ZeCommandListHostSynchronizeRpcM {
     static constexpr uint16_t messageSubtype = 225;
     static constexpr float latency = 2.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -20815,6 +21042,7 @@ struct ZeDevicePciGetPropertiesExtRpcM {
     static constexpr uint16_t messageSubtype = 226;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -20884,6 +21112,7 @@ struct ZeContextMakeMemoryResidentRpcM {
     static constexpr uint16_t messageSubtype = 227;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -20948,6 +21177,7 @@ struct ZeContextEvictMemoryRpcM {
     static constexpr uint16_t messageSubtype = 228;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21012,6 +21242,7 @@ struct ZeVirtualMemReserveRpcM {
     static constexpr uint16_t messageSubtype = 229;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21083,6 +21314,7 @@ struct ZeVirtualMemFreeRpcM {
     static constexpr uint16_t messageSubtype = 230;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21143,6 +21375,7 @@ struct ZeVirtualMemQueryPageSizeRpcM {
     static constexpr uint16_t messageSubtype = 231;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21220,6 +21453,7 @@ struct ZePhysicalMemCreateRpcM {
     static constexpr uint16_t messageSubtype = 232;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21301,6 +21535,7 @@ struct ZePhysicalMemDestroyRpcM {
     static constexpr uint16_t messageSubtype = 233;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21357,6 +21592,7 @@ struct ZeVirtualMemMapRpcM {
     static constexpr uint16_t messageSubtype = 234;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21429,6 +21665,7 @@ struct ZeVirtualMemUnmapRpcM {
     static constexpr uint16_t messageSubtype = 235;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21489,6 +21726,7 @@ struct ZeVirtualMemSetAccessAttributeRpcM {
     static constexpr uint16_t messageSubtype = 236;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21553,6 +21791,7 @@ struct ZeVirtualMemGetAccessAttributeRpcM {
     static constexpr uint16_t messageSubtype = 237;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21638,6 +21877,7 @@ struct ZexDriverImportExternalPointerRpcM {
     static constexpr uint16_t messageSubtype = 238;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21698,6 +21938,7 @@ struct ZexDriverReleaseImportedPointerRpcM {
     static constexpr uint16_t messageSubtype = 239;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21754,6 +21995,7 @@ struct ZexDriverGetHostPointerBaseAddressRpcM {
     static constexpr uint16_t messageSubtype = 240;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21823,6 +22065,7 @@ struct ZeCommandListAppendWriteGlobalTimestamp_LocalRpcM {
     static constexpr uint16_t messageSubtype = 241;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21900,7 +22143,7 @@ struct ZeCommandListAppendWriteGlobalTimestamp_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -21910,6 +22153,7 @@ struct ZeCommandListAppendWriteGlobalTimestamp_UsmRpcM {
     static constexpr uint16_t messageSubtype = 242;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -21987,7 +22231,7 @@ struct ZeCommandListAppendWriteGlobalTimestamp_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -21997,6 +22241,7 @@ struct ZeCommandListAppendWriteGlobalTimestamp_SharedRpcM {
     static constexpr uint16_t messageSubtype = 243;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -22074,7 +22319,7 @@ struct ZeCommandListAppendWriteGlobalTimestamp_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -22084,6 +22329,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Usm_UsmRpcM {
     static constexpr uint16_t messageSubtype = 244;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -22169,7 +22415,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Usm_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -22179,6 +22425,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Usm_SharedRpcM {
     static constexpr uint16_t messageSubtype = 245;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -22264,7 +22511,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Usm_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -22274,6 +22521,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Usm_RemappedRpcM {
     static constexpr uint16_t messageSubtype = 246;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -22359,7 +22607,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Usm_RemappedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -22369,6 +22617,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Shared_UsmRpcM {
     static constexpr uint16_t messageSubtype = 247;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -22454,7 +22703,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Shared_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -22464,6 +22713,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Shared_SharedRpcM {
     static constexpr uint16_t messageSubtype = 248;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -22549,7 +22799,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Shared_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -22559,6 +22809,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Shared_RemappedRpcM {
     static constexpr uint16_t messageSubtype = 249;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -22644,7 +22895,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Shared_RemappedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -22654,6 +22905,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Remapped_UsmRpcM {
     static constexpr uint16_t messageSubtype = 250;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -22739,7 +22991,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Remapped_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -22749,6 +23001,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Remapped_SharedRpcM {
     static constexpr uint16_t messageSubtype = 251;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -22834,7 +23087,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Remapped_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -22844,6 +23097,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Remapped_RemappedRpcM {
     static constexpr uint16_t messageSubtype = 252;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -22929,7 +23183,7 @@ struct ZeCommandListAppendMemoryCopyDeferred_Remapped_RemappedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -22939,6 +23193,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Local_LocalRpcM {
     static constexpr uint16_t messageSubtype = 253;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -23024,7 +23279,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Local_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -23034,6 +23289,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Local_UsmRpcM {
     static constexpr uint16_t messageSubtype = 254;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -23119,7 +23375,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Local_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -23129,6 +23385,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Local_SharedRpcM {
     static constexpr uint16_t messageSubtype = 255;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -23214,7 +23471,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Local_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -23224,6 +23481,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Usm_LocalRpcM {
     static constexpr uint16_t messageSubtype = 256;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -23309,7 +23567,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Usm_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -23319,6 +23577,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Usm_UsmRpcM {
     static constexpr uint16_t messageSubtype = 257;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -23404,7 +23663,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Usm_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -23414,6 +23673,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Usm_SharedRpcM {
     static constexpr uint16_t messageSubtype = 258;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -23499,7 +23759,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Usm_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -23509,6 +23769,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Shared_LocalRpcM {
     static constexpr uint16_t messageSubtype = 259;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -23594,7 +23855,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Shared_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -23604,6 +23865,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Shared_UsmRpcM {
     static constexpr uint16_t messageSubtype = 260;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -23689,7 +23951,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Shared_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -23699,6 +23961,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Shared_SharedRpcM {
     static constexpr uint16_t messageSubtype = 261;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -23784,7 +24047,7 @@ struct ZeCommandListAppendMemoryCopyImmediate_Shared_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -23794,6 +24057,7 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Local_LocalRpcM {
     static constexpr uint16_t messageSubtype = 262;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -23904,16 +24168,16 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Local_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.srcptr){
-            memcpy(asMemcpyDstT(captures.getSrcptr()), args.srcptr, dynMemTraits.srcptr.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getSrcptr()), args.srcptr, dynMemTraits.srcptr.size);
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.dstptr){
-            memcpy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
+            Cal::Utils::TransferCopy::copy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
         }
     }
 };
@@ -23923,6 +24187,7 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Local_UsmRpcM {
     static constexpr uint16_t messageSubtype = 263;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -24023,13 +24288,13 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Local_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.dstptr){
-            memcpy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
+            Cal::Utils::TransferCopy::copy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
         }
     }
 };
@@ -24039,6 +24304,7 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Local_SharedRpcM {
     static constexpr uint16_t messageSubtype = 264;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -24139,13 +24405,13 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Local_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.dstptr){
-            memcpy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
+            Cal::Utils::TransferCopy::copy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
         }
     }
 };
@@ -24155,6 +24421,7 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Usm_LocalRpcM {
     static constexpr uint16_t messageSubtype = 265;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -24255,10 +24522,10 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Usm_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.srcptr){
-            memcpy(asMemcpyDstT(captures.getSrcptr()), args.srcptr, dynMemTraits.srcptr.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getSrcptr()), args.srcptr, dynMemTraits.srcptr.size);
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -24268,6 +24535,7 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Usm_UsmRpcM {
     static constexpr uint16_t messageSubtype = 266;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -24353,7 +24621,7 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Usm_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -24363,6 +24631,7 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Usm_SharedRpcM {
     static constexpr uint16_t messageSubtype = 267;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -24448,7 +24717,7 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Usm_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -24458,6 +24727,7 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Shared_LocalRpcM {
     static constexpr uint16_t messageSubtype = 268;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -24558,10 +24828,10 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Shared_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.srcptr){
-            memcpy(asMemcpyDstT(captures.getSrcptr()), args.srcptr, dynMemTraits.srcptr.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getSrcptr()), args.srcptr, dynMemTraits.srcptr.size);
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -24571,6 +24841,7 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Shared_UsmRpcM {
     static constexpr uint16_t messageSubtype = 269;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -24656,7 +24927,7 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Shared_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -24666,6 +24937,7 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Shared_SharedRpcM {
     static constexpr uint16_t messageSubtype = 270;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -24751,7 +25023,7 @@ struct ZeCommandListAppendMemoryCopyImmediateSynchronous_Shared_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -24761,6 +25033,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Usm_UsmRpcM {
     static constexpr uint16_t messageSubtype = 271;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -24874,7 +25147,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Usm_UsmRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -24884,6 +25157,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Usm_SharedRpcM {
     static constexpr uint16_t messageSubtype = 272;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -24997,7 +25271,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Usm_SharedRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -25007,6 +25281,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Usm_RemappedRpcM {
     static constexpr uint16_t messageSubtype = 273;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -25120,7 +25395,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Usm_RemappedRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -25130,6 +25405,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Shared_UsmRpcM {
     static constexpr uint16_t messageSubtype = 274;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -25243,7 +25519,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Shared_UsmRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -25253,6 +25529,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Shared_SharedRpcM {
     static constexpr uint16_t messageSubtype = 275;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -25366,7 +25643,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Shared_SharedRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -25376,6 +25653,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Shared_RemappedRpcM {
     static constexpr uint16_t messageSubtype = 276;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -25489,7 +25767,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Shared_RemappedRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -25499,6 +25777,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Remapped_UsmRpcM {
     static constexpr uint16_t messageSubtype = 277;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -25612,7 +25891,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Remapped_UsmRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -25622,6 +25901,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Remapped_SharedRpcM {
     static constexpr uint16_t messageSubtype = 278;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -25735,7 +26015,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Remapped_SharedRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -25745,6 +26025,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Remapped_RemappedRpcM {
     static constexpr uint16_t messageSubtype = 279;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -25858,7 +26139,7 @@ struct ZeCommandListAppendMemoryCopyRegionDeferred_Remapped_RemappedRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -25868,6 +26149,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Local_UsmRpcM {
     static constexpr uint16_t messageSubtype = 280;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -25996,13 +26278,13 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Local_UsmRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.dstptr){
-            memcpy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
+            Cal::Utils::TransferCopy::copy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
         }
     }
 };
@@ -26012,6 +26294,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Local_SharedRpcM
     static constexpr uint16_t messageSubtype = 281;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -26140,13 +26423,13 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Local_SharedRpcM
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.dstptr){
-            memcpy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
+            Cal::Utils::TransferCopy::copy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
         }
     }
 };
@@ -26156,6 +26439,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Local_RemappedRpc
     static constexpr uint16_t messageSubtype = 282;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -26284,13 +26568,13 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Local_RemappedRpc
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.dstptr){
-            memcpy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
+            Cal::Utils::TransferCopy::copy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
         }
     }
 };
@@ -26300,6 +26584,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Usm_UsmRpcM {
     static constexpr uint16_t messageSubtype = 283;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -26413,7 +26698,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Usm_UsmRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -26423,6 +26708,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Usm_SharedRpcM {
     static constexpr uint16_t messageSubtype = 284;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -26536,7 +26822,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Usm_SharedRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -26546,6 +26832,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Usm_RemappedRpcM
     static constexpr uint16_t messageSubtype = 285;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -26659,7 +26946,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Usm_RemappedRpcM
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -26669,6 +26956,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Shared_UsmRpcM {
     static constexpr uint16_t messageSubtype = 286;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -26782,7 +27070,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Shared_UsmRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -26792,6 +27080,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Shared_SharedRpcM
     static constexpr uint16_t messageSubtype = 287;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -26905,7 +27194,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Shared_SharedRpcM
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -26915,6 +27204,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Shared_RemappedRp
     static constexpr uint16_t messageSubtype = 288;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -27028,7 +27318,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateSynchronous_Shared_RemappedRp
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -27038,6 +27328,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Local_UsmRpcM {
     static constexpr uint16_t messageSubtype = 289;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -27151,7 +27442,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Local_UsmRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -27161,6 +27452,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Local_SharedRpcM
     static constexpr uint16_t messageSubtype = 290;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -27274,7 +27566,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Local_SharedRpcM
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -27284,6 +27576,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Local_RemappedRp
     static constexpr uint16_t messageSubtype = 291;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -27397,7 +27690,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Local_RemappedRp
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -27407,6 +27700,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Usm_UsmRpcM {
     static constexpr uint16_t messageSubtype = 292;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -27520,7 +27814,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Usm_UsmRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -27530,6 +27824,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Usm_SharedRpcM {
     static constexpr uint16_t messageSubtype = 293;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -27643,7 +27938,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Usm_SharedRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -27653,6 +27948,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Usm_RemappedRpcM
     static constexpr uint16_t messageSubtype = 294;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -27766,7 +28062,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Usm_RemappedRpcM
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -27776,6 +28072,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Shared_UsmRpcM {
     static constexpr uint16_t messageSubtype = 295;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -27889,7 +28186,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Shared_UsmRpcM {
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -27899,6 +28196,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Shared_SharedRpc
     static constexpr uint16_t messageSubtype = 296;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -28012,7 +28310,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Shared_SharedRpc
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -28022,6 +28320,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Shared_RemappedR
     static constexpr uint16_t messageSubtype = 297;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -28135,7 +28434,7 @@ struct ZeCommandListAppendMemoryCopyRegionImmediateAsynchronous_Shared_RemappedR
             captures.srcRegion = *args.srcRegion;
         }
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -28145,6 +28444,7 @@ struct ZeCommandListAppendMemoryCopyFromContextDeferred_Usm_UsmRpcM {
     static constexpr uint16_t messageSubtype = 298;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -28234,7 +28534,7 @@ struct ZeCommandListAppendMemoryCopyFromContextDeferred_Usm_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -28244,6 +28544,7 @@ struct ZeCommandListAppendMemoryCopyFromContextDeferred_Shared_UsmRpcM {
     static constexpr uint16_t messageSubtype = 299;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -28333,7 +28634,7 @@ struct ZeCommandListAppendMemoryCopyFromContextDeferred_Shared_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -28343,6 +28644,7 @@ struct ZeCommandListAppendMemoryCopyFromContextDeferred_Remapped_UsmRpcM {
     static constexpr uint16_t messageSubtype = 300;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -28432,7 +28734,7 @@ struct ZeCommandListAppendMemoryCopyFromContextDeferred_Remapped_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -28442,6 +28744,7 @@ struct ZeCommandListAppendMemoryCopyFromContextImmediateSynchronous_Local_UsmRpc
     static constexpr uint16_t messageSubtype = 301;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -28546,13 +28849,13 @@ struct ZeCommandListAppendMemoryCopyFromContextImmediateSynchronous_Local_UsmRpc
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPhWaitEvents()), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.dstptr){
-            memcpy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
+            Cal::Utils::TransferCopy::copy(args.dstptr, captures.getDstptr(), dynMemTraits.dstptr.size);
         }
     }
 };
@@ -28562,6 +28865,7 @@ struct ZeCommandListAppendMemoryCopyFromContextImmediateSynchronous_Usm_UsmRpcM
     static constexpr uint16_t messageSubtype = 302;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -28651,7 +28955,7 @@ struct ZeCommandListAppendMemoryCopyFromContextImmediateSynchronous_Usm_UsmRpcM
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -28661,6 +28965,7 @@ struct ZeCommandListAppendMemoryCopyFromContextImmediateSynchronous_Shared_UsmRp
     static constexpr uint16_t messageSubtype = 303;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -28750,7 +29055,7 @@ struct ZeCommandListAppendMemoryCopyFromContextImmediateSynchronous_Shared_UsmRp
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -28760,6 +29065,7 @@ struct ZeCommandListAppendMemoryCopyFromContextImmediateAsynchronous_Local_UsmRp
     static constexpr uint16_t messageSubtype = 304;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -28849,7 +29155,7 @@ struct ZeCommandListAppendMemoryCopyFromContextImmediateAsynchronous_Local_UsmRp
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -28859,6 +29165,7 @@ struct ZeCommandListAppendMemoryCopyFromContextImmediateAsynchronous_Usm_UsmRpcM
     static constexpr uint16_t messageSubtype = 305;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -28948,7 +29255,7 @@ struct ZeCommandListAppendMemoryCopyFromContextImmediateAsynchronous_Usm_UsmRpcM
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
@@ -28958,6 +29265,7 @@ struct ZeCommandListAppendMemoryCopyFromContextImmediateAsynchronous_Shared_UsmR
     static constexpr uint16_t messageSubtype = 306;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = ze_result_t;
@@ -29047,7 +29355,7 @@ struct ZeCommandListAppendMemoryCopyFromContextImmediateAsynchronous_Shared_UsmR
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.phWaitEvents){
-            memcpy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.phWaitEvents), args.phWaitEvents, dynMemTraits.phWaitEvents.size);
         }
     }
 };
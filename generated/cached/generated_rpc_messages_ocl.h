@@ -10,6 +10,7 @@
 
 #include "shared/rpc_message.h"
 #include "shared/shmem_transfer_desc.h"
+#include "shared/transfer_copy.h"
 
 #ifdef SLIM_OCL
 #   include "ocl_slim_def.h"
@@ -37,6 +38,7 @@ struct ClGetPlatformIDsRpcM {
     static constexpr uint16_t messageSubtype = 0;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -107,7 +109,7 @@ struct ClGetPlatformIDsRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.platforms){
-            memcpy(args.platforms, captures.platforms, dynMemTraits.platforms.size);
+            Cal::Utils::TransferCopy::copy(args.platforms, captures.platforms, dynMemTraits.platforms.size);
         }
         if(args.num_platforms){
             *args.num_platforms = captures.num_platforms;
@@ -121,6 +123,7 @@ struct ClGetPlatformInfoRpcM {
     static constexpr uint16_t messageSubtype = 1;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -199,7 +202,7 @@ struct ClGetPlatformInfoRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -213,6 +216,7 @@ struct ClGetDeviceIDsRpcM {
     static constexpr uint16_t messageSubtype = 2;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -291,7 +295,7 @@ struct ClGetDeviceIDsRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.devices){
-            memcpy(args.devices, captures.devices, dynMemTraits.devices.size);
+            Cal::Utils::TransferCopy::copy(args.devices, captures.devices, dynMemTraits.devices.size);
         }
         if(args.num_devices){
             *args.num_devices = captures.num_devices;
@@ -304,6 +308,7 @@ struct ClGetDeviceInfoRpcM {
     static constexpr uint16_t messageSubtype = 3;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -407,7 +412,7 @@ struct ClGetDeviceInfoRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -424,6 +429,7 @@ struct ClCreateContextRpcM {
     static constexpr uint16_t messageSubtype = 4;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_context;
@@ -522,9 +528,9 @@ struct ClCreateContextRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits, const Cal::Rpc::Ocl::ClCreateContextRpcMImplicitArgs &implicitArgs){
         if(args.properties){
-            memcpy(asMemcpyDstT(captures.getProperties()), args.properties, dynMemTraits.properties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getProperties()), args.properties, dynMemTraits.properties.size);
         }
-        memcpy(asMemcpyDstT(captures.getDevices()), args.devices, dynMemTraits.devices.size);
+        Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getDevices()), args.devices, dynMemTraits.devices.size);
          this->implicitArgs.error_info = implicitArgs.error_info;
     }
 
@@ -545,6 +551,7 @@ struct ClCreateContextFromTypeRpcM {
     static constexpr uint16_t messageSubtype = 5;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_context;
@@ -624,7 +631,7 @@ struct ClCreateContextFromTypeRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits, const Cal::Rpc::Ocl::ClCreateContextFromTypeRpcMImplicitArgs &implicitArgs){
         if(args.properties){
-            memcpy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
         }
          this->implicitArgs.error_info = implicitArgs.error_info;
     }
@@ -642,6 +649,7 @@ struct ClGetContextInfoRpcM {
     static constexpr uint16_t messageSubtype = 6;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -745,7 +753,7 @@ struct ClGetContextInfoRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -758,6 +766,7 @@ struct ClSetContextDestructorCallbackRpcM {
     static constexpr uint16_t messageSubtype = 7;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -818,6 +827,7 @@ struct ClSetMemObjectDestructorCallbackRpcM {
     static constexpr uint16_t messageSubtype = 8;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -878,6 +888,7 @@ struct ClCreateSubDevicesRpcM {
     static constexpr uint16_t messageSubtype = 9;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -971,13 +982,13 @@ struct ClCreateSubDevicesRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.properties){
-            memcpy(asMemcpyDstT(captures.getProperties()), args.properties, dynMemTraits.properties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getProperties()), args.properties, dynMemTraits.properties.size);
         }
     }
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.out_devices){
-            memcpy(args.out_devices, captures.getOut_devices(), dynMemTraits.out_devices.size);
+            Cal::Utils::TransferCopy::copy(args.out_devices, captures.getOut_devices(), dynMemTraits.out_devices.size);
         }
         if(args.num_devices_ret){
             *args.num_devices_ret = captures.num_devices_ret;
@@ -990,6 +1001,7 @@ struct ClCreateCommandQueueRpcM {
     static constexpr uint16_t messageSubtype = 10;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_command_queue;
@@ -1061,6 +1073,7 @@ struct ClSetDefaultDeviceCommandQueueRpcM {
     static constexpr uint16_t messageSubtype = 11;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -1121,6 +1134,7 @@ struct ClCreateCommandQueueWithPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 12;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_command_queue;
@@ -1195,7 +1209,7 @@ struct ClCreateCommandQueueWithPropertiesRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.properties){
-            memcpy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
         }
     }
 
@@ -1211,6 +1225,7 @@ struct ClCreateProgramWithSourceRpcM {
     static constexpr uint16_t messageSubtype = 13;
     static constexpr float latency = 0.5;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_program;
@@ -1329,7 +1344,7 @@ struct ClCreateProgramWithSourceRpcM {
             }
         }
         if(args.lengths){
-            memcpy(asMemcpyDstT(captures.getLengths()), args.lengths, dynMemTraits.lengths.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getLengths()), args.lengths, dynMemTraits.lengths.size);
         }
     }
 
@@ -1345,6 +1360,7 @@ struct ClCreateProgramWithILRpcM {
     static constexpr uint16_t messageSubtype = 14;
     static constexpr float latency = 0.5;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_program;
@@ -1419,7 +1435,7 @@ struct ClCreateProgramWithILRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.il){
-            memcpy(asMemcpyDstT(captures.il), args.il, dynMemTraits.il.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.il), args.il, dynMemTraits.il.size);
         }
     }
 
@@ -1435,6 +1451,7 @@ struct ClCreateProgramWithBinaryRpcM {
     static constexpr uint16_t messageSubtype = 15;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_program;
@@ -1573,10 +1590,10 @@ struct ClCreateProgramWithBinaryRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.device_list){
-            memcpy(asMemcpyDstT(captures.getDevice_list()), args.device_list, dynMemTraits.device_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getDevice_list()), args.device_list, dynMemTraits.device_list.size);
         }
         if(args.lengths){
-            memcpy(asMemcpyDstT(captures.getLengths()), args.lengths, dynMemTraits.lengths.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getLengths()), args.lengths, dynMemTraits.lengths.size);
         }
         if(args.binaries){
             {
@@ -1590,7 +1607,7 @@ struct ClCreateProgramWithBinaryRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.binary_status){
-            memcpy(args.binary_status, captures.getBinary_status(), dynMemTraits.binary_status.size);
+            Cal::Utils::TransferCopy::copy(args.binary_status, captures.getBinary_status(), dynMemTraits.binary_status.size);
         }
         if(args.errcode_ret){
             *args.errcode_ret = captures.errcode_ret;
@@ -1603,6 +1620,7 @@ struct ClCreateProgramWithBuiltInKernelsRpcM {
     static constexpr uint16_t messageSubtype = 16;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_program;
@@ -1696,10 +1714,10 @@ struct ClCreateProgramWithBuiltInKernelsRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.device_list){
-            memcpy(asMemcpyDstT(captures.getDevice_list()), args.device_list, dynMemTraits.device_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getDevice_list()), args.device_list, dynMemTraits.device_list.size);
         }
         if(args.kernel_names){
-            memcpy(asMemcpyDstT(captures.getKernel_names()), args.kernel_names, dynMemTraits.kernel_names.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getKernel_names()), args.kernel_names, dynMemTraits.kernel_names.size);
         }
     }
 
@@ -1717,6 +1735,7 @@ struct ClBuildProgramRpcM {
     static constexpr uint16_t messageSubtype = 17;
     static constexpr float latency = 2.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -1813,10 +1832,10 @@ struct ClBuildProgramRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.device_list){
-            memcpy(asMemcpyDstT(captures.getDevice_list()), args.device_list, dynMemTraits.device_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getDevice_list()), args.device_list, dynMemTraits.device_list.size);
         }
         if(args.options){
-            memcpy(asMemcpyDstT(captures.getOptions()), args.options, dynMemTraits.options.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getOptions()), args.options, dynMemTraits.options.size);
         }
     }
 };
@@ -1826,6 +1845,7 @@ struct ClCompileProgramRpcM {
     static constexpr uint16_t messageSubtype = 18;
     static constexpr float latency = 2.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -1971,13 +1991,13 @@ struct ClCompileProgramRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.device_list){
-            memcpy(asMemcpyDstT(captures.getDevice_list()), args.device_list, dynMemTraits.device_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getDevice_list()), args.device_list, dynMemTraits.device_list.size);
         }
         if(args.options){
-            memcpy(asMemcpyDstT(captures.getOptions()), args.options, dynMemTraits.options.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getOptions()), args.options, dynMemTraits.options.size);
         }
         if(args.input_headers){
-            memcpy(asMemcpyDstT(captures.getInput_headers()), args.input_headers, dynMemTraits.input_headers.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getInput_headers()), args.input_headers, dynMemTraits.input_headers.size);
         }
         if(args.header_include_names){
             {
@@ -1995,6 +2015,7 @@ struct ClLinkProgramRpcM {
     static constexpr uint16_t messageSubtype = 19;
     static constexpr float latency = 2.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_program;
@@ -2114,13 +2135,13 @@ struct ClLinkProgramRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.device_list){
-            memcpy(asMemcpyDstT(captures.getDevice_list()), args.device_list, dynMemTraits.device_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getDevice_list()), args.device_list, dynMemTraits.device_list.size);
         }
         if(args.options){
-            memcpy(asMemcpyDstT(captures.getOptions()), args.options, dynMemTraits.options.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getOptions()), args.options, dynMemTraits.options.size);
         }
         if(args.input_programs){
-            memcpy(asMemcpyDstT(captures.getInput_programs()), args.input_programs, dynMemTraits.input_programs.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getInput_programs()), args.input_programs, dynMemTraits.input_programs.size);
         }
     }
 
@@ -2136,6 +2157,7 @@ struct ClGetProgramBuildInfoRpcM {
     static constexpr uint16_t messageSubtype = 20;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -2218,7 +2240,7 @@ struct ClGetProgramBuildInfoRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -2231,6 +2253,7 @@ struct ClSetProgramReleaseCallbackRpcM {
     static constexpr uint16_t messageSubtype = 21;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -2291,6 +2314,7 @@ struct ClCreateKernelRpcM {
     static constexpr uint16_t messageSubtype = 22;
     static constexpr float latency = 0.5;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_kernel;
@@ -2361,7 +2385,7 @@ struct ClCreateKernelRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.kernel_name){
-            memcpy(asMemcpyDstT(captures.kernel_name), args.kernel_name, dynMemTraits.kernel_name.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.kernel_name), args.kernel_name, dynMemTraits.kernel_name.size);
         }
     }
 
@@ -2377,6 +2401,7 @@ struct ClCloneKernelRpcM {
     static constexpr uint16_t messageSubtype = 23;
     static constexpr float latency = 0.5;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_kernel;
@@ -2440,6 +2465,7 @@ struct ClCreateKernelsInProgramRpcM {
     static constexpr uint16_t messageSubtype = 24;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -2514,7 +2540,7 @@ struct ClCreateKernelsInProgramRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.kernels){
-            memcpy(args.kernels, captures.kernels, dynMemTraits.kernels.size);
+            Cal::Utils::TransferCopy::copy(args.kernels, captures.kernels, dynMemTraits.kernels.size);
         }
         if(args.num_kernels_ret){
             *args.num_kernels_ret = captures.num_kernels_ret;
@@ -2527,6 +2553,7 @@ struct ClGetCommandQueueInfoRpcM {
     static constexpr uint16_t messageSubtype = 25;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -2605,7 +2632,7 @@ struct ClGetCommandQueueInfoRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -2619,6 +2646,7 @@ struct ClGetProgramInfoRpcHelperRpcM {
     static constexpr uint16_t messageSubtype = 26;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -2697,7 +2725,7 @@ struct ClGetProgramInfoRpcHelperRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -2710,6 +2738,7 @@ struct ClGetProgramInfoGetBinariesRpcHelperRpcM {
     static constexpr uint16_t messageSubtype = 27;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -2807,13 +2836,13 @@ struct ClGetProgramInfoGetBinariesRpcHelperRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.binaries_lengths){
-            memcpy(asMemcpyDstT(captures.getBinaries_lengths()), args.binaries_lengths, dynMemTraits.binaries_lengths.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getBinaries_lengths()), args.binaries_lengths, dynMemTraits.binaries_lengths.size);
         }
     }
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.concatenated_binaries){
-            memcpy(args.concatenated_binaries, captures.getConcatenated_binaries(), dynMemTraits.concatenated_binaries.size);
+            Cal::Utils::TransferCopy::copy(args.concatenated_binaries, captures.getConcatenated_binaries(), dynMemTraits.concatenated_binaries.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -2826,6 +2855,7 @@ struct ClGetMemObjectInfoRpcM {
     static constexpr uint16_t messageSubtype = 28;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -2904,7 +2934,7 @@ struct ClGetMemObjectInfoRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -2917,6 +2947,7 @@ struct ClGetImageInfoRpcM {
     static constexpr uint16_t messageSubtype = 29;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -2995,7 +3026,7 @@ struct ClGetImageInfoRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -3008,6 +3039,7 @@ struct ClGetSamplerInfoRpcM {
     static constexpr uint16_t messageSubtype = 30;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -3086,7 +3118,7 @@ struct ClGetSamplerInfoRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -3099,6 +3131,7 @@ struct ClGetKernelInfoRpcM {
     static constexpr uint16_t messageSubtype = 31;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -3177,7 +3210,7 @@ struct ClGetKernelInfoRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -3190,6 +3223,7 @@ struct ClGetKernelWorkGroupInfoRpcM {
     static constexpr uint16_t messageSubtype = 32;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -3272,7 +3306,7 @@ struct ClGetKernelWorkGroupInfoRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -3285,6 +3319,7 @@ struct ClGetKernelArgInfoRpcM {
     static constexpr uint16_t messageSubtype = 33;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -3367,7 +3402,7 @@ struct ClGetKernelArgInfoRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -3380,6 +3415,7 @@ struct ClGetKernelSubGroupInfoRpcM {
     static constexpr uint16_t messageSubtype = 34;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -3485,13 +3521,13 @@ struct ClGetKernelSubGroupInfoRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.input_value){
-            memcpy(asMemcpyDstT(captures.getInput_value()), args.input_value, dynMemTraits.input_value.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getInput_value()), args.input_value, dynMemTraits.input_value.size);
         }
     }
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.getParam_value(), dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.getParam_value(), dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -3504,6 +3540,7 @@ struct ClReleaseCommandQueueRpcM {
     static constexpr uint16_t messageSubtype = 35;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -3556,6 +3593,7 @@ struct ClReleaseContextRpcM {
     static constexpr uint16_t messageSubtype = 36;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -3608,6 +3646,7 @@ struct ClReleaseDeviceRpcM {
     static constexpr uint16_t messageSubtype = 37;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -3660,6 +3699,7 @@ struct ClReleaseKernelRpcM {
     static constexpr uint16_t messageSubtype = 38;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -3712,6 +3752,7 @@ struct ClReleaseSamplerRpcM {
     static constexpr uint16_t messageSubtype = 39;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -3764,6 +3805,7 @@ struct ClReleaseProgramRpcM {
     static constexpr uint16_t messageSubtype = 40;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -3816,6 +3858,7 @@ struct ClReleaseMemObjectRpcM {
     static constexpr uint16_t messageSubtype = 41;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -3868,6 +3911,7 @@ struct ClReleaseEventRpcM {
     static constexpr uint16_t messageSubtype = 42;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -3920,6 +3964,7 @@ struct ClRetainCommandQueueRpcM {
     static constexpr uint16_t messageSubtype = 43;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -3972,6 +4017,7 @@ struct ClRetainContextRpcM {
     static constexpr uint16_t messageSubtype = 44;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -4024,6 +4070,7 @@ struct ClRetainDeviceRpcM {
     static constexpr uint16_t messageSubtype = 45;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -4076,6 +4123,7 @@ struct ClRetainProgramRpcM {
     static constexpr uint16_t messageSubtype = 46;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -4128,6 +4176,7 @@ struct ClRetainMemObjectRpcM {
     static constexpr uint16_t messageSubtype = 47;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -4180,6 +4229,7 @@ struct ClRetainSamplerRpcM {
     static constexpr uint16_t messageSubtype = 48;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -4232,6 +4282,7 @@ struct ClRetainKernelRpcM {
     static constexpr uint16_t messageSubtype = 49;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -4284,6 +4335,7 @@ struct ClRetainEventRpcM {
     static constexpr uint16_t messageSubtype = 50;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -4336,6 +4388,7 @@ struct ClFlushRpcM {
     static constexpr uint16_t messageSubtype = 51;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -4388,6 +4441,7 @@ struct ClFinishRpcM {
     static constexpr uint16_t messageSubtype = 52;
     static constexpr float latency = 2.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -4439,7 +4493,8 @@ struct ClEnqueueNDRangeKernelRpcM {
     Cal::Rpc::RpcMessageHeader header;
     static constexpr uint16_t messageSubtype = 53;
     static constexpr float latency = 0.0;
-    static constexpr CallCategory category = CallCategory::Other;
+    static constexpr CallCategory category = CallCategory::Compute;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -4569,16 +4624,16 @@ struct ClEnqueueNDRangeKernelRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.global_work_offset){
-            memcpy(asMemcpyDstT(captures.getGlobal_work_offset()), args.global_work_offset, dynMemTraits.global_work_offset.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getGlobal_work_offset()), args.global_work_offset, dynMemTraits.global_work_offset.size);
         }
         if(args.global_work_size){
-            memcpy(asMemcpyDstT(captures.getGlobal_work_size()), args.global_work_size, dynMemTraits.global_work_size.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getGlobal_work_size()), args.global_work_size, dynMemTraits.global_work_size.size);
         }
         if(args.local_work_size){
-            memcpy(asMemcpyDstT(captures.getLocal_work_size()), args.local_work_size, dynMemTraits.local_work_size.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getLocal_work_size()), args.local_work_size, dynMemTraits.local_work_size.size);
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.getEvent_wait_list()), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getEvent_wait_list()), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -4594,6 +4649,7 @@ struct ClEnqueueTaskRpcM {
     static constexpr uint16_t messageSubtype = 54;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -4672,7 +4728,7 @@ struct ClEnqueueTaskRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -4688,6 +4744,7 @@ struct ClEnqueueMarkerWithWaitListRpcM {
     static constexpr uint16_t messageSubtype = 55;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -4762,7 +4819,7 @@ struct ClEnqueueMarkerWithWaitListRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -4778,6 +4835,7 @@ struct ClEnqueueMarkerRpcM {
     static constexpr uint16_t messageSubtype = 56;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -4841,6 +4899,7 @@ struct ClEnqueueBarrierWithWaitListRpcM {
     static constexpr uint16_t messageSubtype = 57;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -4915,7 +4974,7 @@ struct ClEnqueueBarrierWithWaitListRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -4931,6 +4990,7 @@ struct ClEnqueueBarrierRpcM {
     static constexpr uint16_t messageSubtype = 58;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -4983,6 +5043,7 @@ struct ClEnqueueWaitForEventsRpcM {
     static constexpr uint16_t messageSubtype = 59;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -5052,7 +5113,7 @@ struct ClEnqueueWaitForEventsRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_list){
-            memcpy(asMemcpyDstT(captures.event_list), args.event_list, dynMemTraits.event_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_list), args.event_list, dynMemTraits.event_list.size);
         }
     }
 };
@@ -5062,6 +5123,7 @@ struct ClEnqueueMigrateMemObjectsRpcM {
     static constexpr uint16_t messageSubtype = 60;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -5163,10 +5225,10 @@ struct ClEnqueueMigrateMemObjectsRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.mem_objects){
-            memcpy(asMemcpyDstT(captures.getMem_objects()), args.mem_objects, dynMemTraits.mem_objects.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getMem_objects()), args.mem_objects, dynMemTraits.mem_objects.size);
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.getEvent_wait_list()), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getEvent_wait_list()), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -5184,6 +5246,7 @@ struct ClCreateBufferRpcHelperUseHostPtrZeroCopyMallocShmemRpcM {
     static constexpr uint16_t messageSubtype = 61;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_mem;
@@ -5259,6 +5322,7 @@ struct ClCreateBufferRpcHelperNotUseHostPtrZeroCopyMallocShmemRpcM {
     static constexpr uint16_t messageSubtype = 62;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_mem;
@@ -5337,7 +5401,7 @@ struct ClCreateBufferRpcHelperNotUseHostPtrZeroCopyMallocShmemRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.host_ptr){
-            memcpy(asMemcpyDstT(captures.host_ptr), args.host_ptr, dynMemTraits.host_ptr.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.host_ptr), args.host_ptr, dynMemTraits.host_ptr.size);
         }
     }
 
@@ -5353,6 +5417,7 @@ struct ClCreateSubBufferRpcM {
     static constexpr uint16_t messageSubtype = 63;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_mem;
@@ -5431,7 +5496,7 @@ struct ClCreateSubBufferRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.buffer_create_info){
-            memcpy(asMemcpyDstT(captures.buffer_create_info), args.buffer_create_info, dynMemTraits.buffer_create_info.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.buffer_create_info), args.buffer_create_info, dynMemTraits.buffer_create_info.size);
         }
     }
 
@@ -5447,6 +5512,7 @@ struct ClCreatePipeRpcM {
     static constexpr uint16_t messageSubtype = 64;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_mem;
@@ -5529,7 +5595,7 @@ struct ClCreatePipeRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.properties){
-            memcpy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
         }
     }
 
@@ -5545,6 +5611,7 @@ struct ClGetPipeInfoRpcM {
     static constexpr uint16_t messageSubtype = 65;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -5623,7 +5690,7 @@ struct ClGetPipeInfoRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -5636,6 +5703,7 @@ struct ClCreateImageRpcM {
     static constexpr uint16_t messageSubtype = 66;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_mem;
@@ -5726,7 +5794,7 @@ struct ClCreateImageRpcM {
             captures.image_desc = *args.image_desc;
         }
         if(args.host_ptr){
-            memcpy(asMemcpyDstT(captures.host_ptr), args.host_ptr, dynMemTraits.host_ptr.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.host_ptr), args.host_ptr, dynMemTraits.host_ptr.size);
         }
     }
 
@@ -5742,6 +5810,7 @@ struct ClCreateImage2DRpcM {
     static constexpr uint16_t messageSubtype = 67;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_mem;
@@ -5836,7 +5905,7 @@ struct ClCreateImage2DRpcM {
             captures.image_format = *args.image_format;
         }
         if(args.host_ptr){
-            memcpy(asMemcpyDstT(captures.host_ptr), args.host_ptr, dynMemTraits.host_ptr.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.host_ptr), args.host_ptr, dynMemTraits.host_ptr.size);
         }
     }
 
@@ -5852,6 +5921,7 @@ struct ClCreateImage3DRpcM {
     static constexpr uint16_t messageSubtype = 68;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_mem;
@@ -5954,7 +6024,7 @@ struct ClCreateImage3DRpcM {
             captures.image_format = *args.image_format;
         }
         if(args.host_ptr){
-            memcpy(asMemcpyDstT(captures.host_ptr), args.host_ptr, dynMemTraits.host_ptr.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.host_ptr), args.host_ptr, dynMemTraits.host_ptr.size);
         }
     }
 
@@ -5970,6 +6040,7 @@ struct ClCreateSamplerRpcM {
     static constexpr uint16_t messageSubtype = 69;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_sampler;
@@ -6045,6 +6116,7 @@ struct ClCreateSamplerWithPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 70;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_sampler;
@@ -6115,7 +6187,7 @@ struct ClCreateSamplerWithPropertiesRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.properties){
-            memcpy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
         }
     }
 
@@ -6131,6 +6203,7 @@ struct ClCreateImageWithPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 71;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_mem;
@@ -6234,7 +6307,7 @@ struct ClCreateImageWithPropertiesRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.properties){
-            memcpy(asMemcpyDstT(captures.getProperties()), args.properties, dynMemTraits.properties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getProperties()), args.properties, dynMemTraits.properties.size);
         }
         if(args.image_format){
             captures.image_format = *args.image_format;
@@ -6243,7 +6316,7 @@ struct ClCreateImageWithPropertiesRpcM {
             captures.image_desc = *args.image_desc;
         }
         if(args.host_ptr){
-            memcpy(asMemcpyDstT(captures.getHost_ptr()), args.host_ptr, dynMemTraits.host_ptr.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getHost_ptr()), args.host_ptr, dynMemTraits.host_ptr.size);
         }
     }
 
@@ -6259,6 +6332,7 @@ struct ClCreateBufferWithPropertiesRpcM {
     static constexpr uint16_t messageSubtype = 72;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_mem;
@@ -6356,10 +6430,10 @@ struct ClCreateBufferWithPropertiesRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.properties){
-            memcpy(asMemcpyDstT(captures.getProperties()), args.properties, dynMemTraits.properties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getProperties()), args.properties, dynMemTraits.properties.size);
         }
         if(args.host_ptr){
-            memcpy(asMemcpyDstT(captures.getHost_ptr()), args.host_ptr, dynMemTraits.host_ptr.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getHost_ptr()), args.host_ptr, dynMemTraits.host_ptr.size);
         }
     }
 
@@ -6375,6 +6449,7 @@ struct ClGetSupportedImageFormatsRpcM {
     static constexpr uint16_t messageSubtype = 73;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -6457,7 +6532,7 @@ struct ClGetSupportedImageFormatsRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.image_formats){
-            memcpy(args.image_formats, captures.image_formats, dynMemTraits.image_formats.size);
+            Cal::Utils::TransferCopy::copy(args.image_formats, captures.image_formats, dynMemTraits.image_formats.size);
         }
         if(args.num_image_formats){
             *args.num_image_formats = captures.num_image_formats;
@@ -6469,7 +6544,8 @@ struct ClSetKernelArgRpcM {
     Cal::Rpc::RpcMessageHeader header;
     static constexpr uint16_t messageSubtype = 74;
     static constexpr float latency = 0.0;
-    static constexpr CallCategory category = CallCategory::Other;
+    static constexpr CallCategory category = CallCategory::Compute;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -6543,7 +6619,7 @@ struct ClSetKernelArgRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.arg_value){
-            memcpy(asMemcpyDstT(captures.arg_value), args.arg_value, dynMemTraits.arg_value.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.arg_value), args.arg_value, dynMemTraits.arg_value.size);
         }
     }
 };
@@ -6553,6 +6629,7 @@ struct ClSetProgramSpecializationConstantRpcM {
     static constexpr uint16_t messageSubtype = 75;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -6626,7 +6703,7 @@ struct ClSetProgramSpecializationConstantRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.spec_value){
-            memcpy(asMemcpyDstT(captures.spec_value), args.spec_value, dynMemTraits.spec_value.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.spec_value), args.spec_value, dynMemTraits.spec_value.size);
         }
     }
 };
@@ -6636,6 +6713,7 @@ struct ClEnqueueWriteBufferRpcM {
     static constexpr uint16_t messageSubtype = 76;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -6730,7 +6808,7 @@ struct ClEnqueueWriteBufferRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -6746,6 +6824,7 @@ struct ClEnqueueWriteBufferRectRpcM {
     static constexpr uint16_t messageSubtype = 77;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -6863,16 +6942,16 @@ struct ClEnqueueWriteBufferRectRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.buffer_origin){
-            memcpy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
         }
         if(args.host_origin){
-            memcpy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -6888,6 +6967,7 @@ struct ClEnqueueReadBufferRpcM {
     static constexpr uint16_t messageSubtype = 78;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -6982,7 +7062,7 @@ struct ClEnqueueReadBufferRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -6998,6 +7078,7 @@ struct ClEnqueueReadBufferRectRpcM {
     static constexpr uint16_t messageSubtype = 79;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -7115,16 +7196,16 @@ struct ClEnqueueReadBufferRectRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.buffer_origin){
-            memcpy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
         }
         if(args.host_origin){
-            memcpy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -7140,6 +7221,7 @@ struct ClEnqueueCopyBufferRpcM {
     static constexpr uint16_t messageSubtype = 80;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -7234,7 +7316,7 @@ struct ClEnqueueCopyBufferRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -7250,6 +7332,7 @@ struct ClEnqueueCopyBufferRectRpcM {
     static constexpr uint16_t messageSubtype = 81;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -7363,16 +7446,16 @@ struct ClEnqueueCopyBufferRectRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.src_origin){
-            memcpy(asMemcpyDstT(captures.src_origin), args.src_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.src_origin), args.src_origin, 3 * sizeof(size_t));
         }
         if(args.dst_origin){
-            memcpy(asMemcpyDstT(captures.dst_origin), args.dst_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.dst_origin), args.dst_origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -7388,6 +7471,7 @@ struct ClEnqueueReadImageRpcM {
     static constexpr uint16_t messageSubtype = 82;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -7492,13 +7576,13 @@ struct ClEnqueueReadImageRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.src_origin){
-            memcpy(asMemcpyDstT(captures.src_origin), args.src_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.src_origin), args.src_origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -7514,6 +7598,7 @@ struct ClEnqueueWriteImageRpcM {
     static constexpr uint16_t messageSubtype = 83;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -7618,13 +7703,13 @@ struct ClEnqueueWriteImageRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.origin){
-            memcpy(asMemcpyDstT(captures.origin), args.origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.origin), args.origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -7640,6 +7725,7 @@ struct ClEnqueueCopyImageRpcM {
     static constexpr uint16_t messageSubtype = 84;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -7737,16 +7823,16 @@ struct ClEnqueueCopyImageRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.src_origin){
-            memcpy(asMemcpyDstT(captures.src_origin), args.src_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.src_origin), args.src_origin, 3 * sizeof(size_t));
         }
         if(args.dst_origin){
-            memcpy(asMemcpyDstT(captures.dst_origin), args.dst_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.dst_origin), args.dst_origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -7762,6 +7848,7 @@ struct ClEnqueueCopyImageToBufferRpcM {
     static constexpr uint16_t messageSubtype = 85;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -7858,13 +7945,13 @@ struct ClEnqueueCopyImageToBufferRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.src_origin){
-            memcpy(asMemcpyDstT(captures.src_origin), args.src_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.src_origin), args.src_origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -7880,6 +7967,7 @@ struct ClEnqueueCopyBufferToImageRpcM {
     static constexpr uint16_t messageSubtype = 86;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -7976,13 +8064,13 @@ struct ClEnqueueCopyBufferToImageRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.dst_origin){
-            memcpy(asMemcpyDstT(captures.dst_origin), args.dst_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.dst_origin), args.dst_origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -7998,6 +8086,7 @@ struct ClEnqueueMapBufferRpcM {
     static constexpr uint16_t messageSubtype = 87;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = void*;
@@ -8097,7 +8186,7 @@ struct ClEnqueueMapBufferRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -8116,6 +8205,7 @@ struct ClEnqueueUnmapMemObjectRpcM {
     static constexpr uint16_t messageSubtype = 88;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -8198,7 +8288,7 @@ struct ClEnqueueUnmapMemObjectRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -8214,6 +8304,7 @@ struct ClEnqueueFillBufferRpcM {
     static constexpr uint16_t messageSubtype = 89;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -8323,10 +8414,10 @@ struct ClEnqueueFillBufferRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.pattern){
-            memcpy(asMemcpyDstT(captures.getPattern()), args.pattern, dynMemTraits.pattern.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPattern()), args.pattern, dynMemTraits.pattern.size);
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.getEvent_wait_list()), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getEvent_wait_list()), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -8342,6 +8433,7 @@ struct ClEnqueueFillImageRpcM {
     static constexpr uint16_t messageSubtype = 90;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -8435,16 +8527,16 @@ struct ClEnqueueFillImageRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.fill_color){
-            memcpy(asMemcpyDstT(captures.fill_color), args.fill_color, 16);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.fill_color), args.fill_color, 16);
         }
         if(args.origin){
-            memcpy(asMemcpyDstT(captures.origin), args.origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.origin), args.origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -8460,6 +8552,7 @@ struct ClWaitForEventsRpcM {
     static constexpr uint16_t messageSubtype = 91;
     static constexpr float latency = 2.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -8525,7 +8618,7 @@ struct ClWaitForEventsRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_list){
-            memcpy(asMemcpyDstT(captures.event_list), args.event_list, dynMemTraits.event_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_list), args.event_list, dynMemTraits.event_list.size);
         }
     }
 };
@@ -8535,6 +8628,7 @@ struct ClGetEventInfoRpcM {
     static constexpr uint16_t messageSubtype = 92;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -8613,7 +8707,7 @@ struct ClGetEventInfoRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -8626,6 +8720,7 @@ struct ClGetEventProfilingInfoRpcM {
     static constexpr uint16_t messageSubtype = 93;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -8704,7 +8799,7 @@ struct ClGetEventProfilingInfoRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -8717,6 +8812,7 @@ struct ClCreateUserEventRpcM {
     static constexpr uint16_t messageSubtype = 94;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_event;
@@ -8780,6 +8876,7 @@ struct ClSetUserEventStatusRpcM {
     static constexpr uint16_t messageSubtype = 95;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -8836,6 +8933,7 @@ struct ClSetEventCallbackRpcM {
     static constexpr uint16_t messageSubtype = 96;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -8900,6 +8998,7 @@ struct ClGetDeviceAndHostTimerRpcM {
     static constexpr uint16_t messageSubtype = 97;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -8971,6 +9070,7 @@ struct ClGetHostTimerRpcM {
     static constexpr uint16_t messageSubtype = 98;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -9040,6 +9140,7 @@ struct ClSVMAllocRpcM {
     static constexpr uint16_t messageSubtype = 99;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = void*;
@@ -9111,6 +9212,7 @@ struct ClSVMFreeRpcM {
     static constexpr uint16_t messageSubtype = 100;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = void;
@@ -9163,6 +9265,7 @@ struct ClEnqueueSVMMapRpcM {
     static constexpr uint16_t messageSubtype = 101;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -9253,7 +9356,7 @@ struct ClEnqueueSVMMapRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -9269,6 +9372,7 @@ struct ClEnqueueSVMUnmapRpcM {
     static constexpr uint16_t messageSubtype = 102;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -9347,7 +9451,7 @@ struct ClEnqueueSVMUnmapRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -9362,7 +9466,8 @@ struct ClSetKernelArgSVMPointerRpcM {
     Cal::Rpc::RpcMessageHeader header;
     static constexpr uint16_t messageSubtype = 103;
     static constexpr float latency = 0.0;
-    static constexpr CallCategory category = CallCategory::Other;
+    static constexpr CallCategory category = CallCategory::Compute;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -9422,7 +9527,8 @@ struct ClSetKernelExecInfoRpcM {
     Cal::Rpc::RpcMessageHeader header;
     static constexpr uint16_t messageSubtype = 104;
     static constexpr float latency = 0.0;
-    static constexpr CallCategory category = CallCategory::Other;
+    static constexpr CallCategory category = CallCategory::Compute;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -9496,7 +9602,7 @@ struct ClSetKernelExecInfoRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(asMemcpyDstT(captures.param_value), args.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.param_value), args.param_value, dynMemTraits.param_value.size);
         }
     }
 };
@@ -9506,6 +9612,7 @@ struct ClEnqueueSVMMemFillRpcM {
     static constexpr uint16_t messageSubtype = 105;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -9611,10 +9718,10 @@ struct ClEnqueueSVMMemFillRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.pattern){
-            memcpy(asMemcpyDstT(captures.getPattern()), args.pattern, dynMemTraits.pattern.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPattern()), args.pattern, dynMemTraits.pattern.size);
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.getEvent_wait_list()), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getEvent_wait_list()), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -9630,6 +9737,7 @@ struct ClEnqueueSVMMigrateMemRpcM {
     static constexpr uint16_t messageSubtype = 106;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -9745,13 +9853,13 @@ struct ClEnqueueSVMMigrateMemRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.svm_pointers){
-            memcpy(asMemcpyDstT(captures.getSvm_pointers()), args.svm_pointers, dynMemTraits.svm_pointers.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getSvm_pointers()), args.svm_pointers, dynMemTraits.svm_pointers.size);
         }
         if(args.sizes){
-            memcpy(asMemcpyDstT(captures.getSizes()), args.sizes, dynMemTraits.sizes.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getSizes()), args.sizes, dynMemTraits.sizes.size);
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.getEvent_wait_list()), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getEvent_wait_list()), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -9767,6 +9875,7 @@ struct ClEnqueueSVMMemcpyRpcM {
     static constexpr uint16_t messageSubtype = 107;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -9857,7 +9966,7 @@ struct ClEnqueueSVMMemcpyRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -9873,6 +9982,7 @@ struct ClEnqueueSVMFreeRpcM {
     static constexpr uint16_t messageSubtype = 108;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -9978,10 +10088,10 @@ struct ClEnqueueSVMFreeRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.svm_pointers){
-            memcpy(asMemcpyDstT(captures.getSvm_pointers()), args.svm_pointers, dynMemTraits.svm_pointers.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getSvm_pointers()), args.svm_pointers, dynMemTraits.svm_pointers.size);
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.getEvent_wait_list()), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getEvent_wait_list()), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -9997,6 +10107,7 @@ struct ClCreateSubDevicesEXTRpcM {
     static constexpr uint16_t messageSubtype = 109;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -10090,13 +10201,13 @@ struct ClCreateSubDevicesEXTRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.properties){
-            memcpy(asMemcpyDstT(captures.getProperties()), args.properties, dynMemTraits.properties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getProperties()), args.properties, dynMemTraits.properties.size);
         }
     }
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.out_devices){
-            memcpy(args.out_devices, captures.getOut_devices(), dynMemTraits.out_devices.size);
+            Cal::Utils::TransferCopy::copy(args.out_devices, captures.getOut_devices(), dynMemTraits.out_devices.size);
         }
         if(args.num_devices){
             *args.num_devices = captures.num_devices;
@@ -10109,6 +10220,7 @@ struct ClReleaseDeviceEXTRpcM {
     static constexpr uint16_t messageSubtype = 110;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -10161,6 +10273,7 @@ struct ClRetainDeviceEXTRpcM {
     static constexpr uint16_t messageSubtype = 111;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -10213,6 +10326,7 @@ struct ClGetKernelSubGroupInfoKHRRpcM {
     static constexpr uint16_t messageSubtype = 112;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -10318,13 +10432,13 @@ struct ClGetKernelSubGroupInfoKHRRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.input_value){
-            memcpy(asMemcpyDstT(captures.getInput_value()), args.input_value, dynMemTraits.input_value.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getInput_value()), args.input_value, dynMemTraits.input_value.size);
         }
     }
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.getParam_value(), dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.getParam_value(), dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -10337,6 +10451,7 @@ struct ClGetKernelSuggestedLocalWorkSizeKHRRpcM {
     static constexpr uint16_t messageSubtype = 113;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -10443,16 +10558,16 @@ struct ClGetKernelSuggestedLocalWorkSizeKHRRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.global_work_offset){
-            memcpy(asMemcpyDstT(captures.getGlobal_work_offset()), args.global_work_offset, dynMemTraits.global_work_offset.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getGlobal_work_offset()), args.global_work_offset, dynMemTraits.global_work_offset.size);
         }
         if(args.global_work_size){
-            memcpy(asMemcpyDstT(captures.getGlobal_work_size()), args.global_work_size, dynMemTraits.global_work_size.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getGlobal_work_size()), args.global_work_size, dynMemTraits.global_work_size.size);
         }
     }
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.suggested_local_work_size){
-            memcpy(args.suggested_local_work_size, captures.getSuggested_local_work_size(), dynMemTraits.suggested_local_work_size.size);
+            Cal::Utils::TransferCopy::copy(args.suggested_local_work_size, captures.getSuggested_local_work_size(), dynMemTraits.suggested_local_work_size.size);
         }
     }
 };
@@ -10462,6 +10577,7 @@ struct ClCreateCommandQueueWithPropertiesKHRRpcM {
     static constexpr uint16_t messageSubtype = 114;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_command_queue;
@@ -10536,7 +10652,7 @@ struct ClCreateCommandQueueWithPropertiesKHRRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.properties){
-            memcpy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
         }
     }
 
@@ -10552,6 +10668,7 @@ struct ClEnqueueMemFillINTELRpcM {
     static constexpr uint16_t messageSubtype = 115;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -10657,10 +10774,10 @@ struct ClEnqueueMemFillINTELRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.pattern){
-            memcpy(asMemcpyDstT(captures.getPattern()), args.pattern, dynMemTraits.pattern.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getPattern()), args.pattern, dynMemTraits.pattern.size);
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.getEvent_wait_list()), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.getEvent_wait_list()), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -10676,6 +10793,7 @@ struct ClEnqueueMemcpyINTELRpcM {
     static constexpr uint16_t messageSubtype = 116;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -10766,7 +10884,7 @@ struct ClEnqueueMemcpyINTELRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -10781,7 +10899,8 @@ struct ClSetKernelArgMemPointerINTELRpcM {
     Cal::Rpc::RpcMessageHeader header;
     static constexpr uint16_t messageSubtype = 117;
     static constexpr float latency = 0.0;
-    static constexpr CallCategory category = CallCategory::Other;
+    static constexpr CallCategory category = CallCategory::Compute;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -10842,6 +10961,7 @@ struct ClGetMemAllocInfoINTELRpcM {
     static constexpr uint16_t messageSubtype = 118;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -10924,7 +11044,7 @@ struct ClGetMemAllocInfoINTELRpcM {
 
     void copyToCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.param_value){
-            memcpy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
+            Cal::Utils::TransferCopy::copy(args.param_value, captures.param_value, dynMemTraits.param_value.size);
         }
         if(args.param_value_size_ret){
             *args.param_value_size_ret = captures.param_value_size_ret;
@@ -10937,6 +11057,7 @@ struct ClDeviceMemAllocINTELRpcM {
     static constexpr uint16_t messageSubtype = 119;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = void*;
@@ -11019,7 +11140,7 @@ struct ClDeviceMemAllocINTELRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.properties){
-            memcpy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
         }
     }
 
@@ -11041,6 +11162,7 @@ struct ClHostMemAllocINTELRpcM {
     static constexpr uint16_t messageSubtype = 120;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = void*;
@@ -11120,7 +11242,7 @@ struct ClHostMemAllocINTELRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits, const Cal::Rpc::Ocl::ClHostMemAllocINTELRpcMImplicitArgs &implicitArgs){
         if(args.properties){
-            memcpy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
         }
     }
 
@@ -11145,6 +11267,7 @@ struct ClSharedMemAllocINTELRpcM {
     static constexpr uint16_t messageSubtype = 121;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = void*;
@@ -11228,7 +11351,7 @@ struct ClSharedMemAllocINTELRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits, const Cal::Rpc::Ocl::ClSharedMemAllocINTELRpcMImplicitArgs &implicitArgs){
         if(args.properties){
-            memcpy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.properties), args.properties, dynMemTraits.properties.size);
         }
     }
 
@@ -11247,6 +11370,7 @@ struct ClMemFreeINTELRpcM {
     static constexpr uint16_t messageSubtype = 122;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -11303,6 +11427,7 @@ struct ClMemBlockingFreeINTELRpcM {
     static constexpr uint16_t messageSubtype = 123;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -11359,6 +11484,7 @@ struct ClEnqueueMigrateMemINTELRpcM {
     static constexpr uint16_t messageSubtype = 124;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -11445,7 +11571,7 @@ struct ClEnqueueMigrateMemINTELRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -11461,6 +11587,7 @@ struct ClEnqueueMemAdviseINTELRpcM {
     static constexpr uint16_t messageSubtype = 125;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -11547,7 +11674,7 @@ struct ClEnqueueMemAdviseINTELRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -11563,6 +11690,7 @@ struct ClGetDeviceGlobalVariablePointerINTELRpcM {
     static constexpr uint16_t messageSubtype = 126;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_int;
@@ -11642,7 +11770,7 @@ struct ClGetDeviceGlobalVariablePointerINTELRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.globalVariableName){
-            memcpy(asMemcpyDstT(captures.globalVariableName), args.globalVariableName, dynMemTraits.globalVariableName.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.globalVariableName), args.globalVariableName, dynMemTraits.globalVariableName.size);
         }
     }
 
@@ -11661,6 +11789,7 @@ struct ClCreateBufferRpcHelperNotUseHostPtrZeroCopyMallocShmem_UsmRpcM {
     static constexpr uint16_t messageSubtype = 127;
     static constexpr float latency = 1.0;
     static constexpr CallCategory category = CallCategory::Other;
+    static constexpr bool batchable = false;
 
 
     using ReturnValueT = cl_mem;
@@ -11736,6 +11865,7 @@ struct ClEnqueueWriteBuffer_LocalRpcM {
     static constexpr uint16_t messageSubtype = 128;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -11830,7 +11960,7 @@ struct ClEnqueueWriteBuffer_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -11846,6 +11976,7 @@ struct ClEnqueueWriteBuffer_UsmRpcM {
     static constexpr uint16_t messageSubtype = 129;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -11940,7 +12071,7 @@ struct ClEnqueueWriteBuffer_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -11956,6 +12087,7 @@ struct ClEnqueueWriteBuffer_SharedRpcM {
     static constexpr uint16_t messageSubtype = 130;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -12050,7 +12182,7 @@ struct ClEnqueueWriteBuffer_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -12066,6 +12198,7 @@ struct ClEnqueueWriteBufferRect_LocalRpcM {
     static constexpr uint16_t messageSubtype = 131;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -12183,16 +12316,16 @@ struct ClEnqueueWriteBufferRect_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.buffer_origin){
-            memcpy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
         }
         if(args.host_origin){
-            memcpy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -12208,6 +12341,7 @@ struct ClEnqueueWriteBufferRect_UsmRpcM {
     static constexpr uint16_t messageSubtype = 132;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -12325,16 +12459,16 @@ struct ClEnqueueWriteBufferRect_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.buffer_origin){
-            memcpy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
         }
         if(args.host_origin){
-            memcpy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -12350,6 +12484,7 @@ struct ClEnqueueWriteBufferRect_SharedRpcM {
     static constexpr uint16_t messageSubtype = 133;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -12467,16 +12602,16 @@ struct ClEnqueueWriteBufferRect_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.buffer_origin){
-            memcpy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
         }
         if(args.host_origin){
-            memcpy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -12492,6 +12627,7 @@ struct ClEnqueueReadBuffer_LocalRpcM {
     static constexpr uint16_t messageSubtype = 134;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -12586,7 +12722,7 @@ struct ClEnqueueReadBuffer_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -12602,6 +12738,7 @@ struct ClEnqueueReadBuffer_UsmRpcM {
     static constexpr uint16_t messageSubtype = 135;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -12696,7 +12833,7 @@ struct ClEnqueueReadBuffer_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -12712,6 +12849,7 @@ struct ClEnqueueReadBuffer_SharedRpcM {
     static constexpr uint16_t messageSubtype = 136;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -12806,7 +12944,7 @@ struct ClEnqueueReadBuffer_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -12822,6 +12960,7 @@ struct ClEnqueueReadBufferRect_LocalRpcM {
     static constexpr uint16_t messageSubtype = 137;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -12939,16 +13078,16 @@ struct ClEnqueueReadBufferRect_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.buffer_origin){
-            memcpy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
         }
         if(args.host_origin){
-            memcpy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -12964,6 +13103,7 @@ struct ClEnqueueReadBufferRect_UsmRpcM {
     static constexpr uint16_t messageSubtype = 138;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -13081,16 +13221,16 @@ struct ClEnqueueReadBufferRect_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.buffer_origin){
-            memcpy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
         }
         if(args.host_origin){
-            memcpy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -13106,6 +13246,7 @@ struct ClEnqueueReadBufferRect_SharedRpcM {
     static constexpr uint16_t messageSubtype = 139;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -13223,16 +13364,16 @@ struct ClEnqueueReadBufferRect_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.buffer_origin){
-            memcpy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.buffer_origin), args.buffer_origin, 3 * sizeof(size_t));
         }
         if(args.host_origin){
-            memcpy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.host_origin), args.host_origin, 3 * sizeof(size_t));
         }
         if(args.region){
-            memcpy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.region), args.region, 3 * sizeof(size_t));
         }
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -13248,6 +13389,7 @@ struct ClEnqueueSVMMemcpy_Local_LocalRpcM {
     static constexpr uint16_t messageSubtype = 140;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -13338,7 +13480,7 @@ struct ClEnqueueSVMMemcpy_Local_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -13354,6 +13496,7 @@ struct ClEnqueueSVMMemcpy_Local_UsmRpcM {
     static constexpr uint16_t messageSubtype = 141;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -13444,7 +13587,7 @@ struct ClEnqueueSVMMemcpy_Local_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -13460,6 +13603,7 @@ struct ClEnqueueSVMMemcpy_Local_SharedRpcM {
     static constexpr uint16_t messageSubtype = 142;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -13550,7 +13694,7 @@ struct ClEnqueueSVMMemcpy_Local_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -13566,6 +13710,7 @@ struct ClEnqueueSVMMemcpy_Usm_LocalRpcM {
     static constexpr uint16_t messageSubtype = 143;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -13656,7 +13801,7 @@ struct ClEnqueueSVMMemcpy_Usm_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -13672,6 +13817,7 @@ struct ClEnqueueSVMMemcpy_Usm_UsmRpcM {
     static constexpr uint16_t messageSubtype = 144;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -13762,7 +13908,7 @@ struct ClEnqueueSVMMemcpy_Usm_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -13778,6 +13924,7 @@ struct ClEnqueueSVMMemcpy_Usm_SharedRpcM {
     static constexpr uint16_t messageSubtype = 145;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -13868,7 +14015,7 @@ struct ClEnqueueSVMMemcpy_Usm_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -13884,6 +14031,7 @@ struct ClEnqueueSVMMemcpy_Shared_LocalRpcM {
     static constexpr uint16_t messageSubtype = 146;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -13974,7 +14122,7 @@ struct ClEnqueueSVMMemcpy_Shared_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -13990,6 +14138,7 @@ struct ClEnqueueSVMMemcpy_Shared_UsmRpcM {
     static constexpr uint16_t messageSubtype = 147;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -14080,7 +14229,7 @@ struct ClEnqueueSVMMemcpy_Shared_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -14096,6 +14245,7 @@ struct ClEnqueueSVMMemcpy_Shared_SharedRpcM {
     static constexpr uint16_t messageSubtype = 148;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -14186,7 +14336,7 @@ struct ClEnqueueSVMMemcpy_Shared_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -14202,6 +14352,7 @@ struct ClEnqueueMemcpyINTEL_Local_LocalRpcM {
     static constexpr uint16_t messageSubtype = 149;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -14292,7 +14443,7 @@ struct ClEnqueueMemcpyINTEL_Local_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -14308,6 +14459,7 @@ struct ClEnqueueMemcpyINTEL_Local_UsmRpcM {
     static constexpr uint16_t messageSubtype = 150;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -14398,7 +14550,7 @@ struct ClEnqueueMemcpyINTEL_Local_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -14414,6 +14566,7 @@ struct ClEnqueueMemcpyINTEL_Local_SharedRpcM {
     static constexpr uint16_t messageSubtype = 151;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -14504,7 +14657,7 @@ struct ClEnqueueMemcpyINTEL_Local_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -14520,6 +14673,7 @@ struct ClEnqueueMemcpyINTEL_Usm_LocalRpcM {
     static constexpr uint16_t messageSubtype = 152;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -14610,7 +14764,7 @@ struct ClEnqueueMemcpyINTEL_Usm_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -14626,6 +14780,7 @@ struct ClEnqueueMemcpyINTEL_Usm_UsmRpcM {
     static constexpr uint16_t messageSubtype = 153;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -14716,7 +14871,7 @@ struct ClEnqueueMemcpyINTEL_Usm_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -14732,6 +14887,7 @@ struct ClEnqueueMemcpyINTEL_Usm_SharedRpcM {
     static constexpr uint16_t messageSubtype = 154;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -14822,7 +14978,7 @@ struct ClEnqueueMemcpyINTEL_Usm_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -14838,6 +14994,7 @@ struct ClEnqueueMemcpyINTEL_Shared_LocalRpcM {
     static constexpr uint16_t messageSubtype = 155;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -14928,7 +15085,7 @@ struct ClEnqueueMemcpyINTEL_Shared_LocalRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -14944,6 +15101,7 @@ struct ClEnqueueMemcpyINTEL_Shared_UsmRpcM {
     static constexpr uint16_t messageSubtype = 156;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -15034,7 +15192,7 @@ struct ClEnqueueMemcpyINTEL_Shared_UsmRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
@@ -15050,6 +15208,7 @@ struct ClEnqueueMemcpyINTEL_Shared_SharedRpcM {
     static constexpr uint16_t messageSubtype = 157;
     static constexpr float latency = 0.0;
     static constexpr CallCategory category = CallCategory::Copy;
+    static constexpr bool batchable = true;
 
 
     using ReturnValueT = cl_int;
@@ -15140,7 +15299,7 @@ struct ClEnqueueMemcpyINTEL_Shared_SharedRpcM {
 
     void copyFromCaller(const Captures::DynamicTraits &dynMemTraits){
         if(args.event_wait_list){
-            memcpy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
+            Cal::Utils::TransferCopy::copy(asMemcpyDstT(captures.event_wait_list), args.event_wait_list, dynMemTraits.event_wait_list.size);
         }
     }
 
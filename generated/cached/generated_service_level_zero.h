@@ -2083,20 +2083,7 @@ inline bool zeModuleInspectLinkageExtHandler(Provider &service, Cal::Rpc::Channe
     return true;
 }
 bool zeMemAllocSharedHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader*command, size_t commandMaxSize);
-inline bool zeMemAllocDeviceHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader*command, size_t commandMaxSize) {
-    log<Verbosity::bloat>("Servicing RPC request for zeMemAllocDevice");
-    auto apiCommand = reinterpret_cast<Cal::Rpc::LevelZero::ZeMemAllocDeviceRpcM*>(command);
-    apiCommand->captures.reassembleNestedStructs();
-    apiCommand->captures.ret = Cal::Service::Apis::LevelZero::Standard::zeMemAllocDevice(
-                                                apiCommand->args.hContext, 
-                                                apiCommand->args.device_desc ? &apiCommand->captures.device_desc : nullptr, 
-                                                apiCommand->args.size, 
-                                                apiCommand->args.alignment, 
-                                                apiCommand->args.hDevice, 
-                                                apiCommand->args.pptr ? &apiCommand->captures.pptr : nullptr
-                                                );
-    return true;
-}
+bool zeMemAllocDeviceHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader*command, size_t commandMaxSize);
 bool zeMemAllocHostHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader*command, size_t commandMaxSize);
 bool zeMemFreeHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader*command, size_t commandMaxSize);
 inline bool zeMemGetAllocPropertiesHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader*command, size_t commandMaxSize) {
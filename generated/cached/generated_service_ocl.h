@@ -1409,19 +1409,7 @@ inline bool clGetMemAllocInfoINTELHandler(Provider &service, Cal::Rpc::ChannelSe
                                                 );
     return true;
 }
-inline bool clDeviceMemAllocINTELHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader*command, size_t commandMaxSize) {
-    log<Verbosity::bloat>("Servicing RPC request for clDeviceMemAllocINTEL");
-    auto apiCommand = reinterpret_cast<Cal::Rpc::Ocl::ClDeviceMemAllocINTELRpcM*>(command);
-    apiCommand->captures.ret = Cal::Service::Apis::Ocl::Extensions::clDeviceMemAllocINTEL(
-                                                apiCommand->args.context, 
-                                                apiCommand->args.device, 
-                                                apiCommand->args.properties ? apiCommand->captures.properties : nullptr, 
-                                                apiCommand->args.size, 
-                                                apiCommand->args.alignment, 
-                                                apiCommand->args.errcode_ret ? &apiCommand->captures.errcode_ret : nullptr
-                                                );
-    return true;
-}
+bool clDeviceMemAllocINTELHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader*command, size_t commandMaxSize);
 bool clHostMemAllocINTELHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader*command, size_t commandMaxSize);
 bool clSharedMemAllocINTELHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader*command, size_t commandMaxSize);
 bool clMemFreeINTELHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader*command, size_t commandMaxSize);
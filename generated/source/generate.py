@@ -1313,7 +1313,10 @@ class Function:
         self.name = src["name"]
         self.latency = float(src.get("latency", 0.0))
         self.category = src.get("category", "Other")
+        assert self.category in ["Other", "Compute", "Copy"], f"{self.name} : unknown category {self.category}"
         self.callAsync = bool(src.get("call_async", 0))
+        # asynchronous calls of copy and compute categories can be batched on client side (see CAL_BATCHED_CALLS)
+        self.batchable = self.callAsync and self.category in ["Compute", "Copy"]
         self.returns = Returns(src.get("returns", {}))
         args_src = src.get("args", {})
         implicit_args_src = src.get("implicit_args", {})
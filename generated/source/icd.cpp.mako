@@ -7,6 +7,7 @@
 
 #include "client/icd/icd_global_state.h"
 #include "shared/rpc.h"
+#include "shared/transfer_copy.h"
 #include "shared/utils.h"
 
 % for header in file_headers:
@@ -138,7 +139,7 @@ ${r.destination.name}(${func_base.get_call_params_list_str()});
 %           if not arg.capture_details.reclaim_method.is_immediate_mode():
         ${arg.capture_details.reclaim_method.format(f"standalone_{arg.name}")};
 %       if arg.kind_details.server_access.can_read():
-        memcpy(Cal::Utils::toAddress(standalone_${arg.name}), ${arg.name}, ${arg.get_calculated_array_size()});
+        Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standalone_${arg.name}), ${arg.name}, ${arg.get_calculated_array_size()});
 %       endif # arg.kind_details.server_access.can_read()
     }
 %           endif
@@ -161,7 +162,7 @@ ${r.destination.name}(${func_base.get_call_params_list_str()});
 %        endif
 %       if config.api_name == "ocl":
 %        if arg.kind_details.server_access.can_read():
-    memcpy(Cal::Utils::toAddress(standalone_${arg.name}), ${arg.name}, ${arg.get_calculated_array_size()});
+    Cal::Utils::TransferCopy::copy(Cal::Utils::toAddress(standalone_${arg.name}), ${arg.name}, ${arg.get_calculated_array_size()});
 %        endif # arg.kind_details.server_access.can_read()
 %       endif # config.api_name == "ocl"
 %      endfor # arg in func_base.traits.get_standalone_args()
@@ -294,7 +295,7 @@ ${r.destination.name}(${func_base.get_call_params_list_str()});
 %       endif # func_base.traits.emit_copy_to_caller
 %       for arg in func_base.traits.get_standalone_args():
 %        if arg.kind_details.server_access.can_write() and config.api_name == "ocl" and arg.capture_details.mode.is_staging_usm_mode():
-    memcpy(${arg.name}, standalone_${arg.name}, ${arg.get_calculated_array_size()});
+    Cal::Utils::TransferCopy::copy(${arg.name}, standalone_${arg.name}, ${arg.get_calculated_array_size()});
 %        endif # arg.kind_details.server_access.can_write()
 %       endfor # arg in func_base.traits.get_standalone_args():
 %       for arg in get_args_requiring_translation_after(func_base):
@@ -7,6 +7,7 @@
 
 #include "shared/rpc_message.h"
 #include "shared/shmem_transfer_desc.h"
+#include "shared/transfer_copy.h"
 
 % for header in file_headers:
 ${header}
@@ -63,6 +64,7 @@ struct ${func.message_name} {
     static constexpr uint16_t messageSubtype = ${get_message_subtype(func)};
     static constexpr float latency = ${func.latency};
     static constexpr CallCategory category = CallCategory::${func.category};
+    static constexpr bool batchable = ${"true" if func.batchable else "false"};
 
 
     using ReturnValueT = ${func.returns.type.str};
@@ -126,7 +128,7 @@ ${func.capture_layout.generate_h()}
 %       elif not arg.traits.uses_nested_capture:
 <%      dst = f"captures.{CapturesFormater.f_arg_getter_name(arg)}()" if arg.traits.uses_dynamic_arg_getter else f"captures.{arg.name}"%>\
 <%      arg_size = f"dynMemTraits.{arg.name}.size" if arg.traits.uses_inline_dynamic_mem else arg.get_calculated_array_size('args.')%>\
-        ${i}memcpy(asMemcpyDstT(${dst}), args.${arg.name}, ${arg_size});
+        ${i}Cal::Utils::TransferCopy::copy(asMemcpyDstT(${dst}), args.${arg.name}, ${arg_size});
 %       else:
         ${i}{
         ${i}     auto array = captures.${CapturesFormater.f_arg_getter_name(arg)}();
@@ -186,7 +188,7 @@ ${member_layout.create_copy_from_caller("currentOffset", member_layout_formatter
 <%      assert arg.traits.uses_nested_capture == False %>\
 <%      src = f"captures.{CapturesFormater.f_arg_getter_name(arg)}()" if arg.traits.uses_dynamic_arg_getter else f"captures.{arg.name}" %>\
 <%      arg_size = f"dynMemTraits.{arg.name}.size" if arg.traits.uses_inline_dynamic_mem else arg.get_calculated_array_size('args.')%>\
-            memcpy(args.${arg.name}, ${src}, ${arg_size});
+            Cal::Utils::TransferCopy::copy(args.${arg.name}, ${src}, ${arg_size});
 %       endif # not arg.kind_details.num_elements.is_single_element():
 %       if arg.kind_details.can_be_null:
         }
@@ -25,6 +25,14 @@ inline constexpr std::string_view calEnableL0InCalrunEnvName = "CAL_ENABLE_L0_IN
 inline constexpr std::string_view calEnableOclInCalrunEnvName = "CAL_ENABLE_OCL_IN_CALRUN";
 // Controls whether CAL should redirect L0 directly to the GPU driver
 inline constexpr std::string_view calRedirectL0EnvName = "CAL_REDIRECT_L0";
+// Controls whether service should collect per-API statistics of clients in shared memory (readable with calstat), enabled by default
+inline constexpr std::string_view calEnableStatsEnvName = "CAL_ENABLE_STATS";
+// Controls whether service should keep native binaries of compiled L0 modules in on-disk cache (persistent between service runs), enabled by default
+inline constexpr std::string_view calEnableModuleDiskCacheEnvName = "CAL_ENABLE_MODULE_DISK_CACHE";
+// Sets directory of on-disk module cache (default is $XDG_CACHE_HOME/compute_aggregation_layer/module_cache or ~/.cache/compute_aggregation_layer/module_cache)
+inline constexpr std::string_view calModuleDiskCacheDirEnvName = "CAL_MODULE_DISK_CACHE_DIR";
+// Sets size limit (in MB) of on-disk module cache - least recently used binaries are evicted above that limit (default is 1024)
+inline constexpr std::string_view calModuleDiskCacheMaxSizeEnvName = "CAL_MODULE_DISK_CACHE_MAX_SIZE_MB";
 
 // Controls whether CAL should override chosen command queue gruop indices
 inline constexpr std::string_view calUseComputeRoundRobin = "CAL_USE_COMPUTE_ROUND_ROBIN";
@@ -32,12 +40,16 @@ inline constexpr std::string_view calUseCopyRoundRobin = "CAL_USE_COPY_ROUND_ROB
 
 // Controls whether CAL should make pageable memory copies blocking instead of using event manager
 inline constexpr std::string_view calSyncMallocCopy = "CAL_SYNC_MALLOC_COPY";
+// Controls whether regular command lists should transfer only pages of user's stack/heap modified since their previous execution (requires kernel with soft-dirty bits support)
+inline constexpr std::string_view calL0TrackDirtyPagesEnvName = "CAL_L0_TRACK_DIRTY_PAGES";
 
 // Controls whether some API calls should cache their results for faster access
 inline constexpr std::string_view calIcdEnableCacheEnvName = "CAL_ICD_ENABLE_CACHE";
 inline constexpr std::string_view calEnableAilEnvName = "CAL_USE_AIL";
 // Controls whether CAL should use shared allocations
 inline constexpr std::string_view calSharedAllocations = "CAL_SHARED_ALLOCATIONS";
+// Sets size (in KB) of chunks in which shared allocations migrate between host and device on page faults (default is 64, rounded up to page size)
+inline constexpr std::string_view calSharedAllocationsMigrationChunkSizeEnvName = "CAL_SHARED_ALLOCATIONS_MIGRATION_CHUNK_SIZE_KB";
 // Controls whether CAL should attempt to print call stack when unhandled page fault occurs (requires CAL_SHARED_ALLOCATIONS to be enabled)
 inline constexpr std::string_view calDumpStackOnUnhandledPagefault = "CAL_DUMP_STACK_ON_UNHANDLED_PAGE_FAULT";
 // Controls whether threads should yield control while waiting for connection
@@ -50,10 +62,20 @@ inline constexpr std::string_view calAsynchronousCalls = "CAL_ASYNC_CALLS";
 inline constexpr std::string_view calBatchedCalls = "CAL_BATCHED_CALLS";
 // Contoles whether CAL should execute batched calls under lock
 inline constexpr std::string_view calBatchedService = "CAL_BATCHED_SERVICE";
+// Sets number of service threads that share servicing of all RPC channels (default is 0 - dedicated thread per RPC channel)
+inline constexpr std::string_view calServiceWorkersCountEnvName = "CAL_SERVICE_WORKERS_COUNT";
+// Sets cpus that service workers are bound to, in taskset format e.g. "0,2,4-7" (used only with CAL_SERVICE_WORKERS_COUNT)
+inline constexpr std::string_view calServiceWorkersCpuAffinityEnvName = "CAL_SERVICE_WORKERS_CPU_AFFINITY";
+// Controls max number of API calls that can be gathered in a single batch before publishing it to the service
+inline constexpr std::string_view calBatchedCallsMaxCountEnvName = "CAL_BATCHED_CALLS_MAX_COUNT";
+// Controls max age (in microseconds) of a batch - checked whenever new API call is added to the batch
+inline constexpr std::string_view calBatchedCallsMaxAgeUsEnvName = "CAL_BATCHED_CALLS_MAX_AGE_US";
 // Set default RPC channel size (in MB)
 inline constexpr std::string_view calDefaultRpcChannelSizeEnvName = "CAL_DEFAULT_RPC_CHANNEL_SIZE_MB";
 // Set RPC ring size in pages (default is <= 1)
 inline constexpr std::string_view calRpcRingPagesEnvName = "CAL_RPC_RING_SIZE_PAGES";
+// Set maximum number of RPC channels per client - client threads are bound to separate channels until this limit is reached (default is 1)
+inline constexpr std::string_view calRpcChannelsCountEnvName = "CAL_RPC_CHANNELS_COUNT";
 // Set default shared VA window size per client (in GB)
 inline constexpr std::string_view calDefaultSharedVaSizeEnvName = "CAL_DEFAULT_SHARED_VA_SIZE_GB";
 // Allocate RPC channel within shared VA window
@@ -79,8 +101,38 @@ inline constexpr std::string_view calUseSemaphoresInChannelServerEnvName = "CAL_
 // Controls whether CAL should use semaphores as a client synchronization method
 inline constexpr std::string_view calUseSemaphoresInChannelClientEnvName = "CAL_USE_SEMAPHORES_IN_CHANNEL_CLIENT";
 inline constexpr std::string_view calUseSemaphoresThresholdInChannelClientEnvName = "CAL_USE_SEMAPHORES_THRESHOLD_IN_CHANNEL_CLIENT";
+// Controls whether CAL service should spin and then sleep on futex (instead of semaphores) when waiting for new RPC calls
+inline constexpr std::string_view calUseFutexInChannelServerEnvName = "CAL_USE_FUTEX_IN_CHANNEL_SERVER";
+// Controls whether CAL client should spin and then sleep on futex when waiting for RPC call completion
+inline constexpr std::string_view calUseFutexInChannelClientEnvName = "CAL_USE_FUTEX_IN_CHANNEL_CLIENT";
 
 inline constexpr std::string_view calEarlyShmUnlinkEnvName = "CAL_EARLY_SHM_UNLINK";
+// Controls whether CAL service should create shmems as anonymous memfd files passed to clients over the control socket (instead of named /dev/shm files)
+inline constexpr std::string_view calUseMemfdShmemEnvName = "CAL_USE_MEMFD_SHMEM";
+// Controls whether CAL service should back memory arenas, RPC channels and large USM allocations with hugepages (explicit hugetlb pages with memfd shmems, transparent hugepages otherwise)
+inline constexpr std::string_view calShmemHugePagesEnvName = "CAL_SHMEM_HUGEPAGES";
+// Sets max size (in MB) of unused shmem mappings that client keeps for reuse in memory transfers (default is 256, 0 disables the cache)
+inline constexpr std::string_view calShmemMappingsCacheSizeEnvName = "CAL_SHMEM_MAPPINGS_CACHE_SIZE_MB";
+// Sets number of helper threads that take part in large memory transfers between client and service (default is 2, 0 disables parallel copies)
+inline constexpr std::string_view calParallelCopyHelpersEnvName = "CAL_PARALLEL_COPY_HELPERS";
+// Sets size (in bytes) from which memory transfers between client and service are copied with non-temporal stores (default is 1048576, 0 disables non-temporal copies)
+inline constexpr std::string_view calTransferCopyStreamingThresholdEnvName = "CAL_TRANSFER_COPY_STREAMING_THRESHOLD";
+// Controls whether CAL service should copy client's hostptr memory directly from/to client process (with process_vm_readv/process_vm_writev) instead of client copying it through shmems (default is 0)
+inline constexpr std::string_view calDirectTransfersEnvName = "CAL_DIRECT_TRANSFERS";
+// Sets max number of spare shmem files the service keeps per size class (default is 0 - shmem files pool is disabled)
+inline constexpr std::string_view calShmemPoolHighWatermarkEnvName = "CAL_SHMEM_POOL_HIGH_WATERMARK";
+// Sets number of spare shmem files below which the service starts creating new ones in background (default is half of high watermark)
+inline constexpr std::string_view calShmemPoolLowWatermarkEnvName = "CAL_SHMEM_POOL_LOW_WATERMARK";
+// Controls whether pages of pooled shmem files are allocated ahead of time (default is 1)
+inline constexpr std::string_view calShmemPoolPrefaultEnvName = "CAL_SHMEM_POOL_PREFAULT";
+// Sets per-client quotas (in MB) above which service reports client's memory usage, e.g. "device=4096,host=1024,shared=1024,shmem=512,shared_va=2048" (default : no quotas)
+inline constexpr std::string_view calClientMemorySoftQuotasEnvName = "CAL_CLIENT_MEMORY_SOFT_QUOTAS_MB";
+// Sets per-client quotas (in MB) above which service rejects client's allocations (same format as soft quotas, default : no quotas)
+inline constexpr std::string_view calClientMemoryHardQuotasEnvName = "CAL_CLIENT_MEMORY_HARD_QUOTAS_MB";
+// Sets time (in milliseconds) after which unused pooled memory (recycled arenas, staging areas, recycled cl_mem buffers) is returned to the system (default is 30000, 0 disables trimming)
+inline constexpr std::string_view calIdleTrimTimeoutEnvName = "CAL_IDLE_TRIM_TIMEOUT_MS";
+// Sets number of most recently used idle entries that every pool keeps resident regardless of idle timeout (default is 2)
+inline constexpr std::string_view calIdleTrimLowWatermarkEnvName = "CAL_IDLE_TRIM_LOW_WATERMARK";
 
 // Debug
 // Sets required logging verbosity. Available levels: [performance, silent, critical, error, info, debug, bloat]. Warning: bloat verbosity requires CAL to be built with ENABLE_BLOATED_VERBOSITY=1 cmake option
@@ -123,4 +175,24 @@ inline constexpr std::string_view calReleaseModeEnvs[] = {
     calAsynchronousCalls,
     calUseCustomOCLPlatformName,
     calRedirectL0EnvName,
+    calEnableStatsEnvName,
+    calEnableModuleDiskCacheEnvName,
+    calModuleDiskCacheDirEnvName,
+    calModuleDiskCacheMaxSizeEnvName,
+    calServiceWorkersCountEnvName,
+    calServiceWorkersCpuAffinityEnvName,
+    calL0TrackDirtyPagesEnvName,
+    calShmemMappingsCacheSizeEnvName,
+    calParallelCopyHelpersEnvName,
+    calTransferCopyStreamingThresholdEnvName,
+    calDirectTransfersEnvName,
+    calShmemPoolHighWatermarkEnvName,
+    calShmemPoolLowWatermarkEnvName,
+    calShmemPoolPrefaultEnvName,
+    calClientMemorySoftQuotasEnvName,
+    calClientMemoryHardQuotasEnvName,
+    calIdleTrimTimeoutEnvName,
+    calIdleTrimLowWatermarkEnvName,
+    calUseMemfdShmemEnvName,
+    calShmemHugePagesEnvName,
     calListenerSocketPathEnvName};
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/log.h"
+#include "shared/stats.h"
+#include "shared/utils.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace Cal::Service {
+
+using MemoryKind = Cal::Stats::MemoryKind;
+
+struct ClientMemoryQuotas {
+    using QuotasT = std::array<uint64_t, Cal::Stats::memoryKindsCount>; // in bytes, 0 means no quota
+
+    QuotasT soft = {};
+    QuotasT hard = {};
+
+    // parses list of per-kind quotas in MB (e.g. "device=4096,shmem=512"), kinds are named as in calstat
+    static std::optional<QuotasT> parse(const char *list) {
+        QuotasT ret = {};
+        if (nullptr == list) {
+            return ret;
+        }
+        for (const auto &entry : Cal::Utils::split(list, ",")) {
+            if (entry.empty()) {
+                continue;
+            }
+            auto keyValue = Cal::Utils::split(entry, "=");
+            if ((keyValue.size() != 2) || (false == isNumber(keyValue[1]))) {
+                return std::nullopt;
+            }
+            auto kind = Cal::Stats::getMemoryKindByName(keyValue[0].c_str());
+            if (false == kind.has_value()) {
+                return std::nullopt;
+            }
+            ret[kind.value()] = std::stoull(keyValue[1]) * Cal::Utils::MB;
+        }
+        return ret;
+    }
+
+  protected:
+    static bool isNumber(const std::string &str) {
+        return (false == str.empty()) && std::all_of(str.begin(), str.end(), [](unsigned char c) { return std::isdigit(c); });
+    }
+};
+
+// Accounts memory that service allocated on behalf of a single client and enforces client's quotas.
+// Allocations coming from shared VA heaps are charged both to their own kind and to shared VA.
+// Crossing soft quota is only reported, allocations that would cross hard quota are rejected.
+class ClientMemoryUsage {
+  public:
+    void setQuotas(const ClientMemoryQuotas &quotas) {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->quotas = quotas;
+        for (uint32_t kind = 0; kind < Cal::Stats::memoryKindsCount; ++kind) {
+            publish(static_cast<MemoryKind>(kind));
+        }
+    }
+
+    // usage is mirrored into client's stats page (if any), so that it can be queried with calstat
+    void setStats(Cal::Stats::MemoryUsageStats *stats) {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->stats = stats;
+        for (uint32_t kind = 0; kind < Cal::Stats::memoryKindsCount; ++kind) {
+            publish(static_cast<MemoryKind>(kind));
+        }
+    }
+
+    bool tryCharge(MemoryKind kind, uint64_t size, bool fromSharedVa) {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::optional<MemoryKind> rejectedKind;
+        if (wouldExceedHardQuota(kind, size)) {
+            rejectedKind = kind;
+        } else if (fromSharedVa && wouldExceedHardQuota(MemoryKind::sharedVa, size)) {
+            rejectedKind = MemoryKind::sharedVa;
+        }
+        if (rejectedKind.has_value()) {
+            ++rejectedAllocations[*rejectedKind];
+            publish(*rejectedKind);
+            log<Verbosity::error>("Rejecting allocation of %llu bytes of %s memory - client would exceed its hard quota (in use : %llu, quota : %llu)",
+                                  static_cast<unsigned long long>(size), Cal::Stats::memoryKindNames[*rejectedKind],
+                                  static_cast<unsigned long long>(bytesInUse[*rejectedKind]), static_cast<unsigned long long>(quotas.hard[*rejectedKind]));
+            return false;
+        }
+        charge(kind, size);
+        if (fromSharedVa) {
+            charge(MemoryKind::sharedVa, size);
+        }
+        return true;
+    }
+
+    void release(MemoryKind kind, uint64_t size, bool fromSharedVa) {
+        std::lock_guard<std::mutex> lock(mutex);
+        uncharge(kind, size);
+        if (fromSharedVa) {
+            uncharge(MemoryKind::sharedVa, size);
+        }
+    }
+
+    // remembers charge of allocation, so that it can be released when client frees it
+    void trackAllocation(const void *ptr, MemoryKind kind, uint64_t size, bool fromSharedVa) {
+        std::lock_guard<std::mutex> lock(mutex);
+        allocations[ptr] = TrackedAllocation{kind, size, fromSharedVa};
+    }
+
+    void releaseAllocation(const void *ptr) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = allocations.find(ptr);
+        if (it == allocations.end()) {
+            return;
+        }
+        uncharge(it->second.kind, it->second.size);
+        if (it->second.fromSharedVa) {
+            uncharge(MemoryKind::sharedVa, it->second.size);
+        }
+        allocations.erase(it);
+    }
+
+    uint64_t getBytesInUse(MemoryKind kind) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return bytesInUse[kind];
+    }
+
+    uint64_t getPeakBytesInUse(MemoryKind kind) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return peakBytesInUse[kind];
+    }
+
+    uint64_t getRejectedAllocationsCount(MemoryKind kind) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return rejectedAllocations[kind];
+    }
+
+  protected:
+    struct TrackedAllocation {
+        MemoryKind kind = MemoryKind::device;
+        uint64_t size = 0U;
+        bool fromSharedVa = false;
+    };
+
+    bool wouldExceedHardQuota(MemoryKind kind, uint64_t size) const {
+        return (0U != quotas.hard[kind]) && (bytesInUse[kind] + size > quotas.hard[kind]);
+    }
+
+    void charge(MemoryKind kind, uint64_t size) {
+        auto prevBytesInUse = bytesInUse[kind];
+        bytesInUse[kind] += size;
+        peakBytesInUse[kind] = std::max(peakBytesInUse[kind], bytesInUse[kind]);
+        auto softQuota = quotas.soft[kind];
+        if ((0U != softQuota) && (prevBytesInUse <= softQuota) && (bytesInUse[kind] > softQuota)) {
+            log<Verbosity::warning>("Client exceeded its soft quota of %s memory (in use : %llu, quota : %llu)", Cal::Stats::memoryKindNames[kind],
+                                    static_cast<unsigned long long>(bytesInUse[kind]), static_cast<unsigned long long>(softQuota));
+        }
+        publish(kind);
+    }
+
+    void uncharge(MemoryKind kind, uint64_t size) {
+        bytesInUse[kind] -= std::min(size, bytesInUse[kind]);
+        publish(kind);
+    }
+
+    void publish(MemoryKind kind) {
+        if (nullptr == stats) {
+            return;
+        }
+        stats->bytesInUse[kind].store(bytesInUse[kind], std::memory_order_relaxed);
+        stats->peakBytesInUse[kind].store(peakBytesInUse[kind], std::memory_order_relaxed);
+        stats->softQuota[kind].store(quotas.soft[kind], std::memory_order_relaxed);
+        stats->hardQuota[kind].store(quotas.hard[kind], std::memory_order_relaxed);
+        stats->rejectedAllocations[kind].store(rejectedAllocations[kind], std::memory_order_relaxed);
+    }
+
+    std::mutex mutex; // client's RPC channels are serviced concurrently
+    ClientMemoryQuotas quotas;
+    std::array<uint64_t, Cal::Stats::memoryKindsCount> bytesInUse = {};
+    std::array<uint64_t, Cal::Stats::memoryKindsCount> peakBytesInUse = {};
+    std::array<uint64_t, Cal::Stats::memoryKindsCount> rejectedAllocations = {};
+    std::unordered_map<const void *, TrackedAllocation> allocations;
+    Cal::Stats::MemoryUsageStats *stats = nullptr;
+};
+
+} // namespace Cal::Service
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/log.h"
+#include "shared/sys.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <vector>
+
+namespace Cal::Service {
+
+// Copies client's hostptr memory directly between client process and shmems mapped in service (with
+// process_vm_readv/process_vm_writev), so that client doesn't need to stage it through shmems on its own.
+// Requires ptrace access to the client - once it's denied, transfers get disabled and callers fall back
+// to copies through shmems.
+class DirectTransfers {
+  public:
+    struct CopyDesc {
+        void *serviceAddress = nullptr;
+        uintptr_t clientAddress = 0U;
+        size_t size = 0U;
+    };
+
+    void enable(pid_t clientPid) {
+        this->clientPid = clientPid;
+        this->enabled = (0 != clientPid);
+    }
+
+    bool isEnabled() const {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    // returns number of leading copies that were fully transferred
+    size_t readFromClient(const std::vector<CopyDesc> &copies) {
+        return transfer(copies, false);
+    }
+
+    size_t writeToClient(const std::vector<CopyDesc> &copies) {
+        return transfer(copies, true);
+    }
+
+  protected:
+    size_t transfer(const std::vector<CopyDesc> &copies, bool toClient) {
+        if (false == isEnabled()) {
+            return 0U;
+        }
+
+        std::vector<iovec> serviceIov;
+        std::vector<iovec> clientIov;
+        size_t transferredCount = 0U;
+        while (transferredCount < copies.size()) {
+            auto batchSize = std::min<size_t>(IOV_MAX, copies.size() - transferredCount);
+            serviceIov.clear();
+            clientIov.clear();
+            for (size_t i = transferredCount; i < transferredCount + batchSize; ++i) {
+                serviceIov.push_back({copies[i].serviceAddress, copies[i].size});
+                clientIov.push_back({reinterpret_cast<void *>(copies[i].clientAddress), copies[i].size});
+            }
+
+            auto transferred = toClient ? Cal::Sys::process_vm_writev(clientPid, serviceIov.data(), batchSize, clientIov.data(), batchSize, 0)
+                                        : Cal::Sys::process_vm_readv(clientPid, serviceIov.data(), batchSize, clientIov.data(), batchSize, 0);
+            if (transferred < 0) {
+                if ((EPERM == errno) || (ESRCH == errno) || (ENOSYS == errno)) {
+                    log<Verbosity::info>("Direct memory transfers with client (pid : %d) are not permitted - falling back to transfers through shmem", static_cast<int>(clientPid));
+                    enabled = false;
+                } else {
+                    log<Verbosity::debug>("Direct memory transfer with client (pid : %d) failed (errno : %d) - falling back to transfers through shmem", static_cast<int>(clientPid), errno);
+                }
+                return transferredCount;
+            }
+
+            // partial transfers never split a single iovec element
+            auto bytesLeft = static_cast<size_t>(transferred);
+            auto batchEnd = transferredCount + batchSize;
+            while ((transferredCount < batchEnd) && (copies[transferredCount].size <= bytesLeft)) {
+                bytesLeft -= copies[transferredCount].size;
+                ++transferredCount;
+            }
+            if (transferredCount < batchEnd) {
+                log<Verbosity::debug>("Direct memory transfer with client (pid : %d) was partial - falling back to transfers through shmem", static_cast<int>(clientPid));
+                return transferredCount;
+            }
+        }
+        return transferredCount;
+    }
+
+    pid_t clientPid = 0;
+    std::atomic_bool enabled = false;
+};
+
+} // namespace Cal::Service
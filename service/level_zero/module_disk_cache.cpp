@@ -0,0 +1,298 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "service/level_zero/module_disk_cache.h"
+
+#include "generated_service_level_zero.h"
+#include "service/level_zero/l0_shared_objects.h"
+#include "shared/log.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace Cal::Service::LevelZero {
+
+namespace {
+
+constexpr uint64_t secondaryKeySeed = 0x6a09e667f3bcc908ULL;
+
+struct KeyHasher {
+    Cal::Utils::StreamingHash64 primary;
+    Cal::Utils::StreamingHash64 secondary{secondaryKeySeed};
+
+    void update(const void *data, size_t size) {
+        primary.update(data, size);
+        secondary.update(data, size);
+    }
+
+    template <typename T>
+    void update(const T &value) {
+        update(&value, sizeof(T));
+    }
+
+    void updateString(const char *str) {
+        primary.updateString(str);
+        secondary.updateString(str);
+    }
+};
+
+} // namespace
+
+std::string ModuleDiskCache::Key::toString() const {
+    char ret[2 * 16 + 1] = {};
+    snprintf(ret, sizeof(ret), "%016" PRIx64 "%016" PRIx64, primary, secondary);
+    return ret;
+}
+
+ModuleDiskCache::ModuleDiskCache(const std::string &directory, uint64_t maxSizeBytes) : directory(directory), maxSizeBytes(maxSizeBytes) {
+    if (this->directory.empty()) {
+        log<Verbosity::error>("Module disk cache directory was not provided - disk cache is disabled");
+        return;
+    }
+    if (this->directory.back() != '/') {
+        this->directory += '/';
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(this->directory, ec);
+    if (ec || (false == std::filesystem::is_directory(this->directory, ec))) {
+        log<Verbosity::error>("Could not create module disk cache directory %s - disk cache is disabled", this->directory.c_str());
+        return;
+    }
+    std::filesystem::permissions(this->directory, std::filesystem::perms::owner_all, std::filesystem::perm_options::replace, ec);
+
+    usable = true;
+    log<Verbosity::debug>("Using module disk cache in %s (max size : %" PRIu64 " bytes)", this->directory.c_str(), maxSizeBytes);
+}
+
+std::string ModuleDiskCache::getDefaultDirectory() {
+    std::string cacheRoot;
+    if (auto xdgCacheHome = Cal::Utils::getEnv("XDG_CACHE_HOME"); xdgCacheHome && xdgCacheHome[0] == '/') {
+        cacheRoot = xdgCacheHome;
+    } else if (auto home = Cal::Utils::getEnv("HOME"); home && home[0] == '/') {
+        cacheRoot = std::string(home) + "/.cache";
+    } else {
+        cacheRoot = Cal::Utils::getPathForTempFiles();
+        if (cacheRoot.empty()) {
+            return "";
+        }
+    }
+    return cacheRoot + "/compute_aggregation_layer/module_cache/";
+}
+
+std::optional<uint64_t> ModuleDiskCache::getDeviceIdentity(ze_device_handle_t hDevice) {
+    std::lock_guard<std::mutex> lock(deviceIdentitiesMutex);
+    auto it = deviceIdentities.find(hDevice);
+    if (it != deviceIdentities.end()) {
+        return it->second;
+    }
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    if (ZE_RESULT_SUCCESS != Cal::Service::Apis::LevelZero::Standard::zeDeviceGetProperties(hDevice, &deviceProperties)) {
+        log<Verbosity::debug>("Could not get properties of device %p - module disk cache will not be used for it", hDevice);
+        return std::nullopt;
+    }
+    ze_driver_properties_t driverProperties = {ZE_STRUCTURE_TYPE_DRIVER_PROPERTIES};
+    if (ZE_RESULT_SUCCESS != Cal::Service::Apis::LevelZero::Standard::zeDriverGetProperties(Cal::Service::Apis::LevelZero::L0SharedObjects::getIntelGpuDriver(), &driverProperties)) {
+        log<Verbosity::debug>("Could not get properties of driver - module disk cache will not be used");
+        return std::nullopt;
+    }
+
+    // device UUID is skipped intentionally - native binaries are shareable between identical devices
+    Cal::Utils::StreamingHash64 identity;
+    identity.update(deviceProperties.type);
+    identity.update(deviceProperties.vendorId);
+    identity.update(deviceProperties.deviceId);
+    identity.update(deviceProperties.flags);
+    identity.updateString(deviceProperties.name);
+    identity.update(driverProperties.uuid);
+    identity.update(driverProperties.driverVersion);
+
+    auto ret = identity.finalize();
+    deviceIdentities[hDevice] = ret;
+    return ret;
+}
+
+std::optional<ModuleDiskCache::Key> ModuleDiskCache::createKey(ze_device_handle_t hDevice, const ze_module_desc_t *desc) {
+    if ((nullptr == desc) || (nullptr != desc->pNext) || (ZE_MODULE_FORMAT_NATIVE == desc->format) || (nullptr == desc->pInputModule)) {
+        return std::nullopt;
+    }
+
+    auto deviceIdentity = getDeviceIdentity(hDevice);
+    if (false == deviceIdentity.has_value()) {
+        return std::nullopt;
+    }
+
+    KeyHasher hasher;
+    hasher.update(FileHeader::currentVersion);
+    hasher.update(deviceIdentity.value());
+    hasher.update(desc->format);
+    hasher.update(desc->inputSize);
+    hasher.update(desc->pInputModule, desc->inputSize);
+    hasher.updateString(desc->pBuildFlags);
+    uint32_t numConstants = desc->pConstants ? desc->pConstants->numConstants : 0U;
+    hasher.update(numConstants);
+    for (uint32_t i = 0; i < numConstants; ++i) {
+        hasher.update(desc->pConstants->pConstantIds[i]);
+        hasher.update(*static_cast<const uint64_t *>(desc->pConstants->pConstantValues[i]));
+    }
+
+    return Key{hasher.primary.finalize(), hasher.secondary.finalize()};
+}
+
+std::string ModuleDiskCache::getEntryPath(const Key &key) const {
+    return directory + key.toString() + entryExtension;
+}
+
+std::optional<std::vector<uint8_t>> ModuleDiskCache::load(const Key &key) {
+    if (false == usable) {
+        return std::nullopt;
+    }
+
+    auto path = getEntryPath(key);
+    std::ifstream file(path, std::ios::binary);
+    if (false == file.is_open()) {
+        return std::nullopt;
+    }
+
+    auto discardCorrupted = [&](const char *reason) -> std::optional<std::vector<uint8_t>> {
+        log<Verbosity::info>("Discarding corrupted module disk cache entry %s (%s)", path.c_str(), reason);
+        file.close();
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        return std::nullopt;
+    };
+
+    FileHeader header = {};
+    if (false == static_cast<bool>(file.read(reinterpret_cast<char *>(&header), sizeof(header)))) {
+        return discardCorrupted("truncated header");
+    }
+    if ((header.magic != FileHeader::magicValue) || (header.version != FileHeader::currentVersion) || (header.headerSize != sizeof(FileHeader))) {
+        return discardCorrupted("unknown format");
+    }
+    if ((header.key.primary != key.primary) || (header.key.secondary != key.secondary)) {
+        return discardCorrupted("key mismatch");
+    }
+
+    std::error_code ec;
+    auto fileSize = std::filesystem::file_size(path, ec);
+    if (ec || (fileSize != sizeof(FileHeader) + header.payloadSize)) {
+        return discardCorrupted("size mismatch");
+    }
+
+    std::vector<uint8_t> payload(header.payloadSize);
+    if (false == static_cast<bool>(file.read(reinterpret_cast<char *>(payload.data()), payload.size()))) {
+        return discardCorrupted("truncated payload");
+    }
+    if (Cal::Utils::StreamingHash64{}.update(payload.data(), payload.size()).finalize() != header.payloadHash) {
+        return discardCorrupted("checksum mismatch");
+    }
+
+    // bump entry in LRU order
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+
+    log<Verbosity::debug>("Loaded native module binary from disk cache : %s (%zu bytes)", path.c_str(), payload.size());
+    return payload;
+}
+
+bool ModuleDiskCache::store(const Key &key, const uint8_t *payload, size_t payloadSize) {
+    if ((false == usable) || (nullptr == payload) || (0U == payloadSize)) {
+        return false;
+    }
+    if (sizeof(FileHeader) + payloadSize > maxSizeBytes) {
+        log<Verbosity::debug>("Native module binary (%zu bytes) exceeds module disk cache size limit - skipping", payloadSize);
+        return false;
+    }
+
+    FileHeader header = {};
+    header.magic = FileHeader::magicValue;
+    header.version = FileHeader::currentVersion;
+    header.headerSize = sizeof(FileHeader);
+    header.key = key;
+    header.payloadSize = payloadSize;
+    header.payloadHash = Cal::Utils::StreamingHash64{}.update(payload, payloadSize).finalize();
+
+    // readers never observe partially written entries - file is published with rename
+    auto path = getEntryPath(key);
+    auto tempPath = path + ".tmp." + std::to_string(getpid()) + "." + std::to_string(static_cast<pid_t>(syscall(SYS_gettid)));
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(payload), payloadSize);
+        file.flush();
+        if (false == static_cast<bool>(file)) {
+            log<Verbosity::error>("Could not write module disk cache entry %s", tempPath.c_str());
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        log<Verbosity::error>("Could not publish module disk cache entry %s - %s", path.c_str(), ec.message().c_str());
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+
+    log<Verbosity::debug>("Stored native module binary in disk cache : %s (%zu bytes)", path.c_str(), payloadSize);
+    evictLeastRecentlyUsed(path);
+    return true;
+}
+
+void ModuleDiskCache::evictLeastRecentlyUsed(const std::string &justStoredEntry) {
+    struct CachedEntry {
+        std::filesystem::path path;
+        std::filesystem::file_time_type lastUse;
+        uint64_t size;
+    };
+    std::vector<CachedEntry> entries;
+    uint64_t totalSize = 0U;
+
+    std::error_code ec;
+    for (const auto &dirEntry : std::filesystem::directory_iterator(directory, ec)) {
+        if ((false == dirEntry.is_regular_file(ec)) || (dirEntry.path().extension() != entryExtension)) {
+            continue;
+        }
+        auto size = dirEntry.file_size(ec);
+        if (ec) {
+            continue; // evicted concurrently by other service
+        }
+        auto lastUse = dirEntry.last_write_time(ec);
+        if (ec) {
+            continue;
+        }
+        entries.push_back({dirEntry.path(), lastUse, size});
+        totalSize += size;
+    }
+
+    if (totalSize <= maxSizeBytes) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const CachedEntry &lhs, const CachedEntry &rhs) { return lhs.lastUse < rhs.lastUse; });
+    for (const auto &entry : entries) {
+        if (totalSize <= maxSizeBytes) {
+            break;
+        }
+        if (entry.path == justStoredEntry) {
+            continue;
+        }
+        log<Verbosity::debug>("Evicting module disk cache entry %s (%" PRIu64 " bytes)", entry.path.c_str(), entry.size);
+        std::filesystem::remove(entry.path, ec);
+        totalSize -= entry.size;
+    }
+}
+
+} // namespace Cal::Service::LevelZero
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "level_zero/ze_api.h"
+#include "shared/utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Cal::Service::LevelZero {
+
+// Content-addressed directory of native module binaries that survives service restarts.
+// Every entry is published atomically (written to a temporary file and renamed), validated
+// against its header and checksum when loaded and evicted in LRU order (based on file's
+// modification time) once total size of the directory exceeds the limit.
+class ModuleDiskCache {
+  public:
+    static constexpr uint64_t defaultMaxSizeMB = 1024U;
+    static constexpr const char *entryExtension = ".bin";
+
+    struct Key {
+        uint64_t primary{};
+        uint64_t secondary{};
+
+        std::string toString() const;
+    };
+
+    struct FileHeader {
+        static constexpr uint64_t magicValue = 0x31454843414d4c43ULL; // "CLMACHE1"
+        static constexpr uint32_t currentVersion = 1U;
+
+        uint64_t magic{};
+        uint32_t version{};
+        uint32_t headerSize{};
+        Key key{};
+        uint64_t payloadSize{};
+        uint64_t payloadHash{};
+    };
+
+    ModuleDiskCache(const std::string &directory, uint64_t maxSizeBytes);
+    mockable ~ModuleDiskCache() = default;
+
+    bool isUsable() const {
+        return usable;
+    }
+
+    const std::string &getDirectory() const {
+        return directory;
+    }
+
+    std::optional<Key> createKey(ze_device_handle_t hDevice, const ze_module_desc_t *desc);
+    std::optional<std::vector<uint8_t>> load(const Key &key);
+    bool store(const Key &key, const uint8_t *payload, size_t payloadSize);
+
+    static std::string getDefaultDirectory();
+
+  protected:
+    std::string getEntryPath(const Key &key) const;
+    void evictLeastRecentlyUsed(const std::string &justStoredEntry);
+    mockable std::optional<uint64_t> getDeviceIdentity(ze_device_handle_t hDevice);
+
+    std::string directory;
+    uint64_t maxSizeBytes{};
+    bool usable{false};
+    std::mutex deviceIdentitiesMutex;
+    std::unordered_map<ze_device_handle_t, uint64_t> deviceIdentities;
+};
+
+} // namespace Cal::Service::LevelZero
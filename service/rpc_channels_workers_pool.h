@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/log.h"
+#include "shared/rpc.h"
+#include "shared/utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Cal::Service {
+
+// Fixed-size pool of threads that services RPC channels of all clients (instead of dedicated thread per channel).
+// Channel is owned by at most one worker at a time, so commands of a single channel are still serviced in order.
+// Every worker starts scanning from its own slice of channels and steals pending work from remaining slices.
+// Idle workers back off to short sleeps, so CPU usage of the service is bounded by the number of workers.
+class RpcChannelsWorkersPool {
+  public:
+    // returns true if worker has to stay with this channel (e.g. in the middle of a batch)
+    using ServiceCommandFuncT = std::function<bool(Cal::Rpc::ChannelServer::CommandPacket &packet)>;
+
+    static constexpr size_t maxCommandsPerOwnership = 64U;
+    static constexpr uint32_t spinRoundsBeforeSleep = 64U;
+    static constexpr std::chrono::microseconds maxIdleSleep{200};
+
+    RpcChannelsWorkersPool(size_t workersCount, const std::vector<int> &cpus) : cpus(cpus) {
+        workers.reserve(workersCount);
+        for (size_t workerId = 0; workerId < workersCount; ++workerId) {
+            workers.emplace_back(&RpcChannelsWorkersPool::workerLoop, this, workerId);
+        }
+        log<Verbosity::debug>("Started %zu RPC channels workers", workersCount);
+    }
+
+    ~RpcChannelsWorkersPool() {
+        stopping = true;
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    }
+
+    RpcChannelsWorkersPool(const RpcChannelsWorkersPool &) = delete;
+    RpcChannelsWorkersPool &operator=(const RpcChannelsWorkersPool &) = delete;
+
+    // returned future becomes ready once channel has been stopped and none of the workers is using it anymore
+    std::future<void> add(Cal::Rpc::ChannelServer *channel, ServiceCommandFuncT serviceCommand) {
+        auto servicedChannel = std::make_shared<ServicedChannel>();
+        servicedChannel->channel = channel;
+        servicedChannel->serviceCommand = std::move(serviceCommand);
+        auto released = servicedChannel->released.get_future();
+
+        std::lock_guard<std::mutex> lock(channelsMutex);
+        channels.push_back(std::move(servicedChannel));
+        ++channelsVersion;
+        return released;
+    }
+
+    size_t getWorkersCount() const {
+        return workers.size();
+    }
+
+    size_t getChannelsCount() {
+        std::lock_guard<std::mutex> lock(channelsMutex);
+        return channels.size();
+    }
+
+    // parses list of cpus in format used by taskset (e.g. "0,2,4-7")
+    static std::optional<std::vector<int>> parseCpuList(const char *list) {
+        std::vector<int> ret;
+        if (nullptr == list) {
+            return ret;
+        }
+        for (const auto &range : Cal::Utils::split(list, ",")) {
+            if (range.empty()) {
+                continue;
+            }
+            auto bounds = Cal::Utils::split(range, "-");
+            if ((bounds.size() > 2) || (false == isNumber(bounds[0])) || ((bounds.size() == 2) && (false == isNumber(bounds[1])))) {
+                return std::nullopt;
+            }
+            int first = std::stoi(bounds[0]);
+            int last = (bounds.size() == 2) ? std::stoi(bounds[1]) : first;
+            if ((last < first) || (last >= CPU_SETSIZE)) {
+                return std::nullopt;
+            }
+            for (int cpu = first; cpu <= last; ++cpu) {
+                ret.push_back(cpu);
+            }
+        }
+        return ret;
+    }
+
+  protected:
+    struct ServicedChannel {
+        Cal::Rpc::ChannelServer *channel = nullptr;
+        ServiceCommandFuncT serviceCommand;
+        std::promise<void> released;
+        std::atomic_bool owned = false;
+    };
+
+    static bool isNumber(const std::string &str) {
+        return (false == str.empty()) && std::all_of(str.begin(), str.end(), [](unsigned char c) { return std::isdigit(c); });
+    }
+
+    void workerLoop(size_t workerId) {
+        if (false == cpus.empty()) {
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(cpus[workerId % cpus.size()], &cpuSet);
+            if (0 != pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet)) {
+                log<Verbosity::error>("Could not bind RPC channels worker %zu to cpu %d", workerId, cpus[workerId % cpus.size()]);
+            }
+        }
+
+        std::vector<std::shared_ptr<ServicedChannel>> snapshot;
+        uint64_t snapshotVersion = 0U;
+        uint32_t idleRounds = 0U;
+        while (false == stopping) {
+            if (snapshotVersion != channelsVersion.load(std::memory_order_acquire)) {
+                std::lock_guard<std::mutex> lock(channelsMutex);
+                snapshot = channels;
+                snapshotVersion = channelsVersion;
+            }
+
+            bool hadWork = false;
+            auto channelsCount = snapshot.size();
+            auto ownSliceStart = channelsCount ? (workerId * channelsCount) / workers.size() : 0U;
+            for (size_t i = 0; i < channelsCount; ++i) {
+                hadWork |= tryServiceChannel(*snapshot[(ownSliceStart + i) % channelsCount]);
+            }
+
+            if (hadWork) {
+                idleRounds = 0U;
+            } else if (++idleRounds < spinRoundsBeforeSleep) {
+                std::this_thread::yield();
+            } else {
+                auto backoff = std::chrono::microseconds(1U << std::min(idleRounds - spinRoundsBeforeSleep, 8U));
+                std::this_thread::sleep_for(std::min(backoff, maxIdleSleep));
+            }
+        }
+    }
+
+    bool tryServiceChannel(ServicedChannel &servicedChannel) {
+        if (servicedChannel.owned.load(std::memory_order_relaxed) || servicedChannel.owned.exchange(true, std::memory_order_acquire)) {
+            return false;
+        }
+
+        auto channel = servicedChannel.channel;
+        if (channel->isStopped()) {
+            release(servicedChannel); // channel stays owned forever, so no other worker will touch it anymore
+            return false;
+        }
+
+        size_t servicedCount = 0U;
+        bool stayWithChannel = false;
+        while ((servicedCount < maxCommandsPerOwnership) || stayWithChannel) {
+            auto packet = channel->tryPop();
+            if (nullptr == packet.command) {
+                if (stayWithChannel && (false == channel->isStopped()) && (false == stopping)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                break;
+            }
+            stayWithChannel = servicedChannel.serviceCommand(packet);
+            ++servicedCount;
+        }
+
+        servicedChannel.owned.store(false, std::memory_order_release);
+        return servicedCount > 0U;
+    }
+
+    void release(ServicedChannel &servicedChannel) {
+        log<Verbosity::debug>("Releasing stopped RPC channel : %d", servicedChannel.channel->getId());
+        std::shared_ptr<ServicedChannel> keepAlive;
+        {
+            std::lock_guard<std::mutex> lock(channelsMutex);
+            auto it = std::find_if(channels.begin(), channels.end(), [&](const auto &channel) { return channel.get() == &servicedChannel; });
+            if (it != channels.end()) {
+                keepAlive = std::move(*it);
+                channels.erase(it);
+                ++channelsVersion;
+            }
+        }
+        servicedChannel.released.set_value();
+    }
+
+    std::vector<int> cpus;
+    std::atomic_bool stopping = false;
+    std::mutex channelsMutex;
+    std::vector<std::shared_ptr<ServicedChannel>> channels;
+    std::atomic_uint64_t channelsVersion = 0U;
+    std::vector<std::thread> workers;
+};
+
+} // namespace Cal::Service
@@ -11,6 +11,7 @@
 #include "generated_rpc_messages_ocl.h"
 #include "generated_service_level_zero.h"
 #include "generated_service_ocl.h"
+#include "shared/transfer_copy.h"
 
 #include <cstddef>
 #include <dlfcn.h>
@@ -202,6 +203,29 @@ void gpuDestructorClMem(void *ctx, void *ptr) {
     }
 }
 
+bool clDeviceMemAllocINTELHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader *command, size_t commandMaxSize) {
+    log<Verbosity::bloat>("Servicing RPC request for clDeviceMemAllocINTEL");
+    auto apiCommand = reinterpret_cast<Cal::Rpc::Ocl::ClDeviceMemAllocINTELRpcM *>(command);
+    if (false == ctx.getMemoryUsage().tryCharge(Cal::Stats::MemoryKind::device, apiCommand->args.size, false)) {
+        apiCommand->captures.ret = nullptr;
+        apiCommand->captures.errcode_ret = CL_OUT_OF_RESOURCES;
+        return true;
+    }
+
+    apiCommand->captures.ret = Cal::Service::Apis::Ocl::Extensions::clDeviceMemAllocINTEL(apiCommand->args.context,
+                                                                                          apiCommand->args.device,
+                                                                                          apiCommand->args.properties ? apiCommand->captures.properties : nullptr,
+                                                                                          apiCommand->args.size,
+                                                                                          apiCommand->args.alignment,
+                                                                                          apiCommand->args.errcode_ret ? &apiCommand->captures.errcode_ret : nullptr);
+    if (nullptr != apiCommand->captures.ret) {
+        ctx.getMemoryUsage().trackAllocation(apiCommand->captures.ret, Cal::Stats::MemoryKind::device, apiCommand->args.size, false);
+    } else {
+        ctx.getMemoryUsage().release(Cal::Stats::MemoryKind::device, apiCommand->args.size, false);
+    }
+    return true;
+}
+
 bool clHostMemAllocINTELHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader *command, size_t commandMaxSize) {
     log<Verbosity::bloat>("Servicing RPC request for clHostMemAllocINTEL");
     auto apiCommand = reinterpret_cast<Cal::Rpc::Ocl::ClHostMemAllocINTELRpcM *>(command);
@@ -221,6 +245,12 @@ bool clHostMemAllocINTELHandler(Provider &service, Cal::Rpc::ChannelServer &chan
 
     auto alignedSize = Cal::Utils::alignUpPow2<Cal::Utils::pageSize64KB>(apiCommand->args.size);
     properties.push_back(0);
+    if (false == ctx.getMemoryUsage().tryCharge(Cal::Stats::MemoryKind::host, alignedSize, true)) {
+        apiCommand->captures.ret = nullptr;
+        apiCommand->captures.errcode_ret = CL_OUT_OF_RESOURCES;
+        return true;
+    }
+
     auto ctxLock = ctx.lock();
     for (auto &heap : ctx.getUsmHeaps()) {
         auto shmem = heap.allocate(alignedSize, Cal::Utils::pageSize64KB);
@@ -244,6 +274,7 @@ bool clHostMemAllocINTELHandler(Provider &service, Cal::Rpc::ChannelServer &chan
             log<Verbosity::debug>("Succesfully mapped %zu bytes of USM shared/host memory from heap : %zx-%zx as %p on the GPU",
                                   apiCommand->args.size, heap.getUnderlyingAllocator().getMmapRange().start, heap.getUnderlyingAllocator().getMmapRange().end, apiCommand->captures.ret);
             ctx.addUsmSharedHostAlloc(apiCommand->args.context, shmem, ApiType::OpenCL, gpuDestructorUsm);
+            ctx.getMemoryUsage().trackAllocation(cpuAddress, Cal::Stats::MemoryKind::host, alignedSize, true);
             apiCommand->implicitArgs.shmem_resource = shmem.getSourceAllocation()->getShmemId();
             apiCommand->implicitArgs.offset_within_resource = shmem.getSubAllocationOffset();
             apiCommand->implicitArgs.aligned_size = alignedSize;
@@ -253,6 +284,7 @@ bool clHostMemAllocINTELHandler(Provider &service, Cal::Rpc::ChannelServer &chan
                                   cpuAddress, apiCommand->captures.ret);
             Cal::Service::Apis::Ocl::Extensions::clMemFreeINTEL(apiCommand->args.context, apiCommand->captures.ret);
             heap.free(shmem);
+            ctx.getMemoryUsage().release(Cal::Stats::MemoryKind::host, alignedSize, true);
             apiCommand->captures.ret = nullptr;
             apiCommand->captures.errcode_ret = CL_OUT_OF_RESOURCES;
             return true;
@@ -260,6 +292,7 @@ bool clHostMemAllocINTELHandler(Provider &service, Cal::Rpc::ChannelServer &chan
     }
     if (nullptr == apiCommand->captures.ret) {
         log<Verbosity::error>("None of USM shared/host heaps could acommodate new USM host allocation for GPU");
+        ctx.getMemoryUsage().release(Cal::Stats::MemoryKind::host, alignedSize, true);
         if (CL_SUCCESS == apiCommand->captures.errcode_ret) {
             apiCommand->captures.errcode_ret = CL_OUT_OF_RESOURCES;
         }
@@ -287,6 +320,12 @@ bool clSharedMemAllocINTELHandler(Provider &service, Cal::Rpc::ChannelServer &ch
 
     auto alignedSize = Cal::Utils::alignUpPow2<Cal::Utils::pageSize64KB>(apiCommand->args.size);
     properties.push_back(0);
+    if (false == ctx.getMemoryUsage().tryCharge(Cal::Stats::MemoryKind::shared, alignedSize, true)) {
+        apiCommand->captures.ret = nullptr;
+        apiCommand->captures.errcode_ret = CL_OUT_OF_RESOURCES;
+        return true;
+    }
+
     auto ctxLock = ctx.lock();
     for (auto &heap : ctx.getUsmHeaps()) {
         auto shmem = heap.allocate(alignedSize, Cal::Utils::pageSize64KB);
@@ -309,6 +348,7 @@ bool clSharedMemAllocINTELHandler(Provider &service, Cal::Rpc::ChannelServer &ch
         if (apiCommand->captures.ret == cpuAddress) {
             log<Verbosity::debug>("Succesfully mapped %zu bytes of USM shared/host memory from heap : %zx-%zx as %p on the GPU", apiCommand->args.size, heap.getUnderlyingAllocator().getMmapRange().start, heap.getUnderlyingAllocator().getMmapRange().end, apiCommand->captures.ret);
             ctx.addUsmSharedHostAlloc(apiCommand->args.context, shmem, ApiType::OpenCL, gpuDestructorUsm);
+            ctx.getMemoryUsage().trackAllocation(cpuAddress, Cal::Stats::MemoryKind::shared, alignedSize, true);
             apiCommand->implicitArgs.shmem_resource = shmem.getSourceAllocation()->getShmemId();
             apiCommand->implicitArgs.offset_within_resource = shmem.getSubAllocationOffset();
             apiCommand->implicitArgs.aligned_size = alignedSize;
@@ -318,6 +358,7 @@ bool clSharedMemAllocINTELHandler(Provider &service, Cal::Rpc::ChannelServer &ch
                                   cpuAddress, apiCommand->captures.ret);
             Cal::Service::Apis::Ocl::Extensions::clMemFreeINTEL(apiCommand->args.context, apiCommand->captures.ret);
             heap.free(shmem);
+            ctx.getMemoryUsage().release(Cal::Stats::MemoryKind::shared, alignedSize, true);
             apiCommand->captures.ret = nullptr;
             apiCommand->captures.errcode_ret = CL_OUT_OF_RESOURCES;
             return true;
@@ -325,6 +366,7 @@ bool clSharedMemAllocINTELHandler(Provider &service, Cal::Rpc::ChannelServer &ch
     }
     if (nullptr == apiCommand->captures.ret) {
         log<Verbosity::error>("None of USM shared/host heaps could acommodate new USM host allocation for GPU");
+        ctx.getMemoryUsage().release(Cal::Stats::MemoryKind::shared, alignedSize, true);
         if (CL_SUCCESS == apiCommand->captures.errcode_ret) {
             apiCommand->captures.errcode_ret = CL_OUT_OF_RESOURCES;
         }
@@ -345,6 +387,11 @@ bool clSVMAllocHandler(Provider &service, Cal::Rpc::ChannelServer &channel, Clie
     cl_mem_properties_intel properties[] = {CL_MEM_ALLOC_USE_HOST_PTR_INTEL, 0, 0};
 
     auto alignedSize = Cal::Utils::alignUpPow2<Cal::Utils::pageSize64KB>(apiCommand->args.size);
+    if (false == ctx.getMemoryUsage().tryCharge(Cal::Stats::MemoryKind::shared, alignedSize, true)) {
+        apiCommand->captures.ret = nullptr;
+        return true;
+    }
+
     auto ctxLock = ctx.lock();
     for (auto &heap : ctx.getUsmHeaps()) {
         auto shmem = heap.allocate(alignedSize, Cal::Utils::pageSize64KB);
@@ -367,6 +414,7 @@ bool clSVMAllocHandler(Provider &service, Cal::Rpc::ChannelServer &channel, Clie
         if (apiCommand->captures.ret == cpuAddress) {
             log<Verbosity::debug>("Succesfully mapped %zu bytes of USM shared/host memory from heap : %zx-%zx as %p on the GPU", apiCommand->args.size, heap.getUnderlyingAllocator().getMmapRange().start, heap.getUnderlyingAllocator().getMmapRange().end, apiCommand->captures.ret);
             ctx.addUsmSharedHostAlloc(apiCommand->args.context, shmem, ApiType::OpenCL, gpuDestructorUsm);
+            ctx.getMemoryUsage().trackAllocation(cpuAddress, Cal::Stats::MemoryKind::shared, alignedSize, true);
             apiCommand->implicitArgs.shmem_resource = shmem.getSourceAllocation()->getShmemId();
             apiCommand->implicitArgs.offset_within_resource = shmem.getSubAllocationOffset();
             apiCommand->implicitArgs.aligned_size = alignedSize;
@@ -376,12 +424,14 @@ bool clSVMAllocHandler(Provider &service, Cal::Rpc::ChannelServer &channel, Clie
                                   cpuAddress, apiCommand->captures.ret);
             Cal::Service::Apis::Ocl::Extensions::clMemFreeINTEL(apiCommand->args.context, apiCommand->captures.ret);
             heap.free(shmem);
+            ctx.getMemoryUsage().release(Cal::Stats::MemoryKind::shared, alignedSize, true);
             apiCommand->captures.ret = nullptr;
             return true;
         }
     }
     if (nullptr == apiCommand->captures.ret) {
         log<Verbosity::error>("None of USM shared/host heaps could acommodate new SVM allocation for GPU");
+        ctx.getMemoryUsage().release(Cal::Stats::MemoryKind::shared, alignedSize, true);
     }
 
     return true;
@@ -392,6 +442,7 @@ bool clSVMFreeHandler(Provider &service, Cal::Rpc::ChannelServer &channel, Clien
     auto apiCommand = reinterpret_cast<Cal::Rpc::Ocl::ClSVMFreeRpcM *>(command);
     auto ptr = apiCommand->args.ptr;
     Cal::Service::Apis::Ocl::Extensions::clMemFreeINTEL(apiCommand->args.context, apiCommand->args.ptr);
+    ctx.getMemoryUsage().releaseAllocation(ptr);
     if (service.getCpuInfo().isAccessibleByApplication(ptr)) {
         auto ctxLock = ctx.lock();
         ctx.reapUsmSharedHostAlloc(ptr, false);
@@ -430,6 +481,9 @@ bool clMemFreeINTELHandler(Provider &service, Cal::Rpc::ChannelServer &channel,
     auto ptr = apiCommand->args.ptr;
     apiCommand->captures.ret = Cal::Service::Apis::Ocl::Extensions::clMemFreeINTEL(apiCommand->args.context,
                                                                                    apiCommand->args.ptr);
+    if (CL_SUCCESS == apiCommand->captures.ret) {
+        ctx.getMemoryUsage().releaseAllocation(ptr);
+    }
     if (service.getCpuInfo().isAccessibleByApplication(ptr)) {
         auto ctxLock = ctx.lock();
         ctx.reapUsmSharedHostAlloc(ptr, false);
@@ -443,6 +497,9 @@ bool clMemBlockingFreeINTELHandler(Provider &service, Cal::Rpc::ChannelServer &c
     auto ptr = apiCommand->args.ptr;
     apiCommand->captures.ret = Cal::Service::Apis::Ocl::Extensions::clMemBlockingFreeINTEL(apiCommand->args.context,
                                                                                            apiCommand->args.ptr);
+    if (CL_SUCCESS == apiCommand->captures.ret) {
+        ctx.getMemoryUsage().releaseAllocation(ptr);
+    }
     if (service.getCpuInfo().isAccessibleByApplication(ptr)) {
         auto ctxLock = ctx.lock();
         ctx.reapUsmSharedHostAlloc(ptr, false);
@@ -558,6 +615,7 @@ void CL_CALLBACK clEnqueueSVMFreeCallbackWrapper(cl_command_queue queue, cl_uint
         }
         for (cl_uint i = 0; i < num_svm_pointers; i++) {
             Cal::Service::Apis::Ocl::Extensions::clMemFreeINTEL(context, svm_pointers[i]);
+            clientContext->getMemoryUsage().releaseAllocation(svm_pointers[i]);
         }
         auto clientContextLock = clientContext->lock();
         for (cl_uint i = 0; i < num_svm_pointers; i++) {
@@ -811,7 +869,7 @@ bool clEnqueueWriteBufferRect_LocalHandler(Provider &service, Cal::Rpc::ChannelS
     log<Verbosity::performance>("Allocating additional staging host memory on service side for clEnqueueWriteBufferRect");
     auto localPtrSize = Cal::Utils::getBufferRectSizeInBytes(apiCommand->captures.host_origin, apiCommand->captures.region, apiCommand->args.host_row_pitch, apiCommand->args.host_slice_pitch);
     auto localPtr = std::make_unique<char[]>(localPtrSize);
-    memcpy(localPtr.get(), apiCommand->args.ptr, localPtrSize);
+    Cal::Utils::TransferCopy::copy(localPtr.get(), apiCommand->args.ptr, localPtrSize);
     apiCommand->captures.ret = Cal::Service::Apis::Ocl::Standard::clEnqueueWriteBufferRect(
         apiCommand->args.command_queue,
         apiCommand->args.buffer,
@@ -940,7 +998,7 @@ bool clEnqueueReadBufferRect_LocalHandler(Provider &service, Cal::Rpc::ChannelSe
         log<Verbosity::error>("Asynchronous call to clEnqueueReadBufferRect_Local (as clEnqueueReadBufferRect_LocalHandler) has failed! Please rerun workload with CAL_ASYNC_CALLS=0 to debug the issue.");
         return false;
     }
-    memcpy(apiCommand->args.ptr, localPtr.get(), localPtrSize);
+    Cal::Utils::TransferCopy::copy(apiCommand->args.ptr, localPtr.get(), localPtrSize);
     return true;
 }
 bool clEnqueueReadBufferRect_UsmHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader *command, size_t commandMaxSize) {
@@ -1001,6 +1059,45 @@ bool clEnqueueReadBufferRect_SharedHandler(Provider &service, Cal::Rpc::ChannelS
 
 namespace LevelZero {
 
+// Copies hostptr memory of given transfers directly from/to client process. Returns number of transfers which are
+// left for the client (these are moved to the beginning of the array) - USM staging ones and ones that failed.
+uint32_t transferHostptrMemoryDirectly(ClientContext &ctx, Cal::Rpc::TransferDesc *transferDescs, uint32_t transferDescsCount, bool toClient) {
+    auto &directTransfers = ctx.getDirectTransfers();
+    if ((false == directTransfers.isEnabled()) || (0U == transferDescsCount)) {
+        return transferDescsCount;
+    }
+
+    std::vector<DirectTransfers::CopyDesc> copies;
+    std::vector<uint32_t> copiedTransferDescs;
+    copies.reserve(transferDescsCount);
+    copiedTransferDescs.reserve(transferDescsCount);
+    for (uint32_t i = 0; i < transferDescsCount; ++i) {
+        if (transferDescs[i].shmemId == -1) {
+            continue;
+        }
+        auto serviceAddress = ctx.getMemoryBlocksManager().translateTransferDesc(transferDescs[i]);
+        if (nullptr == serviceAddress) {
+            continue;
+        }
+        copies.push_back({serviceAddress, transferDescs[i].clientAddress, transferDescs[i].bytesCountToCopy});
+        copiedTransferDescs.push_back(i);
+    }
+
+    auto transferredCount = toClient ? directTransfers.writeToClient(copies) : directTransfers.readFromClient(copies);
+    std::vector<bool> transferred(transferDescsCount, false);
+    for (size_t i = 0; i < transferredCount; ++i) {
+        transferred[copiedTransferDescs[i]] = true;
+    }
+
+    uint32_t leftForClientCount = 0U;
+    for (uint32_t i = 0; i < transferDescsCount; ++i) {
+        if (false == transferred[i]) {
+            transferDescs[leftForClientCount++] = transferDescs[i];
+        }
+    }
+    return leftForClientCount;
+}
+
 bool updateHostptrCopies(Cal::Rpc::ChannelServer &channel, ClientContext &ctx) {
     auto &copiesManager = ctx.getOngoingHostptrCopiesManager();
     std::vector<Cal::Utils::AddressRange> finishedCopies;
@@ -1010,6 +1107,7 @@ bool updateHostptrCopies(Cal::Rpc::ChannelServer &channel, ClientContext &ctx) {
     for (const auto &fc : finishedCopies) {
         ctx.getMemoryBlocksManager().getRequiredTransferDescs(fc, transferDescs);
     }
+    transferDescs.resize(transferHostptrMemoryDirectly(ctx, transferDescs.data(), static_cast<uint32_t>(transferDescs.size()), true));
     for (const auto &copyDescription : transferDescs) {
         if (false == channel.pushHostptrCopyToUpdate(copyDescription)) {
             log<Verbosity::error>("Could not notify client about update of hostptr copies!");
@@ -1060,6 +1158,30 @@ void gpuDestructorUsm(void *ctx, void *ptr) {
     }
 }
 
+bool zeMemAllocDeviceHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader *command, size_t commandMaxSize) {
+    log<Verbosity::bloat>("Servicing RPC request for zeMemAllocDevice");
+    auto apiCommand = reinterpret_cast<Cal::Rpc::LevelZero::ZeMemAllocDeviceRpcM *>(command);
+    apiCommand->captures.reassembleNestedStructs();
+    if (false == ctx.getMemoryUsage().tryCharge(Cal::Stats::MemoryKind::device, apiCommand->args.size, false)) {
+        apiCommand->captures.ret = ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+        apiCommand->captures.pptr = nullptr;
+        return true;
+    }
+
+    apiCommand->captures.ret = Cal::Service::Apis::LevelZero::Standard::zeMemAllocDevice(apiCommand->args.hContext,
+                                                                                         apiCommand->args.device_desc ? &apiCommand->captures.device_desc : nullptr,
+                                                                                         apiCommand->args.size,
+                                                                                         apiCommand->args.alignment,
+                                                                                         apiCommand->args.hDevice,
+                                                                                         apiCommand->args.pptr ? &apiCommand->captures.pptr : nullptr);
+    if ((ZE_RESULT_SUCCESS == apiCommand->captures.ret) && apiCommand->args.pptr) {
+        ctx.getMemoryUsage().trackAllocation(apiCommand->captures.pptr, Cal::Stats::MemoryKind::device, apiCommand->args.size, false);
+    } else {
+        ctx.getMemoryUsage().release(Cal::Stats::MemoryKind::device, apiCommand->args.size, false);
+    }
+    return true;
+}
+
 bool zeMemAllocHostHandler(Provider &service, Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader *command, size_t commandMaxSize) {
     log<Verbosity::bloat>("Servicing RPC request for zeMemAllocHost");
 
@@ -1079,6 +1201,12 @@ bool zeMemAllocHostHandler(Provider &service, Cal::Rpc::ChannelServer &channel,
 
     static bool useStandaloneAllocations = Utils::getCalEnvFlag(calUseStandaloneAllocationsForZeMemAllocHost, false);
 
+    if (false == ctx.getMemoryUsage().tryCharge(Cal::Stats::MemoryKind::host, alignedSize, true)) {
+        apiCommand->captures.ret = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+        apiCommand->captures.pptr = nullptr;
+        return true;
+    }
+
     auto ctxLock = ctx.lock();
     for (auto &heap : ctx.getUsmHeaps()) {
         Cal::Allocators::ArenaSubAllocation<Cal::Ipc::MmappedShmemAllocationT, void> shmem;
@@ -1110,6 +1238,7 @@ bool zeMemAllocHostHandler(Provider &service, Cal::Rpc::ChannelServer &channel,
             log<Verbosity::debug>("Succesfully mapped %zu bytes of USM shared/host memory from heap : %zx-%zx as %p on the GPU", apiCommand->args.size, heap.getUnderlyingAllocator().getMmapRange().start, heap.getUnderlyingAllocator().getMmapRange().end, apiCommand->captures.pptr);
 
             ctx.addUsmSharedHostAlloc(apiCommand->args.hContext, shmem, ApiType::LevelZero, gpuDestructorUsm);
+            ctx.getMemoryUsage().trackAllocation(cpuAddress, Cal::Stats::MemoryKind::host, alignedSize, true);
             apiCommand->implicitArgs.shmem_resource = shmem.getSourceAllocation()->getShmemId();
             apiCommand->implicitArgs.offset_within_resource = shmem.getSubAllocationOffset();
             apiCommand->implicitArgs.aligned_size = alignedSize;
@@ -1120,6 +1249,7 @@ bool zeMemAllocHostHandler(Provider &service, Cal::Rpc::ChannelServer &channel,
 
             Cal::Service::Apis::LevelZero::Standard::zeMemFree(apiCommand->args.hContext, apiCommand->captures.pptr);
             heap.free(shmem);
+            ctx.getMemoryUsage().release(Cal::Stats::MemoryKind::host, alignedSize, true);
 
             apiCommand->captures.ret = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
             apiCommand->captures.pptr = nullptr;
@@ -1130,6 +1260,7 @@ bool zeMemAllocHostHandler(Provider &service, Cal::Rpc::ChannelServer &channel,
 
     if (apiCommand->captures.ret != ZE_RESULT_SUCCESS || nullptr == apiCommand->captures.pptr) {
         log<Verbosity::error>("None of USM shared/host heaps could accommodate new USM host allocation for GPU");
+        ctx.getMemoryUsage().release(Cal::Stats::MemoryKind::host, alignedSize, true);
 
         if (ZE_RESULT_SUCCESS == apiCommand->captures.ret) {
             apiCommand->captures.ret = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -1156,6 +1287,12 @@ bool zeMemAllocSharedHandler(Provider &service, Cal::Rpc::ChannelServer &channel
 
     auto minAlignment = apiCommand->args.alignment ? Cal::Utils::alignUpPow2<Cal::Utils::pageSize64KB>(apiCommand->args.alignment) : Cal::Utils::pageSize64KB;
     auto alignedSize = Cal::Utils::alignUpPow2<Cal::Utils::pageSize64KB>(apiCommand->args.size);
+    if (false == ctx.getMemoryUsage().tryCharge(Cal::Stats::MemoryKind::shared, alignedSize, true)) {
+        apiCommand->captures.ret = ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+        apiCommand->captures.pptr = nullptr;
+        return true;
+    }
+
     auto ctxLock = ctx.lock();
     for (auto &heap : ctx.getUsmHeaps()) {
         auto shmem = heap.allocate(alignedSize, minAlignment);
@@ -1184,6 +1321,7 @@ bool zeMemAllocSharedHandler(Provider &service, Cal::Rpc::ChannelServer &channel
             log<Verbosity::debug>("Succesfully mapped %zu bytes of USM shared/host memory from heap : %zx-%zx as %p on the GPU", apiCommand->args.size, heap.getUnderlyingAllocator().getMmapRange().start, heap.getUnderlyingAllocator().getMmapRange().end, apiCommand->captures.pptr);
 
             ctx.addUsmSharedHostAlloc(apiCommand->args.hContext, shmem, ApiType::LevelZero, gpuDestructorUsm);
+            ctx.getMemoryUsage().trackAllocation(cpuAddress, Cal::Stats::MemoryKind::shared, alignedSize, true);
             apiCommand->implicitArgs.shmem_resource = shmem.getSourceAllocation()->getShmemId();
             apiCommand->implicitArgs.offset_within_resource = shmem.getSubAllocationOffset();
             apiCommand->implicitArgs.aligned_size = alignedSize;
@@ -1194,6 +1332,7 @@ bool zeMemAllocSharedHandler(Provider &service, Cal::Rpc::ChannelServer &channel
 
             Cal::Service::Apis::LevelZero::Standard::zeMemFree(apiCommand->args.hContext, apiCommand->captures.pptr);
             heap.free(shmem);
+            ctx.getMemoryUsage().release(Cal::Stats::MemoryKind::shared, alignedSize, true);
 
             apiCommand->captures.ret = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
             apiCommand->captures.pptr = nullptr;
@@ -1204,6 +1343,7 @@ bool zeMemAllocSharedHandler(Provider &service, Cal::Rpc::ChannelServer &channel
 
     if (apiCommand->captures.ret != ZE_RESULT_SUCCESS || nullptr == apiCommand->captures.pptr) {
         log<Verbosity::error>("None of USM shared/host heaps could acommodate new USM host allocation for GPU");
+        ctx.getMemoryUsage().release(Cal::Stats::MemoryKind::shared, alignedSize, true);
 
         if (ZE_RESULT_SUCCESS == apiCommand->captures.ret) {
             apiCommand->captures.ret = ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -1219,6 +1359,9 @@ bool zeMemFreeHandler(Provider &service, Cal::Rpc::ChannelServer &channel, Clien
     auto apiCommand = reinterpret_cast<Cal::Rpc::LevelZero::ZeMemFreeRpcM *>(command);
 
     apiCommand->captures.ret = Cal::Service::Apis::LevelZero::Standard::zeMemFree(apiCommand->args.hContext, apiCommand->args.ptr);
+    if (ZE_RESULT_SUCCESS == apiCommand->captures.ret) {
+        ctx.getMemoryUsage().releaseAllocation(apiCommand->args.ptr);
+    }
 
     if (service.getCpuInfo().isAccessibleByApplication(apiCommand->args.ptr)) {
         auto ctxLock = ctx.lock();
@@ -1236,6 +1379,9 @@ bool zeMemFreeExtHandler(Provider &service, Cal::Rpc::ChannelServer &channel, Cl
         apiCommand->args.hContext,
         apiCommand->args.pMemFreeDesc ? &apiCommand->captures.pMemFreeDesc : nullptr,
         apiCommand->args.ptr);
+    if (ZE_RESULT_SUCCESS == apiCommand->captures.ret) {
+        ctx.getMemoryUsage().releaseAllocation(apiCommand->args.ptr);
+    }
     if (service.getCpuInfo().isAccessibleByApplication(apiCommand->args.ptr)) {
         auto ctxLock = ctx.lock();
         ctx.reapUsmSharedHostAlloc(apiCommand->args.ptr, false);
@@ -1303,27 +1449,58 @@ bool zeModuleCreateHandler(Provider &service, Cal::Rpc::ChannelServer &channel,
     const auto desc = apiCommand->args.desc ? &apiCommand->captures.desc : nullptr;
     auto module = apiCommand->args.phModule ? &apiCommand->captures.phModule : nullptr;
     auto buildLog = apiCommand->args.phBuildLog ? &apiCommand->captures.phBuildLog : nullptr;
-    auto lock = service.moduleCache.obtainOwnership();
-    if (auto cacheEntry = service.moduleCache.find(apiCommand->args.hContext, apiCommand->args.hDevice, desc)) {
+    auto createModule = [&](const ze_module_desc_t *moduleDesc) {
+        return Cal::Service::Apis::LevelZero::Standard::zeModuleCreate(apiCommand->args.hContext, apiCommand->args.hDevice, moduleDesc, module, buildLog);
+    };
+    auto createModuleFromNativeBinary = [&](const std::vector<uint8_t> &nativeBinary) {
         ze_module_desc_t nativeDesc{};
         nativeDesc.stype = ZE_STRUCTURE_TYPE_MODULE_DESC;
         nativeDesc.format = ZE_MODULE_FORMAT_NATIVE;
-        nativeDesc.inputSize = cacheEntry.value()->nativeSize;
-        nativeDesc.pInputModule = cacheEntry.value()->pNativeBinary;
-        apiCommand->captures.ret = Cal::Service::Apis::LevelZero::Standard::zeModuleCreate(apiCommand->args.hContext, apiCommand->args.hDevice, &nativeDesc, module, buildLog);
+        nativeDesc.inputSize = nativeBinary.size();
+        nativeDesc.pInputModule = nativeBinary.data();
+        return createModule(&nativeDesc);
+    };
+
+    auto cacheKey = Provider::ModuleCache::createKey(apiCommand->args.hDevice, desc);
+    if (false == cacheKey.has_value()) {
+        apiCommand->captures.ret = createModule(desc);
+    } else if (auto [cacheEntry, isBuilder] = service.moduleCache.acquire(cacheKey.value()); false == isBuilder) {
+        // empty binary means that concurrent build has failed - repeat it to report proper error and build log
+        apiCommand->captures.ret = cacheEntry->nativeBinary.empty() ? createModule(desc) : createModuleFromNativeBinary(cacheEntry->nativeBinary);
     } else {
-        apiCommand->captures.ret = Cal::Service::Apis::LevelZero::Standard::zeModuleCreate(
-            apiCommand->args.hContext,
-            apiCommand->args.hDevice,
-            desc,
-            module,
-            buildLog);
-        if (isSuccessful(apiCommand->captures.ret)) {
+        std::vector<uint8_t> nativeBinary;
+        auto diskCache = service.moduleCache.getDiskCache();
+        auto diskCacheKey = diskCache ? diskCache->createKey(apiCommand->args.hDevice, desc) : std::nullopt;
+        if (diskCacheKey.has_value()) {
+            if (auto cached = diskCache->load(diskCacheKey.value())) {
+                apiCommand->captures.ret = createModuleFromNativeBinary(cached.value());
+                if (isSuccessful(apiCommand->captures.ret)) {
+                    nativeBinary = std::move(cached.value());
+                } else if (buildLog && *buildLog) {
+                    Cal::Service::Apis::LevelZero::Standard::zeModuleBuildLogDestroy(*buildLog);
+                    *buildLog = nullptr;
+                }
+            }
+        }
+
+        if (nativeBinary.empty()) {
+            apiCommand->captures.ret = createModule(desc);
             size_t nativeSize = 0;
-            Cal::Service::Apis::LevelZero::Standard::zeModuleGetNativeBinary(*module, &nativeSize, nullptr);
-            auto pNativeBinary = new uint8_t[nativeSize];
-            Cal::Service::Apis::LevelZero::Standard::zeModuleGetNativeBinary(*module, &nativeSize, pNativeBinary);
-            service.moduleCache.store(apiCommand->args.hContext, apiCommand->args.hDevice, desc, nativeSize, pNativeBinary);
+            if (isSuccessful(apiCommand->captures.ret) && isSuccessful(Cal::Service::Apis::LevelZero::Standard::zeModuleGetNativeBinary(*module, &nativeSize, nullptr))) {
+                nativeBinary.resize(nativeSize);
+                if (false == isSuccessful(Cal::Service::Apis::LevelZero::Standard::zeModuleGetNativeBinary(*module, &nativeSize, nativeBinary.data()))) {
+                    nativeBinary.clear();
+                }
+            }
+            if (diskCacheKey.has_value() && (false == nativeBinary.empty())) {
+                diskCache->store(diskCacheKey.value(), nativeBinary.data(), nativeBinary.size());
+            }
+        }
+
+        if (nativeBinary.empty()) {
+            service.moduleCache.abandon(cacheKey.value());
+        } else {
+            service.moduleCache.publish(cacheKey.value(), std::move(nativeBinary));
         }
     }
 
@@ -1484,6 +1661,9 @@ bool zeCommandQueueExecuteCommandListsCopyMemoryRpcHelperHandler(Provider &servi
                                                                                      apiCommand->captures.getTransferDescs(),
                                                                                      apiCommand->args.chunksCount,
                                                                                      apiCommand->captures.getChunks());
+    if (wereTransfersRetrieved) {
+        apiCommand->captures.transferDescsCount = transferHostptrMemoryDirectly(ctx, apiCommand->captures.getTransferDescs(), apiCommand->captures.transferDescsCount, false);
+    }
 
     apiCommand->captures.ret = wereTransfersRetrieved ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     return true;
@@ -1742,6 +1922,72 @@ Provider::Provider(std::unique_ptr<ChoreographyLibrary> knownChoreographies, Ser
     this->commandQueueGroups.computeRoundRobinEnabled = Cal::Utils::getCalEnvFlag(calUseComputeRoundRobin, this->commandQueueGroups.computeRoundRobinEnabled);
     this->syncMallocCopy = Cal::Utils::getCalEnvFlag(calSyncMallocCopy, this->syncMallocCopy);
     this->batchedService = Cal::Utils::getCalEnvFlag(calBatchedService, this->batchedService);
+    this->statsEnabled = Cal::Utils::getCalEnvFlag(calEnableStatsEnvName, this->statsEnabled);
+    this->directTransfers = Cal::Utils::getCalEnvFlag(calDirectTransfersEnvName, this->directTransfers);
+    for (const auto &subtypeHandlers : this->rpcHandlers) {
+        if (subtypeHandlers.size() > Cal::Stats::StatsPage::messageSubtypesCount) {
+            log<Verbosity::error>("Statistics page can't fit all RPC calls (%zu > %zu) - some calls will not be accounted", subtypeHandlers.size(), Cal::Stats::StatsPage::messageSubtypesCount);
+        }
+    }
+}
+
+void Provider::initializeModuleDiskCache() {
+    if (false == Cal::Utils::getCalEnvFlag(calEnableModuleDiskCacheEnvName, true)) {
+        log<Verbosity::debug>("Module disk cache disabled with %s=0", calEnableModuleDiskCacheEnvName.data());
+        return;
+    }
+
+    auto directory = Cal::Utils::getCalEnv(calModuleDiskCacheDirEnvName) ? std::string(Cal::Utils::getCalEnv(calModuleDiskCacheDirEnvName)) : Cal::Service::LevelZero::ModuleDiskCache::getDefaultDirectory();
+    auto maxSizeMB = Cal::Utils::getCalEnvI64(calModuleDiskCacheMaxSizeEnvName, Cal::Service::LevelZero::ModuleDiskCache::defaultMaxSizeMB);
+    if (maxSizeMB <= 0) {
+        log<Verbosity::debug>("Module disk cache disabled with %s=%lld", calModuleDiskCacheMaxSizeEnvName.data(), static_cast<long long>(maxSizeMB));
+        return;
+    }
+
+    auto diskCache = std::make_unique<Cal::Service::LevelZero::ModuleDiskCache>(directory, static_cast<uint64_t>(maxSizeMB) * Cal::Utils::MB);
+    if (diskCache->isUsable()) {
+        moduleCache.setDiskCache(std::move(diskCache));
+    }
+}
+
+bool Provider::initializeRpcChannelsWorkersPool() {
+    auto workersCount = Cal::Utils::getCalEnvI64(calServiceWorkersCountEnvName, 0);
+    if (workersCount <= 0) {
+        log<Verbosity::debug>("Every RPC channel will be serviced by dedicated thread");
+        return true;
+    }
+
+    auto cpus = RpcChannelsWorkersPool::parseCpuList(Cal::Utils::getCalEnv(calServiceWorkersCpuAffinityEnvName));
+    if (false == cpus.has_value()) {
+        log<Verbosity::critical>("Invalid cpu list in %s=%s", calServiceWorkersCpuAffinityEnvName.data(), Cal::Utils::getCalEnv(calServiceWorkersCpuAffinityEnvName));
+        return false;
+    }
+
+    log<Verbosity::info>("RPC channels of all clients will be serviced by %lld service workers", static_cast<long long>(workersCount));
+    rpcChannelsWorkersPool = std::make_unique<RpcChannelsWorkersPool>(static_cast<size_t>(workersCount), cpus.value());
+    return true;
+}
+
+bool Provider::initializeClientMemoryQuotas() {
+    auto softQuotas = ClientMemoryQuotas::parse(Cal::Utils::getCalEnv(calClientMemorySoftQuotasEnvName));
+    if (false == softQuotas.has_value()) {
+        log<Verbosity::critical>("Invalid list of quotas in %s=%s", calClientMemorySoftQuotasEnvName.data(), Cal::Utils::getCalEnv(calClientMemorySoftQuotasEnvName));
+        return false;
+    }
+    auto hardQuotas = ClientMemoryQuotas::parse(Cal::Utils::getCalEnv(calClientMemoryHardQuotasEnvName));
+    if (false == hardQuotas.has_value()) {
+        log<Verbosity::critical>("Invalid list of quotas in %s=%s", calClientMemoryHardQuotasEnvName.data(), Cal::Utils::getCalEnv(calClientMemoryHardQuotasEnvName));
+        return false;
+    }
+    clientMemoryQuotas.soft = softQuotas.value();
+    clientMemoryQuotas.hard = hardQuotas.value();
+    for (uint32_t kind = 0; kind < Cal::Stats::memoryKindsCount; ++kind) {
+        if (clientMemoryQuotas.soft[kind] || clientMemoryQuotas.hard[kind]) {
+            log<Verbosity::info>("Quotas of %s memory per client : soft %llu MB, hard %llu MB", Cal::Stats::memoryKindNames[kind],
+                                 static_cast<unsigned long long>(clientMemoryQuotas.soft[kind] / Cal::Utils::MB), static_cast<unsigned long long>(clientMemoryQuotas.hard[kind] / Cal::Utils::MB));
+        }
+    }
+    return true;
 }
 
 std::unique_ptr<Cal::Ipc::ConnectionListener> Provider::createConnectionListener() {
@@ -10,17 +10,22 @@
 #include "cal.h"
 #include "level_zero/ze_api.h"
 #include "level_zero/zet_api.h"
+#include "service/client_memory_usage.h"
 #include "service/cochoreographer.h"
+#include "service/direct_transfers.h"
 #include "service/level_zero/artificial_events_manager.h"
 #include "service/level_zero/context_mappings_tracker.h"
 #include "service/level_zero/l0_shared_objects.h"
+#include "service/level_zero/module_disk_cache.h"
 #include "service/level_zero/ongoing_hostptr_copies_manager.h"
+#include "service/rpc_channels_workers_pool.h"
 #include "shared/control_messages.h"
 #include "shared/ipc.h"
 #include "shared/log.h"
 #include "shared/ocl_fat_def.h"
 #include "shared/rpc.h"
 #include "shared/shmem.h"
+#include "shared/stats.h"
 #include "shared/usm.h"
 #include "shared/utils.h"
 
@@ -28,6 +33,7 @@
 #include <bitset>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cstdio>
 #include <future>
 #include <memory>
@@ -149,6 +155,23 @@ class ClientContext {
         rpcChannels.push_back(std::make_pair(std::move(worker), std::move(channel)));
     }
 
+    Cal::Rpc::ChannelServer *getPrimaryRpcChannel() const {
+        return rpcChannels.empty() ? nullptr : rpcChannels[0].second.get();
+    }
+
+    void setStats(std::unique_ptr<Cal::Stats::StatsShmem> stats) {
+        this->stats = std::move(stats);
+        memoryUsage.setStats(this->stats ? &this->stats->getPage().memoryUsage : nullptr);
+    }
+
+    Cal::Stats::StatsPage *getStats() const {
+        return stats ? &stats->getPage() : nullptr;
+    }
+
+    ClientMemoryUsage &getMemoryUsage() {
+        return memoryUsage;
+    }
+
     Cal::Ipc::MmappedShmemAllocationT getShmemById(int id) const {
         auto it = globalShmemsMap.find(id);
         if (it == globalShmemsMap.end()) {
@@ -166,6 +189,8 @@ class ClientContext {
             rpcChannel.first.wait();
         }
         rpcChannels.clear();
+        memoryUsage.setStats(nullptr);
+        stats.reset();
 
         log<Verbosity::debug>("Performing USM shared/host allocations cleanup (num allocations leaked by client : %zu)", usmSharedHostMap.size());
         for (const auto &alloc : usmSharedHostMap) {
@@ -272,6 +297,10 @@ class ClientContext {
         return memoryBlocksManager;
     }
 
+    DirectTransfers &getDirectTransfers() {
+        return directTransfers;
+    }
+
     void *remapPointer(Cal::Ipc::NonUsmMmappedShmemAllocator &nonUsmShmemAllocator, const void *clientAddress, size_t memorySize) {
         auto &memoryBlock = memoryBlocksManager.registerMemoryBlock(nonUsmShmemAllocator, clientAddress, memorySize);
         auto remappedPtr = memoryBlock.translate(clientAddress);
@@ -358,6 +387,7 @@ class ClientContext {
     template <typename HandleT>
     void trackAllocatedResource(HandleT handle, std::unordered_set<HandleT> &tracking) {
         if (handle) {
+            std::lock_guard<std::mutex> lock(resourcesTrackingMtx);
             tracking.insert(handle);
         }
     }
@@ -368,6 +398,7 @@ class ClientContext {
             return;
         }
 
+        std::lock_guard<std::mutex> lock(resourcesTrackingMtx);
         const auto it = tracking.find(handle);
         if (it != tracking.end()) {
             tracking.erase(it);
@@ -385,11 +416,15 @@ class ClientContext {
     std::unordered_map<int, Cal::Ipc::MmappedShmemAllocationT> globalShmemsMap;
     std::unordered_map<void *, UsmSharedHostAlloc> usmSharedHostMap;
     std::vector<std::pair<std::future<void>, std::unique_ptr<Cal::Rpc::ChannelServer>>> rpcChannels;
+    std::unique_ptr<Cal::Stats::StatsShmem> stats;
+    ClientMemoryUsage memoryUsage;
 
     IMember *spectacleAssignment = nullptr;
 
     std::unique_ptr<Apis::Ocl::OclCallbackContextForContextNotify> oclCallbackContextForContextNotify;
 
+    std::mutex resourcesTrackingMtx; // client's RPC channels are serviced concurrently
+
     std::unordered_set<ze_context_handle_t> l0ContextsTracking{};
     std::unordered_set<ze_command_queue_handle_t> l0CommandQueuesTracking{};
     std::unordered_set<ze_command_list_handle_t> l0CommandListsTracking{};
@@ -403,6 +438,7 @@ class ClientContext {
     std::unordered_set<zet_metric_streamer_handle_t> l0MetricStreamersTracking{};
 
     Cal::Ipc::MemoryBlocksManager memoryBlocksManager{};
+    DirectTransfers directTransfers{};
     Cal::Service::LevelZero::ContextMappingsTracker contextMappingsTracker{};
     Cal::Service::LevelZero::ArtificialEventsManager artificialEventsManager{};
     Cal::Service::LevelZero::OngoingHostptrCopiesManager hostptrCopiesManager{};
@@ -424,114 +460,128 @@ class Provider {
 
     Provider(std::unique_ptr<ChoreographyLibrary> knownChoreographies, ServiceConfig &&serviceConfig);
 
-    struct ModuleCache {
-        struct Entry {
-            ze_context_handle_t hContext = {};
+    // Native binaries of compiled modules. Entries are split between shards, each guarded by its own mutex
+    // (held only for lookups, never during compilation), so that builds of different modules proceed in parallel,
+    // while concurrent requests for the same module wait for the single build that is in progress.
+    class ModuleCache {
+      public:
+        static constexpr size_t shardsCount = 16U;
+
+        struct Key {
             ze_device_handle_t hDevice = {};
             ze_module_format_t format = {};
-            ze_module_constants_t constants = {};
             size_t inputSize = {};
-            size_t binaryHash = {};
-            size_t buildOptionsHash = {};
-            uint8_t *pNativeBinary;
-            size_t nativeSize = 0u;
-        };
-        using Cache = std::vector<Entry>;
+            uint64_t inputHash = {};
+            uint64_t buildOptionsHash = {};
+            uint64_t constantsHash = {};
 
-        bool compareDesc(const ze_module_desc_t *desc, const Entry &entry) {
-            auto ret = desc->format == entry.format;
-            ret &= desc->pNext == nullptr;
-            ret &= desc->inputSize == entry.inputSize;
-            if (!ret) {
-                return false;
+            bool operator==(const Key &rhs) const {
+                return (hDevice == rhs.hDevice) && (format == rhs.format) && (inputSize == rhs.inputSize) && (inputHash == rhs.inputHash) && (buildOptionsHash == rhs.buildOptionsHash) && (constantsHash == rhs.constantsHash);
             }
+        };
 
-            ret &= std::hash<std::string>{}(std::string(reinterpret_cast<const char *>(desc->pInputModule), desc->inputSize)) == entry.binaryHash;
-            if (!ret) {
-                return false;
+        struct KeyHash {
+            size_t operator()(const Key &key) const {
+                return static_cast<size_t>(key.inputHash ^ (key.buildOptionsHash * 31U) ^ (key.constantsHash * 131U) ^ std::hash<ze_device_handle_t>{}(key.hDevice));
             }
+        };
 
-            if (desc->pBuildFlags) {
-                ret &= std::hash<std::string>{}(desc->pBuildFlags) == entry.buildOptionsHash;
-            } else {
-                ret &= entry.buildOptionsHash == 0;
+        struct Entry {
+            std::vector<uint8_t> nativeBinary; // empty if build has failed
+            bool isBuilding = true;
+        };
+
+        static std::optional<Key> createKey(ze_device_handle_t hDevice, const ze_module_desc_t *desc) {
+            if ((desc == nullptr) || desc->pNext || (nullptr == desc->pInputModule)) {
+                return std::nullopt;
             }
-            if (!ret) {
-                return false;
+            Key key;
+            key.hDevice = hDevice;
+            key.format = desc->format;
+            key.inputSize = desc->inputSize;
+            key.inputHash = Cal::Utils::StreamingHash64{}.update(desc->pInputModule, desc->inputSize).finalize();
+            key.buildOptionsHash = Cal::Utils::StreamingHash64{}.updateString(desc->pBuildFlags).finalize();
+
+            Cal::Utils::StreamingHash64 constantsHash;
+            uint32_t numConstants = desc->pConstants ? desc->pConstants->numConstants : 0U;
+            constantsHash.update(numConstants);
+            for (uint32_t i = 0; i < numConstants; ++i) {
+                constantsHash.update(desc->pConstants->pConstantIds[i]);
+                constantsHash.update(*static_cast<const uint64_t *>(desc->pConstants->pConstantValues[i]));
+            }
+            key.constantsHash = constantsHash.finalize();
+            return key;
+        }
+
+        // Returns entry of given module and true if caller became responsible for building it (and has to either publish or abandon it).
+        // Otherwise waits until entry built by other thread is ready.
+        std::pair<std::shared_ptr<const Entry>, bool> acquire(const Key &key) {
+            auto &shard = getShard(key);
+            std::unique_lock<std::mutex> lock(shard.mtx);
+            auto it = shard.entries.find(key);
+            if (it == shard.entries.end()) {
+                auto entry = std::make_shared<Entry>();
+                shard.entries.emplace(key, entry);
+                return {entry, true};
             }
 
-            if (desc->pConstants) {
-                ret &= desc->pConstants->numConstants == entry.constants.numConstants;
-                if (ret && (desc->pConstants->numConstants > 0u)) {
-                    ret &= memcmp(desc->pConstants->pConstantIds, entry.constants.pConstantIds, desc->pConstants->numConstants * sizeof(uint32_t)) == 0;
-                    auto values = reinterpret_cast<uint64_t *>(entry.constants.pConstantValues);
-                    for (uint32_t i = 0; i < desc->pConstants->numConstants; ++i) {
-                        ret &= *static_cast<const uint64_t *>(desc->pConstants->pConstantValues[i]) == values[i];
-                    }
-                }
-            } else {
-                ret &= entry.constants.numConstants == 0;
+            auto entry = it->second;
+            if (entry->isBuilding) {
+                log<Verbosity::debug>("Waiting for module which is being built by other client");
+                shard.buildFinished.wait(lock, [&entry]() { return false == entry->isBuilding; });
             }
-            return ret;
+            return {entry, false};
         }
 
-        std::optional<Cache::iterator> find(ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_module_desc_t *desc) {
-            if (desc == nullptr) {
-                return std::nullopt;
-            }
-            for (auto entry = cache.begin(); entry != cache.end(); ++entry) {
-                if (hDevice == entry->hDevice &&
-                    compareDesc(desc, *entry)) {
-                    return entry;
+        void publish(const Key &key, std::vector<uint8_t> &&nativeBinary) {
+            auto &shard = getShard(key);
+            {
+                std::lock_guard<std::mutex> lock(shard.mtx);
+                auto &entry = shard.entries[key];
+                if (nullptr == entry) {
+                    entry = std::make_shared<Entry>();
                 }
+                entry->nativeBinary = std::move(nativeBinary);
+                entry->isBuilding = false;
             }
-            return std::nullopt;
+            shard.buildFinished.notify_all();
         }
 
-        void store(ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_module_desc_t *desc, size_t nativeSize, uint8_t *pNativeBinary) {
-            if (desc == nullptr || desc->pNext) {
-                return;
-            }
-            auto &entry = cache.emplace_back();
-            entry.hContext = hContext;
-            entry.hDevice = hDevice;
-            if (desc->pBuildFlags) {
-                entry.buildOptionsHash = std::hash<std::string>{}(desc->pBuildFlags);
-            }
-            entry.binaryHash = std::hash<std::string>{}(std::string(reinterpret_cast<const char *>(desc->pInputModule), desc->inputSize));
-            entry.nativeSize = nativeSize;
-            entry.pNativeBinary = pNativeBinary;
-            entry.format = desc->format;
-            entry.inputSize = desc->inputSize;
-            if (desc->pConstants && desc->pConstants->numConstants > 0u) {
-                entry.constants.numConstants = desc->pConstants->numConstants;
-                auto ids = new uint32_t[desc->pConstants->numConstants];
-                memcpy(ids, desc->pConstants->pConstantIds, desc->pConstants->numConstants * sizeof(uint32_t));
-                entry.constants.pConstantIds = ids;
-                auto values = new uint64_t[desc->pConstants->numConstants];
-                for (uint32_t i = 0; i < desc->pConstants->numConstants; ++i) {
-                    values[i] = *static_cast<const uint64_t *>(desc->pConstants->pConstantValues[i]);
+        void abandon(const Key &key) {
+            auto &shard = getShard(key);
+            {
+                std::lock_guard<std::mutex> lock(shard.mtx);
+                auto it = shard.entries.find(key);
+                if (it == shard.entries.end()) {
+                    return;
                 }
-                entry.constants.pConstantValues = reinterpret_cast<const void **>(values);
+                it->second->isBuilding = false; // waiters get empty binary and build module on their own
+                shard.entries.erase(it);
             }
+            shard.buildFinished.notify_all();
         }
 
-        [[nodiscard]] auto obtainOwnership() {
-            return std::unique_lock<std::mutex>(mtx);
+        void setDiskCache(std::unique_ptr<Cal::Service::LevelZero::ModuleDiskCache> diskCache) {
+            this->diskCache = std::move(diskCache);
         }
 
-        ~ModuleCache() {
-            for (auto &entry : cache) {
-                delete[] entry.pNativeBinary;
-                delete[] entry.constants.pConstantIds;
-                auto values = reinterpret_cast<uint64_t *>(entry.constants.pConstantValues);
-                delete[] values;
-            }
+        Cal::Service::LevelZero::ModuleDiskCache *getDiskCache() {
+            return diskCache.get();
         }
 
       protected:
-        Cache cache;
-        std::mutex mtx;
+        struct Shard {
+            std::mutex mtx;
+            std::condition_variable buildFinished;
+            std::unordered_map<Key, std::shared_ptr<Entry>, KeyHash> entries;
+        };
+
+        Shard &getShard(const Key &key) {
+            return shards[KeyHash{}(key) % shardsCount];
+        }
+
+        std::array<Shard, shardsCount> shards;
+        std::unique_ptr<Cal::Service::LevelZero::ModuleDiskCache> diskCache;
     } moduleCache;
 
     int run() {
@@ -568,6 +618,18 @@ class Provider {
             return -1;
         }
 
+        if (systemInfo.availableApis.l0) {
+            initializeModuleDiskCache();
+        }
+
+        if (false == initializeRpcChannelsWorkersPool()) {
+            return -1;
+        }
+
+        if (false == initializeClientMemoryQuotas()) {
+            return -1;
+        }
+
         auto cpuInfoOpt = Cal::Utils::CpuInfo::read();
         if (cpuInfoOpt) {
             this->systemInfo.cpuInfo = cpuInfoOpt.value();
@@ -620,6 +682,7 @@ class Provider {
         for (auto &c : clients) {
             c.wait();
         }
+        rpcChannelsWorkersPool.reset();
         return Success;
     }
 
@@ -825,6 +888,18 @@ class Provider {
         return this->batchedService;
     }
 
+    bool useStats() const {
+        return this->statsEnabled;
+    }
+
+    bool useDirectTransfers() const {
+        return this->directTransfers;
+    }
+
+    const ClientMemoryQuotas &getClientMemoryQuotas() const {
+        return this->clientMemoryQuotas;
+    }
+
   protected:
     ServiceConfig serviceConfig;
     struct {
@@ -832,6 +907,7 @@ class Provider {
         std::future<void> subprocess;
     } runnerConfig;
     std::unique_ptr<Cal::Ipc::ConnectionListener> listener;
+    std::unique_ptr<RpcChannelsWorkersPool> rpcChannelsWorkersPool;
     int32_t defaultSharedVaSizeInGB = staticDefaultSharedVaSizeGB;
     int32_t defaultRpcMessageChannelSizeMB = staticDefaultRpcMessageChannelSizeMB;
     int32_t sharedVaArenaSizeMB = staticSharedVaArenaSizeMB;
@@ -841,6 +917,9 @@ class Provider {
     std::atomic_int activeClients = 0;
     bool syncMallocCopy = false;
     bool batchedService = false;
+    bool statsEnabled = true;
+    bool directTransfers = false;
+    ClientMemoryQuotas clientMemoryQuotas;
     struct {
         Cal::Service::Apis::Ocl::OclSharedObjects ocl;
         Cal::Service::Apis::LevelZero::L0SharedObjects l0;
@@ -894,6 +973,9 @@ class Provider {
     } commandQueueGroups;
 
     std::unique_ptr<Cal::Ipc::ConnectionListener> createConnectionListener();
+    void initializeModuleDiskCache();
+    bool initializeRpcChannelsWorkersPool();
+    bool initializeClientMemoryQuotas();
 
     bool isClientSupported(Cal::ApiType clientApiType) {
         return ((clientApiType == Cal::ApiType::OpenCL) && systemInfo.availableApis.ocl) || ((clientApiType == Cal::ApiType::LevelZero) && systemInfo.availableApis.l0);
@@ -948,14 +1030,27 @@ class Provider {
             return;
         }
 
+        std::unique_ptr<Cal::Stats::StatsShmem> stats;
+        if (service.useStats()) {
+            // needs to exist before handshake completes, so that client can open it
+            stats = Cal::Stats::StatsShmem::create(getpid(), clientOrdinal, handshake.pid, handshake.clientProcessName);
+        }
+
         auto handshakeResp = service.getConfig();
         handshakeResp.assignedClientOrdinal = clientOrdinal;
+        handshakeResp.memfdShmem = service.getGlobalShmemAllocators().getBaseAllocator().usesMemfd();
+        handshakeResp.directTransfers = service.useDirectTransfers();
         if (false == clientConnection->send(handshakeResp)) {
             log<Verbosity::error>("Failed to send service config to client #%d", clientConnection->getId());
             return;
         }
         log<Verbosity::info>("Handshake with client #%d has SUCCEEDED (pid:%d, ppid:%d, process:%s)", clientConnection->getId(), handshake.pid, handshake.ppid, handshake.clientProcessName);
         ClientContext ctx(service.getGlobalShmemAllocators(), isPersistentMode);
+        ctx.getMemoryUsage().setQuotas(service.getClientMemoryQuotas());
+        ctx.setStats(std::move(stats));
+        if (service.useDirectTransfers()) {
+            ctx.getDirectTransfers().enable(handshake.pid);
+        }
         service.assignToSpectacle(handshake.ppid, handshake.pid, handshake.clientProcessName, ctx);
         if (ctx.getSpectacleAssignment()) {
             log<Verbosity::debug>("Client #%d was assigned to a spectacle %p", clientConnection->getId(), ctx.getSpectacleAssignment());
@@ -1042,7 +1137,7 @@ class Provider {
             return service(request, clientConnection, ctx);
         }
         case Cal::Messages::ReqPageFault::messageSubtype: {
-            Cal::Messages::ReqPageFault request(nullptr);
+            Cal::Messages::ReqPageFault request(nullptr, 0);
             if ((false == clientConnection.receive(request)) || request.isInvalid()) {
                 log<Verbosity::error>("Client : %d sent broken CAL request message (subtype:ReqPageFault)", clientConnection.getId());
                 return false;
@@ -1073,9 +1168,34 @@ class Provider {
             }
             return service(request, clientConnection, ctx);
         }
+        case Cal::Messages::ReqImportShmem::messageSubtype: {
+            Cal::Messages::ReqImportShmem request{-1};
+            if ((false == clientConnection.receive(request)) || request.isInvalid()) {
+                log<Verbosity::error>("Client : %d sent broken CAL request message (subtype:ReqImportShmem)", clientConnection.getId());
+                return false;
+            }
+            return service(request, clientConnection, ctx);
+        }
         }
     }
 
+    bool service(const Cal::Messages::ReqImportShmem &request, Cal::Ipc::Connection &clientConnection, ClientContext &ctx) {
+        log<Verbosity::debug>("Client : %d requested import of shmem %d", clientConnection.getId(), request.id);
+        return globalShmemAllocators->getBaseAllocator().withMemfd(request.id, [&](int fd) {
+            Cal::Messages::RespImportShmem response;
+            response.available = (-1 != fd);
+            if (false == clientConnection.send(response)) {
+                log<Verbosity::error>("Could not send response for ReqImportShmem!");
+                return false;
+            }
+            if (response.available && (false == clientConnection.sendFds(&fd, 1))) {
+                log<Verbosity::error>("Could not send FD of shmem %d to the client!", request.id);
+                return false;
+            }
+            return true;
+        });
+    }
+
     bool service(const Cal::Messages::ReqReverseTransferFd &request, Cal::Ipc::Connection &clientConnection, ClientContext &ctx) {
         log<Verbosity::debug>("Client : %d requested reverse transfer of FDs!", clientConnection.getId());
 
@@ -1109,9 +1229,12 @@ class Provider {
     }
 
     bool service(const Cal::Messages::ReqPageFault &request, Cal::Ipc::Connection &clientConnection, ClientContext &ctx) {
-        log<Verbosity::debug>("Client : %d requested page fault on address: %p", clientConnection.getId(), request.ptr);
-        auto ptr = reinterpret_cast<const char *>(request.ptr);
-        [[maybe_unused]] auto volatile pageFaultRead = ptr[0];
+        log<Verbosity::debug>("Client : %d requested page fault on address: %p (size : %llu)", clientConnection.getId(), request.ptr, static_cast<unsigned long long>(request.size));
+        auto ptr = reinterpret_cast<const volatile char *>(request.ptr);
+        // touch every page of the range, so that the driver migrates all of it to host
+        for (uint64_t offset = 0; offset < request.size; offset += Cal::Utils::pageSize4KB) {
+            [[maybe_unused]] auto pageFaultRead = ptr[offset];
+        }
 
         Cal::Messages::RespPageFault resp;
         clientConnection.send(resp);
@@ -1133,6 +1256,11 @@ class Provider {
             }
         }
 
+        if (false == ctx.getMemoryUsage().tryCharge(Cal::Stats::MemoryKind::shmem, size, request.sharedVa)) {
+            Cal::Messages::RespAllocateShmem shmemResponse;
+            return clientConnection.send(shmemResponse);
+        }
+
         Cal::Ipc::MmappedShmemAllocationT shmem;
         if (request.sharedVa) {
             auto ctxLock = ctx.lock();
@@ -1143,10 +1271,12 @@ class Provider {
                 }
             }
         } else {
-            shmem = globalShmemAllocators->getNonUsmMmappedAllocator().allocate(size);
+            auto alignment = std::max(Cal::Ipc::NonUsmMmappedShmemAllocator::minAlignment, globalShmemAllocators->getBaseAllocator().getHugePageSize());
+            shmem = globalShmemAllocators->getNonUsmMmappedAllocator().allocate(size, alignment);
         }
 
         if (false == shmem.isValid()) {
+            ctx.getMemoryUsage().release(Cal::Stats::MemoryKind::shmem, size, request.sharedVa);
             Cal::Messages::RespAllocateShmem shmemResponse;
             log<Verbosity::debug>("Client : %d requested shmem (purpose : %s, size : %zu, shared : %s) could not be allocated", clientConnection.getId(), request.purposeStr(), request.size, request.sharedVa ? "TRUE" : "FALSE");
             return clientConnection.send(shmemResponse);
@@ -1169,8 +1299,13 @@ class Provider {
         log<Verbosity::debug>("Client : %d requested RPC ring buffer", clientConnection.getId());
 
         auto serviceSynchronizationMethod = Cal::Messages::RespLaunchRpcShmemRingBuffer::activePolling;
-        if (Cal::Utils::getCalEnvFlag(calUseSemaphoresInChannelServerEnvName, true)) {
-            serviceSynchronizationMethod = Cal::Messages::RespLaunchRpcShmemRingBuffer::semaphores;
+        if (nullptr == rpcChannelsWorkersPool) { // workers of the pool poll all channels, so clients don't need to signal new commands
+            if (Cal::Utils::getCalEnvFlag(calUseSemaphoresInChannelServerEnvName, true)) {
+                serviceSynchronizationMethod = Cal::Messages::RespLaunchRpcShmemRingBuffer::semaphores;
+            }
+            if (Cal::Utils::getCalEnvFlag(calUseFutexInChannelServerEnvName, false)) {
+                serviceSynchronizationMethod = Cal::Messages::RespLaunchRpcShmemRingBuffer::futex;
+            }
         }
 
         auto clientCtxLock = ctx.lock();
@@ -1185,6 +1320,10 @@ class Provider {
             log<Verbosity::error>("Failed to initialize channel server for client : %d", clientConnection.getId());
             return false;
         }
+        if (auto primaryChannel = ctx.getPrimaryRpcChannel()) {
+            log<Verbosity::debug>("Callbacks from RPC ring buffer %d of client %d will be forwarded to primary channel : %d", shmem.getShmemId(), clientConnection.getId(), primaryChannel->getId());
+            channelServer->forwardCallbacksTo(*primaryChannel);
+        }
 
         log<Verbosity::debug>("Initialized RPC ring buffer for client : %d", clientConnection.getId());
         Cal::Messages::RespLaunchRpcShmemRingBuffer response;
@@ -1194,8 +1333,19 @@ class Provider {
             return false;
         }
 
-        log<Verbosity::debug>("Spawning thread for new RPC ring buffer %d  of client %d", shmem.getShmemId(), clientConnection.getId());
-        auto worker = std::async(std::launch::async, Provider::serviceSingleRpcChannel, channelServer.get(), std::ref(ctx), std::ref(*this));
+        std::future<void> worker;
+        if (rpcChannelsWorkersPool) {
+            log<Verbosity::debug>("Adding new RPC ring buffer %d of client %d to service workers pool", shmem.getShmemId(), clientConnection.getId());
+            worker = rpcChannelsWorkersPool->add(channelServer.get(), [channel = channelServer.get(), &ctx, this, brokenChannel = false](Cal::Rpc::ChannelServer::CommandPacket &newCommand) mutable {
+                if (ctx.isClientStopping()) {
+                    return false;
+                }
+                return Provider::serviceSingleRpcCommandPacket(channel, ctx, *this, newCommand, brokenChannel);
+            });
+        } else {
+            log<Verbosity::debug>("Spawning thread for new RPC ring buffer %d  of client %d", shmem.getShmemId(), clientConnection.getId());
+            worker = std::async(std::launch::async, Provider::serviceSingleRpcChannel, channelServer.get(), std::ref(ctx), std::ref(*this));
+        }
         ctx.registerRpcChannel(std::move(worker),
                                std::move(channelServer));
 
@@ -1278,9 +1428,6 @@ class Provider {
 
     static void serviceSingleRpcChannel(Cal::Rpc::ChannelServer *channel, ClientContext &ctx, Provider &service) {
         log<Verbosity::debug>("Starting to service RPC channel : %d", channel->getId());
-        static std::shared_mutex batchedMtx;
-        static std::thread::id mtxOwner{};
-        bool sharedLock = false;
         bool brokenChannel = false;
         while (false == ctx.isClientStopping()) {
             auto newCommand = channel->wait(service.getYieldThreads());
@@ -1289,49 +1436,64 @@ class Provider {
                 continue;
             }
 
-            auto *header = reinterpret_cast<Cal::Rpc::RpcMessageHeader *>(newCommand.command);
-            log<Verbosity::debug>("Received new RPC command request on channel : %d (type : %u, subtype %u)", channel->getId(), header->type, header->subtype);
+            serviceSingleRpcCommandPacket(channel, ctx, service, newCommand, brokenChannel);
 
-            if (service.useBatched()) {
-                if (header->flags & Cal::Rpc::RpcMessageHeader::batched) {
-                    if (mtxOwner != std::this_thread::get_id()) {
-                        batchedMtx.lock();
-                        mtxOwner = std::this_thread::get_id();
-                    }
-                } else {
-                    if (mtxOwner == std::this_thread::get_id()) {
-                        mtxOwner = std::thread::id{};
-                        batchedMtx.unlock();
-                    } else {
-                        batchedMtx.lock_shared();
-                        sharedLock = true;
-                    }
-                }
+            if (service.getYieldThreads()) {
+                std::this_thread::yield();
             }
+        }
+        log<Verbosity::debug>("Stopping servicing RPC channel : %d", channel->getId());
+    }
+
+    // returns true if calling thread holds exclusive batched lock (i.e. has to keep servicing this channel until batch ends)
+    static bool serviceSingleRpcCommandPacket(Cal::Rpc::ChannelServer *channel, ClientContext &ctx, Provider &service, Cal::Rpc::ChannelServer::CommandPacket &newCommand, bool &brokenChannel) {
+        static std::shared_mutex batchedMtx;
+        static std::thread::id mtxOwner{};
+        bool sharedLock = false;
+
+        auto *header = reinterpret_cast<Cal::Rpc::RpcMessageHeader *>(newCommand.command);
+        log<Verbosity::debug>("Received new RPC command request on channel : %d (type : %u, subtype %u)", channel->getId(), header->type, header->subtype);
 
-            if (false == brokenChannel) {
-                if (false == service.serviceSingleRpcCommand(*channel, ctx, header, newCommand.commandMaxSize)) {
-                    log<Verbosity::error>("Channel : %d is broken", channel->getId(), header->type, header->subtype);
-                    brokenChannel = true;
+        if (service.useBatched()) {
+            if (header->flags & Cal::Rpc::RpcMessageHeader::batched) {
+                if (mtxOwner != std::this_thread::get_id()) {
+                    batchedMtx.lock();
+                    mtxOwner = std::this_thread::get_id();
                 }
             } else {
-                log<Verbosity::error>("Ignoring new RPC command request on broken channel : %d (type : %u, subtype %u)", channel->getId(), header->type, header->subtype);
+                if (mtxOwner == std::this_thread::get_id()) {
+                    mtxOwner = std::thread::id{};
+                    batchedMtx.unlock();
+                } else {
+                    batchedMtx.lock_shared();
+                    sharedLock = true;
+                }
             }
+        }
 
-            if (newCommand.completionStamp) {
-                channel->signalCompletion(newCommand.completionStamp, header->flags);
+        if (false == brokenChannel) {
+            auto callStats = ctx.getStats() ? ctx.getStats()->getServiced(*header) : nullptr;
+            auto callStartNs = callStats ? Cal::Stats::getTimestampNs() : 0U;
+            if (false == service.serviceSingleRpcCommand(*channel, ctx, header, newCommand.commandMaxSize)) {
+                log<Verbosity::error>("Channel : %d is broken", channel->getId(), header->type, header->subtype);
+                brokenChannel = true;
             }
-
-            if (sharedLock) {
-                sharedLock = false;
-                batchedMtx.unlock_shared();
+            if (callStats) {
+                callStats->record(Cal::Stats::getTimestampNs() - callStartNs, channel->acquireHostptrCopiesBytesCount());
             }
+        } else {
+            log<Verbosity::error>("Ignoring new RPC command request on broken channel : %d (type : %u, subtype %u)", channel->getId(), header->type, header->subtype);
+        }
 
-            if (service.getYieldThreads()) {
-                std::this_thread::yield();
-            }
+        if (newCommand.completionStamp) {
+            channel->signalCompletion(newCommand.completionStamp, header->flags);
         }
-        log<Verbosity::debug>("Stopping servicing RPC channel : %d", channel->getId());
+
+        if (sharedLock) {
+            batchedMtx.unlock_shared();
+        }
+
+        return mtxOwner == std::this_thread::get_id();
     }
 
     bool serviceSingleRpcCommand(Cal::Rpc::ChannelServer &channel, ClientContext &ctx, Cal::Rpc::RpcMessageHeader *command, size_t commandMaxSize) {
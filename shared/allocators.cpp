@@ -9,46 +9,167 @@
 
 namespace Cal::Allocators {
 
+std::optional<uintptr_t> RangeAllocatorBase::findFreeRange(size_t sizeInBytes, size_t alignment) const {
+    if (freeRangesByAddress.empty()) {
+        return std::nullopt;
+    }
+
+    auto top = freeRangesByAddress.rbegin();
+    if (top->second == bounds.end) {
+        if (auto addr = fitAligned(top->first, top->second, sizeInBytes, alignment)) {
+            return addr;
+        }
+    }
+
+    // best fit - smallest free ranges that can hold sizeInBytes, as long as their start is suitably aligned
+    auto candidate = freeRangesBySize.lower_bound({sizeInBytes, 0U});
+    for (size_t i = 0; (i < maxMisalignedCandidates) && (candidate != freeRangesBySize.end()); ++i, ++candidate) {
+        if (auto addr = fitAligned(candidate->second, candidate->second + candidate->first, sizeInBytes, alignment)) {
+            return addr;
+        }
+    }
+
+    // any range that is this big will fit the request regardless of its alignment
+    auto worstCaseSize = sizeInBytes + std::max<size_t>(alignment, 1U) - 1U;
+    if (worstCaseSize < sizeInBytes) {
+        return std::nullopt;
+    }
+    candidate = freeRangesBySize.lower_bound({worstCaseSize, 0U});
+    if (candidate == freeRangesBySize.end()) {
+        return std::nullopt;
+    }
+    return fitAligned(candidate->second, candidate->second + candidate->first, sizeInBytes, alignment);
+}
+
+void RangeAllocatorBase::commitRange(Cal::Utils::AddressRange range) {
+    auto freeRange = freeRangesByAddress.upper_bound(range.start);
+    if (freeRange == freeRangesByAddress.begin()) {
+        log<Verbosity::error>("Attempted to commit range that is not free");
+        return;
+    }
+    --freeRange;
+    if ((freeRange->first > range.start) || (freeRange->second < range.end)) {
+        log<Verbosity::error>("Attempted to commit range that is not free");
+        return;
+    }
+
+    auto freeStart = freeRange->first;
+    auto freeEnd = freeRange->second;
+    eraseFreeRange(freeRange);
+    if (freeStart < range.start) {
+        insertFreeRange(freeStart, range.start);
+    }
+    if (range.end < freeEnd) {
+        insertFreeRange(range.end, freeEnd);
+    }
+
+    allocatedRanges.emplace(range.start, range.end);
+    sizeUsed += range.size();
+}
+
+void RangeAllocatorBase::freeRange(void *rangeBase) {
+    auto range = findAllocatedRange(reinterpret_cast<uintptr_t>(rangeBase));
+    if (range == allocatedRanges.end()) {
+        log<Verbosity::error>("Attempted to free non-allocated range");
+        return;
+    }
+
+    auto start = range->first;
+    auto end = range->second;
+    allocatedRanges.erase(range);
+    sizeUsed -= end - start;
+
+    // coalesce with adjacent free ranges
+    auto next = freeRangesByAddress.lower_bound(end);
+    if ((next != freeRangesByAddress.end()) && (next->first == end)) {
+        end = next->second;
+        eraseFreeRange(next);
+    }
+    auto prev = freeRangesByAddress.lower_bound(start);
+    if ((prev != freeRangesByAddress.begin()) && (std::prev(prev)->second == start)) {
+        --prev;
+        start = prev->first;
+        eraseFreeRange(prev);
+    }
+    insertFreeRange(start, end);
+}
+
+size_t RangeAllocatorBase::resizeRange(void *rangeBase, size_t newSize, size_t &oldSize) {
+    auto range = findAllocatedRange(reinterpret_cast<uintptr_t>(rangeBase));
+    if (range == allocatedRanges.end()) {
+        return 0;
+    }
+
+    auto prevSize = range->second - range->first;
+    oldSize = prevSize;
+    if (prevSize == newSize) { // same size
+        return newSize;
+    }
+
+    if (newSize < prevSize) { // make the range smaller
+        auto tailStart = range->first + newSize;
+        auto tailEnd = range->second;
+        range->second = tailStart;
+        sizeUsed -= tailEnd - tailStart;
+
+        auto next = freeRangesByAddress.lower_bound(tailEnd);
+        if ((next != freeRangesByAddress.end()) && (next->first == tailEnd)) {
+            tailEnd = next->second;
+            eraseFreeRange(next);
+        }
+        insertFreeRange(tailStart, tailEnd);
+        return newSize;
+    }
+
+    auto next = freeRangesByAddress.find(range->second);
+    if ((next == freeRangesByAddress.end()) || (next->second - next->first < newSize - prevSize)) {
+        return prevSize; // no place to grow
+    }
+
+    auto growEnd = range->first + newSize;
+    auto freeEnd = next->second;
+    eraseFreeRange(next);
+    if (growEnd < freeEnd) {
+        insertFreeRange(growEnd, freeEnd);
+    }
+    range->second = growEnd;
+    sizeUsed += newSize - prevSize;
+    return newSize;
+}
+
+RangeAllocatorBase::RangesByAddressT::iterator RangeAllocatorBase::findAllocatedRange(uintptr_t address) {
+    auto range = allocatedRanges.upper_bound(address);
+    if (range == allocatedRanges.begin()) {
+        return allocatedRanges.end();
+    }
+    --range;
+    return (address < range->second) ? range : allocatedRanges.end();
+}
+
+void RangeAllocatorBase::insertFreeRange(uintptr_t start, uintptr_t end) {
+    freeRangesByAddress.emplace(start, end);
+    freeRangesBySize.emplace(end - start, start);
+}
+
+void RangeAllocatorBase::eraseFreeRange(RangesByAddressT::iterator range) {
+    freeRangesBySize.erase({range->second - range->first, range->first});
+    freeRangesByAddress.erase(range);
+}
+
 Cal::Utils::AddressRange RangeAllocator::allocate(size_t sizeInBytes, size_t alignment) {
     if (this->getSizeLeft() < sizeInBytes) {
         return Cal::Utils::AddressRange::createEmpty();
     }
 
-    void *const invalidAddr = reinterpret_cast<void *>(std::numeric_limits<uintptr_t>::max());
-    const auto &vma = this->getVma();
-    void *addr = invalidAddr;
-    if (vma.getSubRanges().empty()) {
-        addr = vma.getBoundingRange().base();
-    } else {
-        addr = vma.getSubRanges().rbegin()->getBoundingRange().rightBound();
-    }
-
-    addr = Cal::Utils::alignUp(addr, alignment);
-
-    if (false == vma.getBoundingRange().contains({addr, sizeInBytes})) {
-        if (Cal::Utils::alignUp(vma.getSubRanges().begin()->getBoundingRange().start, alignment) - vma.getBoundingRange().start >= sizeInBytes) {
-            addr = Cal::Utils::alignUp(vma.getBoundingRange().base(), alignment);
-        } else {
-            addr = invalidAddr;
-            auto prev = vma.getSubRanges().begin();
-            auto it = prev + 1;
-            while (it != vma.getSubRanges().end()) {
-                if (it->getBoundingRange().start - Cal::Utils::alignUp(prev->getBoundingRange().end, alignment) >= sizeInBytes) {
-                    addr = Cal::Utils::alignUp(prev->getBoundingRange().rightBound(), alignment);
-                    break;
-                }
-                prev = it;
-                ++it;
-            }
-            if (invalidAddr == addr) {
-                log<Verbosity::debug>("Failed to allocate range");
-                return Cal::Utils::AddressRange::createEmpty();
-            }
-        }
+    auto addr = this->findFreeRange(sizeInBytes, alignment);
+    if (false == addr.has_value()) {
+        log<Verbosity::debug>("Failed to allocate range");
+        return Cal::Utils::AddressRange::createEmpty();
     }
 
-    commitRange({addr, sizeInBytes});
-    return {addr, sizeInBytes};
+    Cal::Utils::AddressRange range{addr.value(), addr.value() + sizeInBytes};
+    commitRange(range);
+    return range;
 }
 
 Cal::Utils::AddressRange RangeAllocator::resizeOrAllocate(void *rangeBase, size_t newSize, size_t alignment, size_t &oldSize) {
@@ -61,12 +182,7 @@ Cal::Utils::AddressRange RangeAllocator::resizeOrAllocate(void *rangeBase, size_
         return Cal::Utils::AddressRange{rangeBase, resizedSize};
     }
 
-    auto newRange = this->allocate(newSize, alignment);
-    if (newRange.empty()) {
-        return {};
-    }
-
-    return newRange.base();
+    return this->allocate(newSize, alignment);
 }
 
 } // namespace Cal::Allocators
@@ -7,11 +7,21 @@
 
 #pragma once
 
+#include "shared/idle_trimmer.h"
 #include "shared/log.h"
 #include "shared/sys.h"
 #include "shared/utils.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <set>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -209,16 +219,82 @@ class LinearAllocator {
     size_t sizeUsed = 0u;
 };
 
+// Allocations are released in the same order they were made (FIFO), by reclaiming
+// all space up to a marker obtained from getAllocationsEnd() - e.g. once commands that used it are completed.
+// Space is reused in a circular manner, allocations never wrap around the end of the range.
+class CircularAllocator {
+  public:
+    using MarkerT = uint64_t;
+
+    CircularAllocator() = default;
+    CircularAllocator(Cal::Utils::AddressRange vaRange) : vaRange(vaRange){};
+
+    // returns nullptr if there's not enough unreclaimed space
+    void *allocate(size_t sizeInBytes, size_t alignment) {
+        const auto capacity = this->vaRange.size();
+        const auto size = Cal::Utils::alignUp(sizeInBytes, alignment);
+        auto offset = static_cast<size_t>(this->allocationsEnd % capacity);
+        auto addrAligned = Cal::Utils::alignUp(this->vaRange.start + offset, alignment);
+        auto padding = addrAligned - (this->vaRange.start + offset);
+        if (offset + padding + size > capacity) { // skip remaining space at the end of the range
+            addrAligned = Cal::Utils::alignUp(this->vaRange.start, alignment);
+            padding = (capacity - offset) + (addrAligned - this->vaRange.start);
+        }
+
+        auto newAllocationsEnd = this->allocationsEnd + padding + size;
+        if (newAllocationsEnd - this->reclaimedEnd > capacity) {
+            return nullptr;
+        }
+        this->allocationsEnd = newAllocationsEnd;
+        return reinterpret_cast<void *>(addrAligned);
+    }
+
+    MarkerT getAllocationsEnd() const {
+        return allocationsEnd;
+    }
+
+    // releases all allocations made before given marker was obtained
+    void reclaim(MarkerT marker) {
+        if (marker > this->reclaimedEnd) {
+            this->reclaimedEnd = std::min(marker, this->allocationsEnd);
+        }
+    }
+
+    void free() {
+        this->reclaimedEnd = this->allocationsEnd;
+    }
+
+    size_t getSizeUsed() const {
+        return static_cast<size_t>(this->allocationsEnd - this->reclaimedEnd);
+    }
+
+    Cal::Utils::AddressRange getRange() const {
+        return vaRange;
+    }
+
+  protected:
+    Cal::Utils::AddressRange vaRange = Cal::Utils::AddressRange::createEmpty();
+    MarkerT allocationsEnd = 0U; // monotonic, offset within range is allocationsEnd % range size
+    MarkerT reclaimedEnd = 0U;
+};
+
+// Free ranges are indexed both by address (for coalescing on free and for growing ranges in place) and by size
+// (for best-fit search), so allocations and frees take O(log n) regardless of the number of live ranges.
+// Top of the range is used for as long as it fits the requests - this keeps ranges growable in place (e.g. realloc)
+// and freed ranges are reused only once it is exhausted (best-fit, so that big free ranges are not split needlessly).
 class RangeAllocatorBase {
   public:
-    RangeAllocatorBase() : vma({0U, 0U}) {
+    RangeAllocatorBase() : bounds(uintptr_t{0U}, uintptr_t{0U}) {
     }
 
-    RangeAllocatorBase(Cal::Utils::AddressRange vaRange) : vma(vaRange) {
+    RangeAllocatorBase(Cal::Utils::AddressRange vaRange) : bounds(vaRange) {
+        if (false == bounds.empty()) {
+            insertFreeRange(bounds.start, bounds.end);
+        }
     }
 
     Cal::Utils::AddressRange getRange() const {
-        return vma.getBoundingRange();
+        return bounds;
     }
 
     size_t getSizeUsed() const {
@@ -226,62 +302,46 @@ class RangeAllocatorBase {
     }
 
     size_t getSizeLeft() const {
-        return vma.getBoundingRange().size() - sizeUsed;
+        return bounds.size() - sizeUsed;
     }
 
-  protected:
-    const Cal::Utils::PartitionedAddressRange<void> &getVma() const {
-        return vma;
+    size_t getLargestFreeRangeSize() const {
+        return freeRangesBySize.empty() ? 0U : freeRangesBySize.rbegin()->first;
     }
 
-    void commitRange(Cal::Utils::AddressRange range) {
-        vma.insertSubRange(range);
-        sizeUsed += range.size();
+    size_t getFreeRangesCount() const {
+        return freeRangesByAddress.size();
     }
 
-    void freeRange(void *rangeBase) {
-        auto range = vma.findSubRange({rangeBase});
-        if (nullptr == range) {
-            log<Verbosity::error>("Attempted to free non-allocated range");
-            return;
+  protected:
+    // returns aligned start of sizeInBytes long range that fits in [gapStart, gapEnd)
+    static std::optional<uintptr_t> fitAligned(uintptr_t gapStart, uintptr_t gapEnd, size_t sizeInBytes, size_t alignment) {
+        auto alignedStart = Cal::Utils::alignUp(gapStart, alignment);
+        if ((alignedStart < gapStart) || (alignedStart > gapEnd) || (gapEnd - alignedStart < sizeInBytes)) {
+            return std::nullopt;
         }
-
-        auto bounds = range->getBoundingRange();
-        vma.destroySubRange(bounds);
-        sizeUsed -= bounds.size();
+        return alignedStart;
     }
 
-    size_t resizeRange(void *rangeBase, size_t newSize, size_t &oldSize) { // return new size
-        auto *prevRange = vma.findSubRange(Cal::Utils::AddressRange{rangeBase});
-        if (nullptr == prevRange) {
-            return 0;
-        }
+    std::optional<uintptr_t> findFreeRange(size_t sizeInBytes, size_t alignment) const;
+    void commitRange(Cal::Utils::AddressRange range);
+    void freeRange(void *rangeBase);
+    size_t resizeRange(void *rangeBase, size_t newSize, size_t &oldSize); // return new size
 
-        auto prevSize = prevRange->getBoundingRange().size();
-        oldSize = prevSize;
-        if (prevSize == newSize) { // same size
-            return newSize;
-        }
-        if (newSize < prevSize) { // make the range smaller
-            auto rangeToDelete = prevRange->getBoundingRange();
-            rangeToDelete.start += newSize;
-            vma.destroySubRange(rangeToDelete);
-            return newSize;
-        }
+  private:
+    using RangesByAddressT = std::map<uintptr_t, uintptr_t>; // start -> end
 
-        auto rangeToAllocate = prevRange->getBoundingRange();
-        rangeToAllocate.end += newSize - prevSize;
-        rangeToAllocate.start += prevSize;
-        if (vma.intersectsSubRanges(rangeToAllocate)) { // check if room for grow
-            return prevSize;                            // no place to grow
-        }
+    RangesByAddressT::iterator findAllocatedRange(uintptr_t address);
+    void insertFreeRange(uintptr_t start, uintptr_t end);
+    void eraseFreeRange(RangesByAddressT::iterator range);
 
-        prevRange->insertSubRange(rangeToAllocate); // grow
-        return newSize;
-    }
+    // free ranges with too small alignment that are checked before falling back to range that fits any alignment
+    static constexpr size_t maxMisalignedCandidates = 8U;
 
-  private:
-    Cal::Utils::PartitionedAddressRange<void> vma;
+    Cal::Utils::AddressRange bounds;
+    RangesByAddressT allocatedRanges;
+    RangesByAddressT freeRangesByAddress;
+    std::set<std::pair<size_t, uintptr_t>> freeRangesBySize; // size, start
     size_t sizeUsed = 0U;
 };
 
@@ -640,6 +700,18 @@ class SubAllocator final {
         return rangeAllocator->getSizeLeft();
     }
 
+    bool isUnused() {
+        auto rangeAllocatorLock = rangeAllocator.lock();
+        return 0U == rangeAllocator->getSizeUsed();
+    }
+
+    // func is called under lock, so that nothing can be allocated from this sub-allocator until it returns
+    template <typename FuncT>
+    bool runIfUnused(FuncT &&func) {
+        auto rangeAllocatorLock = rangeAllocator.lock();
+        return (0U == rangeAllocator->getSizeUsed()) && func();
+    }
+
     Cal::Utils::OffsetRange getOffsetRange() const {
         return rangeAllocator->getRange();
     }
@@ -660,6 +732,22 @@ struct UnmapConfig {
     MmapConfig resetTraits;
 };
 
+// Mappings aligned to at least 2MB are meant to be backed by hugepages - sizes that are multiples of 1GB get aligned
+// to 1GB, so that they can use gigantic pages where these are available.
+inline size_t getHugePageAlignment(size_t size, size_t alignment) {
+    if ((alignment >= Cal::Utils::pageSize2MB) && Cal::Utils::isAlignedPow2<Cal::Utils::pageSize1GB>(size)) {
+        return std::max(alignment, Cal::Utils::pageSize1GB);
+    }
+    return alignment;
+}
+
+// transparent hugepages are only a hint - without them, mapping is simply backed by regular pages
+inline void adviseHugePages(void *ptr, size_t size) {
+    if (-1 == Cal::Sys::madvise(ptr, size, MADV_HUGEPAGE)) {
+        log<Verbosity::debug>("Could not advise hugepages for range %p of size : %zu", ptr, size);
+    }
+}
+
 template <typename AllocationT>
 static size_t getFdOffset(const AllocationT &alloc) {
     if constexpr (AllocationT::isFdSubAllocation) {
@@ -712,22 +800,22 @@ class AllocatorWithGlobalMmapToFd {
             return {};
         }
 
+        alignment = getHugePageAlignment(size, alignment);
         auto baseAlloc = underlyingAllocator.allocate(size, alignment);
         if (baseAlloc.isValid() == false) {
             return {};
         }
-        if (alignment > Cal::Utils::pageSize4KB) {
-            log<Verbosity::error>("Unsupported alignment %zu > %zu", alignment, Cal::Utils::pageSize4KB);
-            return {};
-        }
         auto fd = baseAlloc.getFd();
         auto fdOffset = getFdOffset(baseAlloc);
-        void *mmappedPtr = Cal::Sys::mmap(nullptr, size, mmapConfig.prot, mmapConfig.flags, fd, fdOffset);
+        void *mmappedPtr = mmapAligned(size, alignment, fd, fdOffset);
         if (MAP_FAILED == mmappedPtr) {
-            log<Verbosity::error>("Failed to mmap allocation of size : %zu to fd : %d at offset %zu", size, fd, fdOffset);
+            log<Verbosity::error>("Failed to mmap allocation of size : %zu (alignment : %zu) to fd : %d at offset %zu", size, alignment, fd, fdOffset);
             underlyingAllocator.free(baseAlloc);
             return {};
         }
+        if (alignment >= Cal::Utils::pageSize2MB) {
+            adviseHugePages(mmappedPtr, size);
+        }
 
         AllocationT ret{std::move(baseAlloc), mmappedPtr, size};
         return ret;
@@ -756,6 +844,35 @@ class AllocatorWithGlobalMmapToFd {
     }
 
   protected:
+    // mmap() guarantees only alignment to page size - bigger alignments require reserving larger range and trimming it
+    void *mmapAligned(size_t size, size_t alignment, int fd, size_t fdOffset) {
+        if (alignment <= Cal::Utils::pageSize4KB) {
+            return Cal::Sys::mmap(nullptr, size, mmapConfig.prot, mmapConfig.flags, fd, fdOffset);
+        }
+
+        auto reservationSize = size + alignment;
+        void *reservation = Cal::Sys::mmap(nullptr, reservationSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (MAP_FAILED == reservation) {
+            return MAP_FAILED;
+        }
+        void *alignedPtr = Cal::Utils::alignUp(reservation, alignment);
+        void *mmappedPtr = Cal::Sys::mmap(alignedPtr, size, mmapConfig.prot, MAP_FIXED | mmapConfig.flags, fd, fdOffset);
+        if (MAP_FAILED == mmappedPtr) {
+            Cal::Sys::munmap(reservation, reservationSize);
+            return MAP_FAILED;
+        }
+
+        auto headSize = Cal::Utils::byteDistanceAbs(reservation, alignedPtr);
+        if (headSize > 0U) {
+            Cal::Sys::munmap(reservation, headSize);
+        }
+        auto tailSize = reservationSize - headSize - size;
+        if (tailSize > 0U) {
+            Cal::Sys::munmap(Cal::Utils::moveByBytes(alignedPtr, size), tailSize);
+        }
+        return mmappedPtr;
+    }
+
     UnderlyingAllocatorVarT underlyingAllocator;
     MmapConfig mmapConfig;
 };
@@ -802,6 +919,7 @@ class AllocatorWithBoundedMmapToFd {
             return {};
         }
 
+        alignment = getHugePageAlignment(size, alignment);
         auto baseAlloc = underlyingAllocator.allocate(size, alignment);
         if (baseAlloc.isValid() == false) {
             return {};
@@ -830,6 +948,9 @@ class AllocatorWithBoundedMmapToFd {
             underlyingAllocator.free(baseAlloc);
             return {};
         }
+        if (alignment >= Cal::Utils::pageSize2MB) {
+            adviseHugePages(mmappedPtr, size);
+        }
 
         AllocationT ret{std::move(baseAlloc), mmappedPtr, size};
         return ret;
@@ -935,10 +1056,18 @@ class ArenaAllocator {
 
     using UnderlyingAllocatorVarT = std::conditional_t<SharedUnderlyingAllocator, UnderlyingAllocator &, UnderlyingAllocator>;
 
-    ArenaAllocator(UnderlyingAllocatorVarT underlyingAllocator, size_t underlyingAllocationGranularity)
+    static constexpr size_t threadCacheSlotsCount = 16U;
+    static constexpr size_t maxCachedChunksPerSizeClass = 16U;
+    static constexpr size_t maxPooledStandaloneAllocationsPerSizeClass = 4U;
+
+    // arenaAlignment applies to arenas and to standalone allocations that are not smaller than it (e.g. to back them with hugepages)
+    // useThreadCaches enables size classes with per-thread caches of freed chunks and pooling of medium standalone allocations
+    ArenaAllocator(UnderlyingAllocatorVarT underlyingAllocator, size_t underlyingAllocationGranularity, size_t arenaAlignment = minAlignment, bool useThreadCaches = false)
         : underlyingAllocator(std::forward<UnderlyingAllocatorVarT>(underlyingAllocator)),
           underlyingAllocationGranularity(underlyingAllocationGranularity),
-          standaloneAllocationThreshold(underlyingAllocationGranularity / 2) {
+          standaloneAllocationThreshold(underlyingAllocationGranularity / 2),
+          arenaAlignment(std::max(arenaAlignment, minAlignment)),
+          caches(useThreadCaches ? std::make_unique<Caches>() : nullptr) {
         constexpr size_t entryArenaSize = 4096U;
         auto entryArenaAllocation = this->underlyingAllocator.allocate(entryArenaSize);
         if (entryArenaAllocation.isValid() == false) {
@@ -950,29 +1079,42 @@ class ArenaAllocator {
     }
 
     ArenaAllocator(const ThisT &rhs, int = 0)
-        : ArenaAllocator(rhs.underlyingAllocator, rhs.underlyingAllocationGranularity) {
+        : ArenaAllocator(rhs.underlyingAllocator, rhs.underlyingAllocationGranularity, rhs.arenaAlignment, nullptr != rhs.caches) {
+        this->idleTrimmer = rhs.idleTrimmer;
     }
 
     ArenaAllocator &operator=(const ThisT &) = delete;
 
     template <typename T = ThisT, std::enable_if_t<T::isUingSharedUnderlyingAllocator, int> = 0>
     ArenaAllocator(ThisT &&rhs)
-        : underlyingAllocator(rhs.underlyingAllocator), underlyingAllocationGranularity(rhs.underlyingAllocationGranularity), standaloneAllocationThreshold(rhs.standaloneAllocationThreshold),
-          allArenas(std::move(rhs.allArenas)), recycledArenas(std::move(rhs.recycledArenas)), latestArena(rhs.latestArena->load()) {}
+        : underlyingAllocator(rhs.underlyingAllocator), underlyingAllocationGranularity(rhs.underlyingAllocationGranularity), standaloneAllocationThreshold(rhs.standaloneAllocationThreshold), arenaAlignment(rhs.arenaAlignment),
+          allArenas(std::move(rhs.allArenas)), recycledArenas(std::move(rhs.recycledArenas)), latestArena(rhs.latestArena->load()), caches(std::move(rhs.caches)), idleTrimmer(rhs.idleTrimmer) {}
 
     template <typename T = ThisT, std::enable_if_t<false == T::isUsingSharedUnderlyingAllocator, int> = 0>
     ArenaAllocator(ThisT &&rhs)
-        : underlyingAllocator(std::move(rhs.underlyingAllocator)), underlyingAllocationGranularity(rhs.underlyingAllocationGranularity), standaloneAllocationThreshold(rhs.standaloneAllocationThreshold),
-          allArenas(std::move(rhs.allArenas)), recycledArenas(std::move(rhs.recycledArenas)), latestArena(rhs.latestArena->load()) {}
+        : underlyingAllocator(std::move(rhs.underlyingAllocator)), underlyingAllocationGranularity(rhs.underlyingAllocationGranularity), standaloneAllocationThreshold(rhs.standaloneAllocationThreshold), arenaAlignment(rhs.arenaAlignment),
+          allArenas(std::move(rhs.allArenas)), recycledArenas(std::move(rhs.recycledArenas)), latestArena(rhs.latestArena->load()), caches(std::move(rhs.caches)), idleTrimmer(rhs.idleTrimmer) {}
 
     virtual ~ArenaAllocator() {
+        if (caches) { // chunks cached in threads' caches are released together with their arenas
+            for (auto &[sizeClass, pooled] : *caches->standalonePool) {
+                for (auto &alloc : pooled) {
+                    this->releaseChunk(alloc);
+                }
+            }
+        }
         for (auto &arena : *allArenas) {
             underlyingAllocator.free(arena->getUnderlyingAllocation());
         }
     }
 
     mockable AllocationT allocateAsStandalone(size_t size, size_t alignment) {
-        auto newSourceAlloc = underlyingAllocator.allocate(size, alignment);
+        auto underlyingSize = size;
+        if (size >= arenaAlignment) {
+            underlyingSize = Cal::Utils::alignUp(size, arenaAlignment);
+            alignment = std::max(alignment, arenaAlignment);
+        }
+        auto newSourceAlloc = underlyingAllocator.allocate(underlyingSize, alignment);
         if (newSourceAlloc.isValid() == false) {
             log<Verbosity::error>("Failed to allocate arena underlying allocation for standalone allocation");
             return AllocationT{};
@@ -990,6 +1132,14 @@ class ArenaAllocator {
             return AllocationT{};
         }
 
+        if (caches && (0U != size) && (size <= underlyingAllocationGranularity)) {
+            size = getSizeClass(size);
+            auto cached = this->allocateFromCaches(size, alignment);
+            if (cached.isValid()) {
+                return cached;
+            }
+        }
+
         if (size > standaloneAllocationThreshold) {
             return this->allocateAsStandalone(size, alignment); // too big for arena
         }
@@ -1006,6 +1156,7 @@ class ArenaAllocator {
             if (recycledArenas->size() > 0) {
                 auto recycledArena = *recycledArenas->rbegin();
                 recycledArenas->pop_back();
+                idleArenas.erase(recycledArena);
 
                 alloc = recycledArena->allocate(size, alignment);
                 if (alloc.isValid()) {
@@ -1036,7 +1187,7 @@ class ArenaAllocator {
                     }
                 }
             }
-            auto newArenaAllocation = underlyingAllocator.allocate(underlyingAllocationGranularity);
+            auto newArenaAllocation = underlyingAllocator.allocate(underlyingAllocationGranularity, arenaAlignment);
             if (newArenaAllocation.isValid() == false) {
                 log<Verbosity::error>("Failed to allocate new memory arena");
                 return {};
@@ -1061,6 +1212,174 @@ class ArenaAllocator {
     }
 
     mockable void free(const AllocationT &alloc) {
+        if (caches && this->cacheChunk(alloc)) {
+            return;
+        }
+        this->releaseChunk(alloc);
+    }
+
+    mockable ArenaT *peekLatestArena() const {
+        return latestArena->load();
+    }
+
+    const UnderlyingAllocator &getUnderlyingAllocator() const {
+        return underlyingAllocator;
+    }
+
+    size_t getArenaAlignment() const {
+        return arenaAlignment;
+    }
+
+    bool usesThreadCaches() const {
+        return nullptr != caches;
+    }
+
+    // disabled by default - arenas' memory is then kept until allocator is destroyed
+    void setIdleTrimming(const Cal::Utils::IdleTrimmer::Config &config) {
+        this->idleTrimmer = Cal::Utils::IdleTrimmer{config};
+    }
+
+    // Discards memory of recycled arenas that stayed unused for longer than idle timeout (except for low watermark
+    // of most recently freed ones). Arenas themselves are kept, so their (zeroed) pages are faulted back in on reuse.
+    // Returns number of arenas that got discarded.
+    size_t trimIdleArenas(Cal::Utils::IdleTrimmer::ClockT::time_point now) {
+        if constexpr (false == UnderlyingAllocationT::isMmappedAllocation) {
+            return 0U;
+        } else {
+            if (false == idleTrimmer.isEnabled()) {
+                return 0U;
+            }
+            auto recycleLock = recycledArenas.lock();
+            auto latestArenaSnapshot = this->peekLatestArena();
+            std::vector<ArenaT *> candidates;
+            std::vector<Cal::Utils::IdleTrimmer::ClockT::time_point> idleSince;
+            for (auto arena : *recycledArenas) {
+                if ((arena == latestArenaSnapshot) || (false == arena->isUnused())) {
+                    idleArenas.erase(arena);
+                    continue;
+                }
+                auto &idleArena = idleArenas.try_emplace(arena, IdleArena{now, false}).first->second;
+                if (false == idleArena.discarded) {
+                    candidates.push_back(arena);
+                    idleSince.push_back(idleArena.idleSince);
+                }
+            }
+
+            size_t discardedCount = 0U;
+            for (auto candidateId : idleTrimmer.selectEntriesToTrim(idleSince, now)) {
+                auto arena = candidates[candidateId];
+                // arena could have been peeked as latest in the meantime - discard only if it is still unused
+                if (arena->runIfUnused([arena]() { return discardMemory(arena->getUnderlyingAllocation()); })) {
+                    idleArenas[arena].discarded = true;
+                    ++discardedCount;
+                }
+            }
+            if (discardedCount > 0U) {
+                log<Verbosity::debug>("Discarded memory of %zu idle arenas", discardedCount);
+            }
+            return discardedCount;
+        }
+    }
+
+    // size classes are spaced by a quarter of power of 2, so rounding up to size class wastes less than 20% of a chunk
+    static size_t getSizeClass(size_t size) {
+        auto pow2 = size_t{1U} << (Cal::Utils::leadingBitNum(size) - 1);
+        return Cal::Utils::alignUp(size, std::max(pow2 / 4, minAlignment));
+    }
+
+  protected:
+    using SizeClassBinsT = std::map<size_t, std::vector<AllocationT>>;
+
+    struct ThreadCache {
+        SizeClassBinsT chunks;
+        size_t cachedBytes = 0U;
+    };
+
+    // Threads are spread over a fixed number of cache slots (instead of thread_local storage), so that caches never
+    // outlive the allocator. Chunks freed to a slot are reused by allocations of the same size class without touching
+    // arenas' locks and go back to arenas in batches, once the slot caches too many of them.
+    struct Caches {
+        std::array<Cal::Utils::Lockable<ThreadCache>, threadCacheSlotsCount> threadCaches;
+        Cal::Utils::Lockable<SizeClassBinsT> standalonePool; // medium allocations - too big for arena, but not worth new mapping
+    };
+
+    static size_t getThreadCacheSlot() {
+        static std::atomic_size_t nextSlot = 0U;
+        static thread_local size_t slot = nextSlot.fetch_add(1U) % threadCacheSlotsCount;
+        return slot;
+    }
+
+    static AllocationT takeAlignedChunk(SizeClassBinsT &bins, size_t sizeClass, size_t alignment) {
+        auto bin = bins.find(sizeClass);
+        if (bins.end() == bin) {
+            return AllocationT{};
+        }
+        auto &chunks = bin->second;
+        for (auto it = chunks.rbegin(); it != chunks.rend(); ++it) {
+            if (Cal::Utils::isAligned(it->getRange().start, alignment)) {
+                auto chunk = *it;
+                chunks.erase(std::next(it).base());
+                return chunk;
+            }
+        }
+        return AllocationT{};
+    }
+
+    AllocationT allocateFromCaches(size_t sizeClass, size_t alignment) {
+        if (sizeClass > standaloneAllocationThreshold) {
+            auto poolLock = caches->standalonePool.lock();
+            return takeAlignedChunk(*caches->standalonePool, sizeClass, alignment);
+        }
+
+        auto &threadCache = caches->threadCaches[getThreadCacheSlot()];
+        auto threadCacheLock = threadCache.lock();
+        auto chunk = takeAlignedChunk(threadCache->chunks, sizeClass, alignment);
+        if (chunk.isValid()) {
+            threadCache->cachedBytes -= sizeClass;
+        }
+        return chunk;
+    }
+
+    bool cacheChunk(const AllocationT &alloc) {
+        auto sizeClass = alloc.getSubAllocationSize();
+        if ((0U == sizeClass) || (sizeClass > underlyingAllocationGranularity) || (getSizeClass(sizeClass) != sizeClass)) {
+            return false; // not allocated through size classes
+        }
+
+        if (nullptr == alloc.arena) {
+            if (sizeClass <= standaloneAllocationThreshold) {
+                return false;
+            }
+            auto poolLock = caches->standalonePool.lock();
+            auto &pooled = (*caches->standalonePool)[sizeClass];
+            if (pooled.size() >= maxPooledStandaloneAllocationsPerSizeClass) {
+                return false;
+            }
+            pooled.push_back(alloc);
+            return true;
+        }
+
+        std::vector<AllocationT> chunksToRelease;
+        {
+            auto &threadCache = caches->threadCaches[getThreadCacheSlot()];
+            auto threadCacheLock = threadCache.lock();
+            auto &chunks = threadCache->chunks[sizeClass];
+            chunks.push_back(alloc);
+            threadCache->cachedBytes += sizeClass;
+            if ((chunks.size() > maxCachedChunksPerSizeClass) || (threadCache->cachedBytes > underlyingAllocationGranularity)) {
+                auto batchSize = (chunks.size() + 1) / 2; // oldest ones
+                chunksToRelease.assign(chunks.begin(), chunks.begin() + batchSize);
+                chunks.erase(chunks.begin(), chunks.begin() + batchSize);
+                threadCache->cachedBytes -= batchSize * sizeClass;
+            }
+        }
+        for (const auto &chunk : chunksToRelease) {
+            this->releaseChunk(chunk);
+        }
+        return true;
+    }
+
+    void releaseChunk(const AllocationT &alloc) {
         if (nullptr == alloc.arena) { // standalone allocation
             underlyingAllocator.free(*alloc.getSourceAllocation());
             delete alloc.getSourceAllocation();
@@ -1089,17 +1408,31 @@ class ArenaAllocator {
                 }
             }
         }
-    }
 
-    mockable ArenaT *peekLatestArena() const {
-        return latestArena->load();
+        if (idleTrimmer.isEnabled()) { // trimming is piggybacked on frees that can leave arenas unused
+            auto now = Cal::Utils::IdleTrimmer::ClockT::now();
+            if (idleTrimmer.shouldTrim(now)) {
+                this->trimIdleArenas(now);
+            }
+        }
     }
 
-    const UnderlyingAllocator &getUnderlyingAllocator() const {
-        return underlyingAllocator;
+    static bool discardMemory(const UnderlyingAllocationT &alloc) {
+        if (nullptr == alloc.getMmappedPtr()) {
+            return false;
+        }
+        // on shared mappings MADV_REMOVE punches a hole in the backing file (like fallocate(FALLOC_FL_PUNCH_HOLE)),
+        // so that tmpfs pages are freed and not only unmapped from this process
+        if (0 == Cal::Sys::madvise(alloc.getMmappedPtr(), alloc.getMmappedSize(), MADV_REMOVE)) {
+            return true;
+        }
+        if (0 == Cal::Sys::madvise(alloc.getMmappedPtr(), alloc.getMmappedSize(), MADV_DONTNEED)) {
+            return true;
+        }
+        log<Verbosity::debug>("Could not discard memory of idle arena %p of size : %zu", alloc.getMmappedPtr(), alloc.getMmappedSize());
+        return false;
     }
 
-  protected:
     Cal::Utils::OffsetRange getArenaOffsetRange(const UnderlyingAllocationT &alloc, size_t sizeAllocated) {
         auto range = alloc.getRange();
         if (range.empty() && alloc.isValid()) {
@@ -1111,6 +1444,7 @@ class ArenaAllocator {
     UnderlyingAllocatorVarT underlyingAllocator;
     size_t underlyingAllocationGranularity = 0U;
     size_t standaloneAllocationThreshold = 0U;
+    size_t arenaAlignment = minAlignment;
 
     using OwnedArenasVecT = std::vector<std::unique_ptr<ArenaT>>;
     using ReferencedArenasVecT = std::vector<ArenaT *>;
@@ -1118,6 +1452,15 @@ class ArenaAllocator {
     Cal::Utils::Lockable<ReferencedArenasVecT> recycledArenas; // arena that is ready for reuse (after part of it was reaped)
 
     Cal::Utils::Lockable<std::atomic<ArenaT *>> latestArena; // latest snapshot can be peeked via atomic directly, update only under lock
+
+    std::unique_ptr<Caches> caches; // nullptr if thread caches are disabled
+
+    struct IdleArena {
+        Cal::Utils::IdleTrimmer::ClockT::time_point idleSince;
+        bool discarded = false;
+    };
+    Cal::Utils::IdleTrimmer idleTrimmer;
+    std::unordered_map<ArenaT *, IdleArena> idleArenas; // recycled arenas seen unused by trimming, guarded by recycledArenas' lock
 };
 
 } // namespace Cal::Allocators
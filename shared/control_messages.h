@@ -94,6 +94,8 @@ struct RespHandshake {
 
     pid_t pid = 0;
     uint64_t assignedClientOrdinal = 0;
+    bool memfdShmem = false;      // shmems are anonymous - clients need to import them with ReqImportShmem
+    bool directTransfers = false; // service copies client's hostptr memory with process_vm_readv/process_vm_writev
 };
 static_assert(std::is_standard_layout<RespHandshake>::value);
 
@@ -182,6 +184,7 @@ struct CommandsChannelLayout {
     OffsetWithinChannelT semServer = invalidOffsetWithinChannel;
     OffsetWithinChannelT ringHead = invalidOffsetWithinChannel;
     OffsetWithinChannelT ringTail = invalidOffsetWithinChannel;
+    OffsetWithinChannelT ringTailWaiters = invalidOffsetWithinChannel;
     // RING :
     OffsetWithinChannelT ringStart = invalidOffsetWithinChannel;
     uint64_t ringCapacity = 0U;
@@ -211,6 +214,7 @@ struct CommandsChannelLayout {
         valid &= (semServer >= 0) ? 1 : 0;
         valid &= (ringHead >= 0) ? 1 : 0;
         valid &= (ringTail >= 0) ? 1 : 0;
+        valid &= (ringTailWaiters >= 0) ? 1 : 0;
 
         valid &= (ringStart >= 0) ? 1 : 0;
         valid &= (ringCapacity > 0U) ? 1 : 0;
@@ -253,6 +257,7 @@ inline bool operator==(const CommandsChannelLayout &lhs, const CommandsChannelLa
     same &= (lhs.semServer == rhs.semServer) ? 1 : 0;
     same &= (lhs.ringHead == rhs.ringHead) ? 1 : 0;
     same &= (lhs.ringTail == rhs.ringTail) ? 1 : 0;
+    same &= (lhs.ringTailWaiters == rhs.ringTailWaiters) ? 1 : 0;
 
     same &= (lhs.ringStart == rhs.ringStart) ? 1 : 0;
     same &= (lhs.ringCapacity == rhs.ringCapacity) ? 1 : 0;
@@ -318,6 +323,7 @@ struct RespLaunchRpcShmemRingBuffer {
     enum ServiceSynchronizationMethod : uint32_t { unknown,
                                                    activePolling, // service polls for new requests in busy loop
                                                    semaphores,    // service requires client to signal new request using semaphore
+                                                   futex,         // service polls for new requests for a while, then sleeps on futex placed on ring tail (client wakes it up only when needed)
     };
 
     RespLaunchRpcShmemRingBuffer() {
@@ -344,6 +350,8 @@ struct RespLaunchRpcShmemRingBuffer {
             return "activePolling";
         case semaphores:
             return "semaphores";
+        case futex:
+            return "futex";
         }
     }
 
@@ -461,7 +469,7 @@ struct ReqPageFault {
 
     static constexpr uint16_t messageSubtype = 11;
 
-    ReqPageFault(const void *ptr) : ptr(ptr) {
+    ReqPageFault(const void *ptr, uint64_t size) : ptr(ptr), size(size) {
         this->header.type = Cal::Ipc::ControlMessageHeader::messageTypeRequest;
         this->header.subtype = ReqPageFault::messageSubtype;
     }
@@ -471,6 +479,7 @@ struct ReqPageFault {
         invalid |= (this->header.type != Cal::Ipc::ControlMessageHeader::messageTypeRequest) ? 1 : 0;
         invalid |= (this->header.subtype != ReqPageFault::messageSubtype) ? 1 : 0;
         invalid |= ptr == nullptr;
+        invalid |= size == 0;
         if (0 != invalid) {
             log<Verbosity::error>("Message ReqPageFault is not valid");
         }
@@ -478,6 +487,7 @@ struct ReqPageFault {
     }
 
     const void *ptr;
+    uint64_t size; // of range to migrate to host
 };
 static_assert(std::is_standard_layout<ReqPageFault>::value);
 
@@ -634,5 +644,55 @@ struct RespCheckApiAvailability {
 };
 static_assert(std::is_standard_layout<RespCheckApiAvailability>::value);
 
+struct ReqImportShmem {
+    Cal::Ipc::ControlMessageHeader header = {};
+
+    static constexpr uint16_t messageSubtype = 18;
+
+    ReqImportShmem(int id) : id(id) {
+        this->header.type = Cal::Ipc::ControlMessageHeader::messageTypeRequest;
+        this->header.subtype = ReqImportShmem::messageSubtype;
+    }
+
+    bool isInvalid() const {
+        uint32_t invalid = 0;
+        invalid |= (this->header.type != Cal::Ipc::ControlMessageHeader::messageTypeRequest) ? 1 : 0;
+        invalid |= (this->header.subtype != ReqImportShmem::messageSubtype) ? 1 : 0;
+        invalid |= (this->id < 0) ? 1 : 0;
+        if (0 != invalid) {
+            log<Verbosity::error>("Message ReqImportShmem is not valid");
+        }
+        return 0 != invalid;
+    }
+
+    int id = -1;
+};
+static_assert(std::is_standard_layout<ReqImportShmem>::value);
+
+// if available, FD of the shmem follows the response (SCM_RIGHTS)
+struct RespImportShmem {
+    Cal::Ipc::ControlMessageHeader header = {};
+
+    static constexpr uint16_t messageSubtype = 19;
+
+    RespImportShmem() {
+        this->header.type = Cal::Ipc::ControlMessageHeader::messageTypeRequest;
+        this->header.subtype = RespImportShmem::messageSubtype;
+    }
+
+    bool isInvalid() const {
+        uint32_t invalid = 0;
+        invalid |= (this->header.type != Cal::Ipc::ControlMessageHeader::messageTypeRequest) ? 1 : 0;
+        invalid |= (this->header.subtype != RespImportShmem::messageSubtype) ? 1 : 0;
+        if (0 != invalid) {
+            log<Verbosity::error>("Message RespImportShmem is not valid");
+        }
+        return 0 != invalid;
+    }
+
+    bool available = false;
+};
+static_assert(std::is_standard_layout<RespImportShmem>::value);
+
 } // namespace Messages
 } // namespace Cal
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "include/cal.h"
+#include "shared/utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace Cal::Utils {
+
+// Decides when idle entries of memory pools should be returned to the system. Pools consult it lazily, from their
+// own allocations and frees, so trimming does not need any additional threads - pool that is not used at all keeps
+// its memory until its next operation.
+class IdleTrimmer {
+  public:
+    using ClockT = std::chrono::steady_clock;
+
+    struct Config {
+        std::chrono::milliseconds idleTimeout{0}; // 0 disables trimming
+        size_t lowWatermark = 0U;                 // number of most recently used idle entries that are never trimmed
+    };
+
+    IdleTrimmer() = default;
+
+    IdleTrimmer(const Config &config) : config(config) {
+    }
+
+    IdleTrimmer(const IdleTrimmer &rhs) : config(rhs.config) {
+    }
+
+    IdleTrimmer &operator=(const IdleTrimmer &rhs) {
+        config = rhs.config;
+        return *this;
+    }
+
+    static Config readConfig() {
+        Config config;
+        config.idleTimeout = std::chrono::milliseconds{std::max<int64_t>(0, Cal::Utils::getCalEnvI64(calIdleTrimTimeoutEnvName, 30000))};
+        config.lowWatermark = static_cast<size_t>(std::max<int64_t>(0, Cal::Utils::getCalEnvI64(calIdleTrimLowWatermarkEnvName, 2)));
+        return config;
+    }
+
+    bool isEnabled() const {
+        return config.idleTimeout.count() > 0;
+    }
+
+    const Config &getConfig() const {
+        return config;
+    }
+
+    // returns true at most once per half of idle timeout, so that pools don't scan their entries on every operation
+    bool shouldTrim(ClockT::time_point now) {
+        if (false == isEnabled()) {
+            return false;
+        }
+        auto nowNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+        auto intervalNs = std::chrono::duration_cast<std::chrono::nanoseconds>(config.idleTimeout).count() / 2;
+        auto lastTrimNs = lastTrim.load(std::memory_order_relaxed);
+        if ((0 != lastTrimNs) && (nowNs - lastTrimNs < intervalNs)) {
+            return false;
+        }
+        return lastTrim.compare_exchange_strong(lastTrimNs, nowNs, std::memory_order_relaxed);
+    }
+
+    // returns indices of idle entries that should be trimmed - the ones idle for longer than timeout,
+    // except for lowWatermark most recently used ones
+    std::vector<size_t> selectEntriesToTrim(const std::vector<ClockT::time_point> &idleSince, ClockT::time_point now) const {
+        std::vector<size_t> ret;
+        if ((false == isEnabled()) || (idleSince.size() <= config.lowWatermark)) {
+            return ret;
+        }
+        std::vector<size_t> byRecentUse(idleSince.size());
+        std::iota(byRecentUse.begin(), byRecentUse.end(), 0U);
+        std::stable_sort(byRecentUse.begin(), byRecentUse.end(), [&idleSince](size_t lhs, size_t rhs) { return idleSince[lhs] > idleSince[rhs]; });
+        for (auto it = byRecentUse.begin() + config.lowWatermark; it != byRecentUse.end(); ++it) {
+            if (now - idleSince[*it] >= config.idleTimeout) {
+                ret.push_back(*it);
+            }
+        }
+        std::sort(ret.begin(), ret.end());
+        return ret;
+    }
+
+  protected:
+    Config config;
+    std::atomic<int64_t> lastTrim = 0; // in ns since clock's epoch, 0 if never trimmed
+};
+
+} // namespace Cal::Utils
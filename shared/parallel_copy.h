@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/log.h"
+#include "shared/transfer_copy.h"
+#include "shared/utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Cal::Utils {
+
+// Splits large memory copies into chunks that are copied by the calling thread together with a small pool of
+// helper threads. Helpers are started on first large copy, so processes that never copy much don't pay for them.
+// Only one copy is parallelized at a time - concurrent callers copy on their own.
+class ParallelCopy {
+  public:
+    struct CopyDesc {
+        void *dst = nullptr;
+        const void *src = nullptr;
+        size_t size = 0U;
+    };
+
+    static constexpr size_t defaultMinBytesToSplit = 2 * MB;
+    static constexpr size_t chunkSize = 512 * KB;
+
+    ParallelCopy(size_t helpersCount, size_t minBytesToSplit = defaultMinBytesToSplit) : helpersCount(helpersCount), minBytesToSplit(minBytesToSplit) {
+    }
+
+    ~ParallelCopy() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        jobAvailable.notify_all();
+        for (auto &helper : helpers) {
+            helper.join();
+        }
+    }
+
+    ParallelCopy(const ParallelCopy &) = delete;
+    ParallelCopy &operator=(const ParallelCopy &) = delete;
+
+    void copy(const std::vector<CopyDesc> &copies) {
+        size_t totalSize = 0U;
+        for (const auto &copy : copies) {
+            totalSize += copy.size;
+        }
+
+        // copies of a single transfer are consumed together, so non-temporal stores are chosen based on its total size
+        auto copyFunction = TransferCopy::getConfig().select(totalSize);
+
+        std::unique_lock<std::mutex> jobLock(jobMutex, std::defer_lock);
+        if ((0U == helpersCount) || (totalSize < minBytesToSplit) || (false == jobLock.try_lock())) {
+            for (const auto &copy : copies) {
+                copyFunction(copy.dst, copy.src, copy.size);
+            }
+            return;
+        }
+
+        startHelpers();
+
+        chunks.clear();
+        for (const auto &copy : copies) {
+            for (size_t offset = 0; offset < copy.size; offset += chunkSize) {
+                chunks.push_back({moveByBytes(copy.dst, offset), moveByBytes(copy.src, offset), std::min(chunkSize, copy.size - offset)});
+            }
+        }
+        nextChunk = 0U;
+        chunkCopyFunction = copyFunction;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobActive = true;
+            ++jobGeneration;
+        }
+        jobAvailable.notify_all();
+
+        copyChunks();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        jobActive = false;
+        helperLeft.wait(lock, [this]() { return 0U == activeHelpers; });
+    }
+
+    size_t getStartedHelpersCount() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return helpers.size();
+    }
+
+  protected:
+    void startHelpers() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (false == helpers.empty()) {
+            return;
+        }
+        log<Verbosity::debug>("Starting %zu helper threads for parallel copies", helpersCount);
+        for (size_t i = 0; i < helpersCount; ++i) {
+            helpers.emplace_back(&ParallelCopy::helperLoop, this);
+        }
+    }
+
+    void copyChunks() {
+        for (auto chunkId = nextChunk.fetch_add(1U); chunkId < chunks.size(); chunkId = nextChunk.fetch_add(1U)) {
+            chunkCopyFunction(chunks[chunkId].dst, chunks[chunkId].src, chunks[chunkId].size);
+        }
+    }
+
+    void helperLoop() {
+        uint64_t seenGeneration = 0U;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                jobAvailable.wait(lock, [&]() { return stopping || (jobActive && (jobGeneration != seenGeneration)); });
+                if (stopping) {
+                    return;
+                }
+                seenGeneration = jobGeneration;
+                ++activeHelpers;
+            }
+
+            copyChunks();
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                --activeHelpers;
+            }
+            helperLeft.notify_all();
+        }
+    }
+
+    const size_t helpersCount;
+    const size_t minBytesToSplit;
+
+    std::mutex jobMutex;
+    std::vector<CopyDesc> chunks;
+    TransferCopy::CopyFunctionT chunkCopyFunction = &TransferCopy::copyWithLibc;
+    std::atomic_size_t nextChunk = 0U;
+
+    std::mutex mutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable helperLeft;
+    bool jobActive = false;
+    bool stopping = false;
+    uint64_t jobGeneration = 0U;
+    size_t activeHelpers = 0U;
+    std::vector<std::thread> helpers;
+};
+
+} // namespace Cal::Utils
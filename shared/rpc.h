@@ -14,16 +14,22 @@
 #include "shared/rpc_message.h"
 #include "shared/shmem.h"
 #include "shared/shmem_transfer_desc.h"
+#include "shared/stats.h"
+#include "shared/synchronization.h"
 #include "shared/usm.h"
 #include "shared/utils.h"
 
+#include <algorithm>
 #include <atomic>
 #include <bitset>
+#include <chrono>
+#include <deque>
 #include <inttypes.h>
 #include <memory>
 #include <mutex>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace Cal {
 
@@ -172,6 +178,10 @@ class TypedRing final {
         return capacity;
     }
 
+    OffsetType getBatchedCount() const {
+        return batchCounter;
+    }
+
     void wait() {
         auto tailSnapshot = peekTailOffset();
         while (peekHeadOffset() != tailSnapshot) {
@@ -242,6 +252,7 @@ class TypedRing final {
             return;
         }
         __atomic_store_n(tail, peekTailOffset() + batchCounter, __ATOMIC_RELAXED);
+        batchCounter = 0u;
     }
 
   protected:
@@ -257,6 +268,7 @@ class TypedRing final {
 using CompletionStampT = uint32_t;
 constexpr CompletionStampT CompletionStampReady = 1;
 constexpr CompletionStampT CompletionStampNotReady = 0;
+constexpr CompletionStampT CompletionStampNotReadyWithWaiter = 2; // client sleeps on futex and needs to be woken up
 using CompletionStampBufferT = Cal::Allocators::TagAllocator<CompletionStampT>;
 
 using OffsetWithinChannelT = Cal::Messages::OffsetWithinChannelT;
@@ -277,7 +289,7 @@ struct RingEntry {
 
 class CommandsChannel {
   public:
-    // | control block + ring | completion stamps heap | hostptr copies to update ring | callbacks ring | service heap | client heap ...
+    // | control block + ring | completion stamps heap (per-call slots + async stamps) | hostptr copies to update ring | callbacks ring | service heap | client heap ...
     struct Layout {
         using OffsetT = Cal::Messages::OffsetWithinChannelT;
 
@@ -290,8 +302,11 @@ class CommandsChannel {
         using RingTailT = RingHeadT;
         OffsetT ringTail = Cal::Utils::alignUpPow2<Cal::Utils::cachelineSize>(semClient + sizeof(SemClientT));
 
+        using RingTailWaitersT = uint32_t;
+        OffsetT ringTailWaiters = ringTail + sizeof(RingTailT);
+
         using SemServerT = SemClientT;
-        OffsetT semServer = Cal::Utils::alignUpPow2<sizeof(SemServerT)>(ringTail + sizeof(RingTailT));
+        OffsetT semServer = Cal::Utils::alignUpPow2<sizeof(SemServerT)>(ringTailWaiters + sizeof(RingTailWaitersT));
 
         using RingEntryT = Cal::Rpc::RingEntry;
         OffsetT ringStart = Cal::Utils::alignUpPow2<Cal::Utils::cachelineSize>(semServer);
@@ -423,6 +438,11 @@ class CommandsChannel {
         return ret == 0;
     }
 
+    // ring offsets never exceed 32 bits, so on little-endian the lower half of ring tail can be used as futex word
+    uint32_t *getRingTailFutexWord() {
+        return getAsLocalAddress<uint32_t>(this->layout.ringTail);
+    }
+
     bool signalClientCallbacksSemaphore() {
         auto ret = Cal::Sys::sem_post(semClientCallback);
         if (ret != 0) {
@@ -474,6 +494,7 @@ class CommandsChannel {
         this->layout.semClient = layout.semClient;
 
         this->layout.ringTail = layout.ringTail;
+        this->layout.ringTailWaiters = layout.ringTailWaiters;
         this->layout.semServer = layout.semServer;
 
         this->layout.ringStart = layout.ringStart;
@@ -501,6 +522,7 @@ class CommandsChannel {
 
         this->semClient = getAsLocalAddress<sem_t>(this->layout.semClient);
         this->semServer = getAsLocalAddress<sem_t>(this->layout.semServer);
+        this->ringTailWaiters = getAsLocalAddress<Layout::RingTailWaitersT>(this->layout.ringTailWaiters);
 
         this->ring = RingT(getAsLocalAddress<RingEntry>(this->layout.ringStart),
                            this->layout.ringCapacity,
@@ -539,6 +561,7 @@ class CommandsChannel {
 
         this->semClient = getAsLocalAddress<sem_t>(this->layout.semClient);
         this->semServer = getAsLocalAddress<sem_t>(this->layout.semServer);
+        this->ringTailWaiters = getAsLocalAddress<Layout::RingTailWaitersT>(this->layout.ringTailWaiters);
 
         this->ring = RingT(getAsLocalAddress<RingEntry>(this->layout.ringStart),
                            this->layout.ringCapacity,
@@ -565,6 +588,7 @@ class CommandsChannel {
 
     bool initControlBlock() {
         ring.reset();
+        __atomic_store_n(ringTailWaiters, 0U, __ATOMIC_RELAXED);
         hostptrCopiesRing.reset();
         callbacksRing.reset();
 
@@ -598,6 +622,7 @@ class CommandsChannel {
         auto channel = Cal::Utils::AddressRange(static_cast<size_t>(0), channelSize);
         auto ringHead = Cal::Utils::AddressRange(el.ringHead, el.ringHead + sizeof(Cal::Messages::OffsetWithinChannelT));
         auto ringTail = Cal::Utils::AddressRange(el.ringTail, el.ringTail + sizeof(Cal::Messages::OffsetWithinChannelT));
+        auto ringTailWaiters = Cal::Utils::AddressRange(el.ringTailWaiters, el.ringTailWaiters + sizeof(Layout::RingTailWaitersT));
         auto semClient = Cal::Utils::AddressRange(el.semClient, el.semClient + sizeof(sem_t));
         auto semServer = Cal::Utils::AddressRange(el.semServer, el.semServer + sizeof(sem_t));
         auto ring = Cal::Utils::AddressRange(el.ringStart, el.ringStart + el.ringCapacity * sizeof(RingEntry));
@@ -615,6 +640,7 @@ class CommandsChannel {
         std::tuple<const char *, Cal::Utils::AddressRange, size_t> ranges[] = {
             {"ringHead", ringHead, sizeof(Cal::Messages::OffsetWithinChannelT)},
             {"ringTail", ringTail, sizeof(Cal::Messages::OffsetWithinChannelT)},
+            {"ringTailWaiters", ringTailWaiters, sizeof(Layout::RingTailWaitersT)},
             {"semClient", semClient, sizeof(sem_t)},
             {"semServer", semServer, sizeof(sem_t)},
             {"ring", ring, Cal::Utils::cachelineSize},
@@ -685,6 +711,10 @@ class CommandsChannel {
     sem_t *semClient = nullptr;
     sem_t *semServer = nullptr;
     sem_t *semClientCallback = nullptr;
+    Layout::RingTailWaitersT *ringTailWaiters = nullptr;
+
+    // sleeps on futex are bounded, so that stop() can't be missed when it races with going to sleep
+    static constexpr struct timespec futexSleepTimeout = {0, 100 * 1000 * 1000};
 
     RpcMutex mutex;
     bool ownsSemaphores = false;
@@ -713,7 +743,13 @@ class ChannelClient : public CommandsChannel {
     enum ClientSynchronizationMethod : uint32_t { unknown,
                                                   activePolling, // client always polls for command completion status in busy loop
                                                   semaphores,    // client always requires service to signal completion using semaphore
-                                                  latencyBased   // client uses mixed mode (semaphore+activePolling) based on command latency traits
+                                                  latencyBased,  // client uses mixed mode (semaphore+activePolling) based on command latency traits
+                                                  futex          // client polls for command completion status for a while, then sleeps on futex placed on completion stamp
+    };
+
+    struct BatchingThresholds {
+        static constexpr int64_t defaultMaxCallsCount = 32;
+        static constexpr int64_t defaultMaxAgeUs = 100;
     };
 
     struct SemaphoreThresholds {
@@ -722,6 +758,12 @@ class ChannelClient : public CommandsChannel {
         static constexpr float unreachableAlwaysSemaphores = -100.0f; // all APIs reach this threshold (always semaphores)
     };
 
+    // Keeps the order of calls submitted from different threads through different channels of the same client
+    struct CrossChannelOrdering {
+        std::mutex mutex;
+        ChannelClient *lastUsedChannel = nullptr;
+    };
+
     static const char *asCStr(ClientSynchronizationMethod e) {
         switch (e) {
         default:
@@ -732,6 +774,8 @@ class ChannelClient : public CommandsChannel {
             return "semaphores";
         case latencyBased:
             return "latencyBased";
+        case futex:
+            return "futex";
         }
     }
 
@@ -766,6 +810,9 @@ class ChannelClient : public CommandsChannel {
         case latencyBased:
             this->semaphoreWaitThreshold = SemaphoreThresholds::base;
             break;
+        case futex:
+            this->semaphoreWaitThreshold = SemaphoreThresholds::unreachableAlwaysActiveWait;
+            break;
         }
 
         log<Verbosity::debug>("Creating RPC ring buffer");
@@ -782,21 +829,27 @@ class ChannelClient : public CommandsChannel {
             return false;
         }
 
-        this->completionStamp = getAsLocalAddress<CompletionStampT>(this->layout.completionStampsStart);
+        this->initCompletionSlots();
         auto totalClientHeapSize = this->layout.clientHeapEnd - this->layout.clientHeapStart;
         auto cmdHeapSize = totalClientHeapSize / 4;
-        this->cmdHeap = Cal::Allocators::LinearAllocator(Cal::Utils::AddressRange(getAsLocalAddress(this->layout.clientHeapStart), cmdHeapSize));
+        this->cmdHeap = Cal::Allocators::CircularAllocator(Cal::Utils::AddressRange(getAsLocalAddress(this->layout.clientHeapStart), cmdHeapSize));
         this->standaloneHeap = Cal::Allocators::AddressRangeAllocator(Cal::Utils::AddressRange(getAsLocalAddress(this->layout.clientHeapStart + cmdHeapSize), totalClientHeapSize - cmdHeapSize));
         this->useBatchedCalls = Cal::Utils::getCalEnvFlag(calBatchedCalls, this->useBatchedCalls);
+        auto maxBatchedCallsCount = Cal::Utils::getCalEnvI64(calBatchedCallsMaxCountEnvName, BatchingThresholds::defaultMaxCallsCount);
+        this->maxBatchedCallsCount = static_cast<size_t>(std::clamp<int64_t>(maxBatchedCallsCount, 1, std::max<int64_t>(1, this->ring.getCapacity() / 2)));
+        this->maxBatchAge = std::chrono::microseconds(Cal::Utils::getCalEnvI64(calBatchedCallsMaxAgeUsEnvName, BatchingThresholds::defaultMaxAgeUs));
 
         return true;
     }
 
     void *getCmdSpaceAligned(size_t size, size_t alignment) {
         auto addr = cmdHeap.allocate(size, alignment);
-        if (nullptr == addr) {
-            Cal::Utils::signalAbort("Command channel's commands heap is full");
-            return nullptr;
+        while (nullptr == addr) {
+            if (false == reclaimCmdHeap(true)) {
+                Cal::Utils::signalAbort("Command channel's commands heap is full");
+                return nullptr;
+            }
+            addr = cmdHeap.allocate(size, alignment);
         }
 
         return addr;
@@ -845,9 +898,32 @@ class ChannelClient : public CommandsChannel {
         return reinterpret_cast<T *>(static_cast<uintptr_t>(Cal::Utils::byteDistanceAbs(shmem, localAddress)));
     }
 
-    CompletionStampT *allocateCompletionStamp() {
-        *completionStamp = CompletionStampNotReady;
-        return completionStamp;
+    // returns slot owned exclusively by calling synchronous command until it's released
+    CompletionStampT *acquireCompletionSlot() {
+        auto slot = this->completionSlots.allocate();
+        while (nullptr == slot) {
+            if (stopped) {
+                return nullptr;
+            }
+            std::this_thread::yield();
+            slot = this->completionSlots.allocate();
+        }
+        *slot = CompletionStampNotReady;
+        return slot;
+    }
+
+    void releaseCompletionSlot(CompletionStampT *slot) {
+        this->completionSlots.free(slot);
+    }
+
+    void enableCrossChannelOrdering(CrossChannelOrdering &ordering) {
+        this->crossChannelOrdering = &ordering;
+        // batched calls are not visible to the service until flushed, so other channels could not wait for them
+        this->useBatchedCalls = false;
+    }
+
+    bool isCrossChannelOrderingEnabled() const {
+        return nullptr != this->crossChannelOrdering;
     }
 
     bool submitCommand(void *command, Cal::Rpc::RpcMessageHeader::MessageFlagsT messageFlags, CompletionStampT *completionStamp, bool batched) {
@@ -883,42 +959,87 @@ class ChannelClient : public CommandsChannel {
             command->flags |= Cal::Rpc::RpcMessageHeader::batched;
         }
 
-        auto ret = this->submitCommand(command, command->flags, nullptr, batched);
+        auto ret = this->submitCommandInOrder(command, nullptr, batched);
 
         if (!ret) {
             log<Verbosity::critical>("Asynchronous call failed");
+        } else {
+            // space used by this (and all previous) commands can be reclaimed once it's completed
+            this->cmdHeapPendingReclaims.push_back({this->cmdHeap.getAllocationsEnd(), this->lastAsyncCompletionStamp});
+            this->reclaimCmdHeap(false);
         }
 
         if (!batched) {
-            if (Cal::Messages::RespLaunchRpcShmemRingBuffer::semaphores == serviceSynchronizationMethod) {
-                if (false == this->signalServiceSemaphore()) {
-                    log<Verbosity::critical>("Failed to signal service with new RPC call");
-                }
+            if (false == this->notifyService()) {
+                log<Verbosity::critical>("Failed to signal service with new RPC call");
             }
+        } else {
+            this->flushBatchedCallsIfNeeded();
         }
 
         log<Verbosity::bloat>("Successful asynchronous call");
     }
 
-    bool callSynchronous(Cal::Rpc::RpcMessageHeader *command) {
-        *completionStamp = CompletionStampNotReady;
-        auto ret = this->submitCommand(command, command->flags, completionStamp, false);
-        if (!ret) {
+    // publishes all batched calls to the service (non-batched calls, including synchronous ones, do it implicitly)
+    void flushBatchedCalls() {
+        if (0U == this->ring.getBatchedCount()) {
+            return;
+        }
+        this->ring.flushBatched();
+        if (false == this->notifyService()) {
+            log<Verbosity::critical>("Failed to signal service with batched RPC calls");
+        }
+    }
+
+    // Submits synchronous call without waiting for its completion.
+    // Returns completion slot of this call (or nullptr on failure) that needs to be passed to waitForCompletion.
+    // Command must stay intact until the call completes.
+    CompletionStampT *submitSynchronous(Cal::Rpc::RpcMessageHeader *command) {
+        auto completionSlot = this->acquireCompletionSlot();
+        if (nullptr == completionSlot) {
+            log<Verbosity::critical>("Failed to acquire completion slot for RPC call");
+            return nullptr;
+        }
+        if (false == this->submitCommandInOrder(command, completionSlot, false)) {
+            this->releaseCompletionSlot(completionSlot);
             log<Verbosity::critical>("Synchronous call failed");
+            return nullptr;
+        }
+        if (false == this->notifyService()) {
+            // command is already in the ring, so slot can't be reused
+            log<Verbosity::critical>("Failed to signal service with new RPC call");
+            return nullptr;
+        }
+        return completionSlot;
+    }
+
+    // Waits only for command that owns given completion slot (not for the whole pipeline) and releases the slot
+    bool waitForCompletion(CompletionStampT *completionSlot, Cal::Rpc::RpcMessageHeader::MessageFlagsT messageFlags) {
+        if (false == wait(completionSlot, messageFlags)) {
             return false;
         }
-        if (Cal::Messages::RespLaunchRpcShmemRingBuffer::semaphores == serviceSynchronizationMethod) {
-            if (false == this->signalServiceSemaphore()) {
-                log<Verbosity::critical>("Failed to signal service with new RPC call");
-                return false;
-            }
+        this->releaseCompletionSlot(completionSlot);
+        return true;
+    }
+
+    bool callSynchronous(Cal::Rpc::RpcMessageHeader *command) {
+        auto completionSlot = this->submitSynchronous(command);
+        if (nullptr == completionSlot) {
+            return false;
         }
         auto messageFlags = command->flags;
-        if (false == wait(completionStamp, messageFlags)) {
+        auto waitStats = this->stats ? this->stats->getClientWaits(*command) : nullptr;
+        auto waitStartNs = waitStats ? Cal::Stats::getTimestampNs() : 0U;
+        if (false == waitForCompletion(completionSlot, messageFlags)) {
             log<Verbosity::critical>("Failed to get response for RPC call");
             return false;
         }
+        if (waitStats) {
+            waitStats->record(Cal::Stats::getTimestampNs() - waitStartNs, 0U);
+        }
+        // service processes commands in order, so all previous commands are completed as well
         this->cmdHeap.free();
+        this->cmdHeapPendingReclaims.clear();
         log<Verbosity::bloat>("Successful synchronous call");
         return true;
     }
@@ -928,9 +1049,14 @@ class ChannelClient : public CommandsChannel {
         return callSynchronous(&command->header);
     }
 
+    // stats page of this client (shared by all channels) or nullptr if statistics are not collected
+    void setStats(Cal::Stats::StatsPage *stats) {
+        this->stats = stats;
+    }
+
     template <typename MessageT>
     void callAsynchronous(MessageT *command) {
-        callAsynchronous(&command->header, (MessageT::category == CallCategory::Copy) && this->useBatchedCalls);
+        callAsynchronous(&command->header, MessageT::batchable && this->useBatchedCalls);
     }
 
     int32_t getId() const {
@@ -940,6 +1066,8 @@ class ChannelClient : public CommandsChannel {
     bool wait(CompletionStampT *completionStamp, Cal::Rpc::RpcMessageHeader::MessageFlagsT messageFlags) {
         if (0 != (messageFlags & Cal::Rpc::RpcMessageHeader::FlagsBits::signalSemaphoreOnCompletion)) {
             return semaphoreWait(completionStamp);
+        } else if (futex == clientSynchronizationMethod) {
+            return hybridWait(completionStamp);
         } else {
             return activeWait(completionStamp);
         }
@@ -1002,6 +1130,103 @@ class ChannelClient : public CommandsChannel {
     }
 
   protected:
+    // completionSlot == nullptr means asynchronous call
+    bool submitCommandInOrder(Cal::Rpc::RpcMessageHeader *command, CompletionStampT *completionSlot, bool batched) {
+        std::unique_lock<std::mutex> orderingLock;
+        if (this->crossChannelOrdering) {
+            orderingLock = std::unique_lock<std::mutex>(this->crossChannelOrdering->mutex);
+            auto previousChannel = this->crossChannelOrdering->lastUsedChannel;
+            if (previousChannel && (previousChannel != this)) {
+                previousChannel->waitForSubmittedAsyncCalls();
+            }
+            this->crossChannelOrdering->lastUsedChannel = this;
+        }
+
+        bool isAsync = (nullptr == completionSlot);
+        CompletionStampT *stamp = isAsync ? allocateAsyncCompletionStamp() : completionSlot;
+        this->lastSubmittedCallAsync = isAsync;
+
+        return this->submitCommand(command, command->flags, stamp, batched);
+    }
+
+    // first half of completion stamps heap is a table of per-call slots for synchronous calls
+    // (so that each caller waits only for its own command), the rest is used by asynchronous calls
+    void initCompletionSlots() {
+        this->completionStamp = getAsLocalAddress<CompletionStampT>(this->layout.completionStampsStart);
+        constexpr size_t slotsGranularity = Cal::Allocators::BitAllocator::NodeT::capacity;
+        this->completionSlotsCount = (this->layout.completionStampsCapacity / 2) / slotsGranularity * slotsGranularity;
+        this->completionSlots = CompletionStampBufferT(this->completionStamp, this->completionSlotsCount);
+    }
+
+    // async stamps are rotated and there are more of them than ring entries,
+    // so a stamp is never reused while its previous call is still in flight
+    CompletionStampT *allocateAsyncCompletionStamp() {
+        auto asyncStampsCount = this->layout.completionStampsCapacity - this->completionSlotsCount;
+        this->lastAsyncCompletionStamp = this->completionStamp + this->completionSlotsCount + (this->asyncCompletionStampsCounter++ % asyncStampsCount);
+        *this->lastAsyncCompletionStamp = CompletionStampNotReady;
+        return this->lastAsyncCompletionStamp;
+    }
+
+    // age of the batch is checked only when a new call is added to it
+    void flushBatchedCallsIfNeeded() {
+        auto batchedCount = this->ring.getBatchedCount();
+        if (0U == batchedCount) {
+            return; // already published (e.g. ring looped)
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (1U == batchedCount) {
+            this->batchStartTimestamp = now;
+        }
+        if ((static_cast<size_t>(batchedCount) >= this->maxBatchedCallsCount) || (now - this->batchStartTimestamp >= this->maxBatchAge)) {
+            this->flushBatchedCalls();
+        }
+    }
+
+    // Reclaims space of completed commands (service completes them in order).
+    // If waitForSpace is set and none of them is completed yet, waits for the oldest one.
+    // Returns false if there was nothing to reclaim.
+    bool reclaimCmdHeap(bool waitForSpace) {
+        bool reclaimed = false;
+        while (false == this->cmdHeapPendingReclaims.empty()) {
+            auto [marker, stamp] = this->cmdHeapPendingReclaims.front();
+            if (__atomic_load_n(stamp, __ATOMIC_ACQUIRE) != CompletionStampReady) {
+                if (reclaimed || (false == waitForSpace)) {
+                    break;
+                }
+                log<Verbosity::performance>("Command channel's commands heap is full - waiting for service to complete asynchronous calls");
+                this->ring.flushBatched(); // make sure that service can see the command we wait for
+                if ((false == this->notifyService()) || (false == this->activeWait(stamp))) {
+                    return false;
+                }
+            }
+            this->cmdHeap.reclaim(marker);
+            this->cmdHeapPendingReclaims.pop_front();
+            reclaimed = true;
+        }
+        return reclaimed;
+    }
+
+    // must be called under CrossChannelOrdering::mutex
+    void waitForSubmittedAsyncCalls() {
+        if (this->lastSubmittedCallAsync) {
+            log<Verbosity::bloat>("Waiting for asynchronous calls of RPC channel %d to complete", getId());
+            while (__atomic_load_n(this->lastAsyncCompletionStamp, __ATOMIC_ACQUIRE) != CompletionStampReady) {
+                if (stopped) {
+                    return;
+                }
+                std::this_thread::yield();
+            }
+        } else {
+            // last call was synchronous (possibly still in progress), so all previous calls are completed once it's been picked up by the service
+            while (false == ring.peekEmpty()) {
+                if (stopped) {
+                    return;
+                }
+                std::this_thread::yield();
+            }
+        }
+    }
+
     bool semaphoreWait(CompletionStampT *completionStamp) {
         log<Verbosity::bloat>("Waiting for packet to be processed - semaphores");
         this->waitOnClientSemaphore();
@@ -1009,9 +1234,9 @@ class ChannelClient : public CommandsChannel {
             log<Verbosity::debug>("Aborting wait for command packet request");
             return {};
         }
-        if (__atomic_load_n(completionStamp, __ATOMIC_RELAXED) == CompletionStampNotReady) {
+        if (__atomic_load_n(completionStamp, __ATOMIC_RELAXED) != CompletionStampReady) {
             log<Verbosity::error>("Command not processed after woken up from semaphore wait");
-            while (__atomic_load_n(completionStamp, __ATOMIC_RELAXED) == CompletionStampNotReady) {
+            while (__atomic_load_n(completionStamp, __ATOMIC_RELAXED) != CompletionStampReady) {
                 if (stopped) {
                     log<Verbosity::debug>("Aborting wait for command to be processed");
                     return false;
@@ -1026,7 +1251,7 @@ class ChannelClient : public CommandsChannel {
     bool activeWait(CompletionStampT *completionStamp) {
         log<Verbosity::bloat>("Waiting for packet to be processed - active wait");
 
-        while (__atomic_load_n(completionStamp, __ATOMIC_RELAXED) == CompletionStampNotReady) {
+        while (__atomic_load_n(completionStamp, __ATOMIC_RELAXED) != CompletionStampReady) {
             if (stopped) {
                 log<Verbosity::debug>("Aborting wait for command to be processed");
                 return false;
@@ -1037,6 +1262,44 @@ class ChannelClient : public CommandsChannel {
         return true;
     }
 
+    bool hybridWait(CompletionStampT *completionStamp) {
+        log<Verbosity::bloat>("Waiting for packet to be processed - hybrid wait (spin, then futex)");
+
+        auto isReady = [completionStamp]() { return __atomic_load_n(completionStamp, __ATOMIC_ACQUIRE) == CompletionStampReady; };
+        if (false == Cal::Utils::Futex::spinUntil(isReady)) {
+            while (false == isReady()) {
+                if (stopped) {
+                    log<Verbosity::debug>("Aborting wait for command to be processed");
+                    return false;
+                }
+                // announce waiter, so that service will wake us up
+                CompletionStampT prevStamp = CompletionStampNotReady;
+                __atomic_compare_exchange_n(completionStamp, &prevStamp, CompletionStampNotReadyWithWaiter, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+                if (CompletionStampReady != prevStamp) {
+                    Cal::Utils::Futex::wait(completionStamp, CompletionStampNotReadyWithWaiter, &futexSleepTimeout);
+                }
+            }
+        }
+
+        log<Verbosity::bloat>("Packet has been processed");
+        return true;
+    }
+
+    bool notifyService() {
+        switch (serviceSynchronizationMethod) {
+        default:
+            return true;
+        case Cal::Messages::RespLaunchRpcShmemRingBuffer::semaphores:
+            return this->signalServiceSemaphore();
+        case Cal::Messages::RespLaunchRpcShmemRingBuffer::futex:
+            __atomic_thread_fence(__ATOMIC_SEQ_CST); // publish ring tail before checking for waiters
+            if (0U == __atomic_load_n(this->ringTailWaiters, __ATOMIC_RELAXED)) {
+                return true;
+            }
+            return Cal::Utils::Futex::wakeAll(this->getRingTailFutexWord());
+        }
+    }
+
     bool createRingBuffer() {
         auto remoteShmem = Cal::Ipc::allocateShmemOnRemote(this->connection, Cal::Messages::ReqAllocateShmem::rpcMessageChannel, 0U, usesSharedVaForRpcChannel); // let service choose size
         if (false == remoteShmem.isValid()) {
@@ -1094,8 +1357,19 @@ class ChannelClient : public CommandsChannel {
 
     bool useAsyncCalls = false;
     bool useBatchedCalls = false;
+    size_t maxBatchedCallsCount = BatchingThresholds::defaultMaxCallsCount;
+    std::chrono::microseconds maxBatchAge{BatchingThresholds::defaultMaxAgeUs};
+    std::chrono::steady_clock::time_point batchStartTimestamp;
+    Cal::Stats::StatsPage *stats = nullptr;
     CompletionStampT *completionStamp = nullptr;
-    Cal::Allocators::LinearAllocator cmdHeap;
+    CompletionStampBufferT completionSlots;
+    size_t completionSlotsCount = 0U;
+    CompletionStampT *lastAsyncCompletionStamp = nullptr;
+    uint64_t asyncCompletionStampsCounter = 0U;
+    bool lastSubmittedCallAsync = false;
+    CrossChannelOrdering *crossChannelOrdering = nullptr;
+    Cal::Allocators::CircularAllocator cmdHeap;
+    std::deque<std::pair<Cal::Allocators::CircularAllocator::MarkerT, CompletionStampT *>> cmdHeapPendingReclaims;
     Cal::Allocators::AddressRangeAllocator standaloneHeap;
 
     Cal::Messages::RespLaunchRpcShmemRingBuffer::ServiceSynchronizationMethod serviceSynchronizationMethod = Cal::Messages::RespLaunchRpcShmemRingBuffer::unknown;
@@ -1103,6 +1377,135 @@ class ChannelClient : public CommandsChannel {
     float semaphoreWaitThreshold = 0.0f;
 };
 
+// Thread-safe
+// Binds client threads to RPC channels, so that threads don't have to serialize
+// on a single channel while waiting for responses from the service.
+// Each thread gets its own channel (created lazily) until maxChannelsCount is reached,
+// then remaining threads share existing channels in round-robin manner.
+class ChannelClientPool {
+  public:
+    ChannelClientPool(Cal::Ipc::Connection &connection, Cal::Ipc::ShmemImporter &globalShmemImporter, Cal::Usm::UsmShmemImporter &sharedVaShmemImporter, size_t maxChannelsCount)
+        : connection(connection), globalShmemImporter(globalShmemImporter), sharedVaShmemImporter(sharedVaShmemImporter),
+          maxChannelsCount(std::max<size_t>(maxChannelsCount, 1U)), poolId(++getPoolsCounter()) {
+        this->channels.reserve(this->maxChannelsCount);
+    }
+
+    virtual ~ChannelClientPool() = default;
+
+    bool init(ChannelClient::ClientSynchronizationMethod clientSynchronizationMethod, bool useSharedVaForRpcChannel) {
+        this->clientSynchronizationMethod = clientSynchronizationMethod;
+        this->usesSharedVaForRpcChannel = useSharedVaForRpcChannel;
+
+        auto lock = std::lock_guard<std::mutex>(this->mutex);
+        auto primary = this->createChannel();
+        if (nullptr == primary) {
+            log<Verbosity::critical>("Failed to create primary RPC channel");
+            return false;
+        }
+        this->primaryChannel = primary.get();
+        this->channels.push_back(std::move(primary));
+        log<Verbosity::debug>("Created RPC channels pool (max channels count : %zu)", this->maxChannelsCount);
+        return true;
+    }
+
+    // channel used for client-wide notifications (e.g. callbacks)
+    ChannelClient &getPrimaryChannel() const {
+        return *this->primaryChannel;
+    }
+
+    ChannelClient &getChannelForThisThread() {
+        if (1U == this->maxChannelsCount) {
+            return *this->primaryChannel;
+        }
+
+        static thread_local struct {
+            uint64_t poolId = 0U;
+            ChannelClient *channel = nullptr;
+        } threadBinding;
+
+        if (threadBinding.poolId != this->poolId) {
+            threadBinding.channel = this->bindNewThread();
+            threadBinding.poolId = this->poolId;
+        }
+        return *threadBinding.channel;
+    }
+
+    size_t getChannelsCount() {
+        auto lock = std::lock_guard<std::mutex>(this->mutex);
+        return this->channels.size();
+    }
+
+    size_t getMaxChannelsCount() const {
+        return this->maxChannelsCount;
+    }
+
+    void stop() {
+        auto lock = std::lock_guard<std::mutex>(this->mutex);
+        for (auto &channel : this->channels) {
+            channel->stop();
+        }
+    }
+
+    // needs to be called before init - applies to all channels of the pool
+    void setStats(std::unique_ptr<Cal::Stats::StatsShmem> stats) {
+        this->stats = std::move(stats);
+    }
+
+  protected:
+    ChannelClient *bindNewThread() {
+        auto lock = std::lock_guard<std::mutex>(this->mutex);
+        if (this->channels.size() < this->maxChannelsCount) {
+            auto newChannel = this->createChannel();
+            if (newChannel) {
+                log<Verbosity::debug>("Bound new thread to new RPC channel : %d (channels count : %zu)", newChannel->getId(), this->channels.size() + 1);
+                this->channels.push_back(std::move(newChannel));
+                return this->channels.back().get();
+            }
+            log<Verbosity::error>("Failed to create additional RPC channel - limiting pool to %zu channel(s)", this->channels.size());
+            this->maxChannelsCount = this->channels.size();
+        }
+
+        auto sharedChannel = this->channels[this->nextSharedChannel % this->channels.size()].get();
+        ++this->nextSharedChannel;
+        log<Verbosity::debug>("Bound new thread to shared RPC channel : %d", sharedChannel->getId());
+        return sharedChannel;
+    }
+
+    mockable std::unique_ptr<ChannelClient> createChannel() {
+        auto channel = std::make_unique<ChannelClient>(this->connection, this->globalShmemImporter, this->sharedVaShmemImporter);
+        if (false == channel->init(this->clientSynchronizationMethod, this->usesSharedVaForRpcChannel)) {
+            return nullptr;
+        }
+        if (this->maxChannelsCount > 1U) {
+            channel->enableCrossChannelOrdering(this->crossChannelOrdering);
+        }
+        if (this->stats) {
+            channel->setStats(&this->stats->getPage());
+        }
+        return channel;
+    }
+
+    static std::atomic<uint64_t> &getPoolsCounter() {
+        static std::atomic<uint64_t> poolsCounter = 0U;
+        return poolsCounter;
+    }
+
+    Cal::Ipc::Connection &connection;
+    Cal::Ipc::ShmemImporter &globalShmemImporter;
+    Cal::Usm::UsmShmemImporter &sharedVaShmemImporter;
+    ChannelClient::ClientSynchronizationMethod clientSynchronizationMethod = ChannelClient::unknown;
+    bool usesSharedVaForRpcChannel = false;
+
+    size_t maxChannelsCount = 1U;
+    const uint64_t poolId = 0U;
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ChannelClient>> channels;
+    ChannelClient *primaryChannel = nullptr;
+    size_t nextSharedChannel = 0U;
+    ChannelClient::CrossChannelOrdering crossChannelOrdering;
+    std::unique_ptr<Cal::Stats::StatsShmem> stats;
+};
+
 class ChannelServer : public CommandsChannel {
   public:
     struct CommandPacket {
@@ -1141,23 +1544,42 @@ class ChannelServer : public CommandsChannel {
             return activeWait(yieldThread);
         case Cal::Messages::RespLaunchRpcShmemRingBuffer::semaphores:
             return semaphoreWait();
+        case Cal::Messages::RespLaunchRpcShmemRingBuffer::futex:
+            return hybridWait();
         default:
             log<Verbosity::critical>("Unhandled wait method");
             return {};
         }
     }
 
+    // non-blocking variant of wait() - returns empty packet if there is no pending command
+    CommandPacket tryPop() {
+        if (stopped || ring.peekEmpty()) {
+            return {};
+        }
+        return popCommandPacket();
+    }
+
+    bool isStopped() const {
+        return stopped;
+    }
+
     void stop() {
         log<Verbosity::debug>("Stoping RPC channel at iteration:%zu, head:%zu, tail:%zu, capacity:%zu",
                               this->ring.peekIteration(), this->ring.peekHeadOffset(), this->ring.peekTailOffset(), this->ring.getCapacity());
         stopped = true;
         if (Cal::Messages::RespLaunchRpcShmemRingBuffer::semaphores == serviceSynchronizationMethod) {
             this->signalServiceSemaphore();
+        } else if (Cal::Messages::RespLaunchRpcShmemRingBuffer::futex == serviceSynchronizationMethod) {
+            Cal::Utils::Futex::wakeAll(this->getRingTailFutexWord());
         }
     }
 
     void signalCompletion(CompletionStampT *completionStamp, Cal::Rpc::RpcMessageHeader::MessageFlagsT messageFlags) {
-        __atomic_store_n(completionStamp, CompletionStampReady, __ATOMIC_RELAXED);
+        auto prevStamp = __atomic_exchange_n(completionStamp, CompletionStampReady, __ATOMIC_SEQ_CST);
+        if (CompletionStampNotReadyWithWaiter == prevStamp) {
+            Cal::Utils::Futex::wakeAll(completionStamp);
+        }
         if (0 != (messageFlags & Cal::Rpc::RpcMessageHeader::signalSemaphoreOnCompletion)) {
             this->signalClientSemaphore();
         }
@@ -1173,11 +1595,27 @@ class ChannelServer : public CommandsChannel {
             log<Verbosity::critical>("Could not add transferDesc copy update notification to ring");
             return false;
         }
+        this->hostptrCopiesBytesCount += transferDesc.bytesCountToCopy;
 
         return true;
     }
 
+    // number of bytes client was requested to copy since last query (used for statistics)
+    uint64_t acquireHostptrCopiesBytesCount() {
+        return std::exchange(this->hostptrCopiesBytesCount, 0U);
+    }
+
+    // callbacks of all channels of given client are delivered through a single (primary) channel
+    void forwardCallbacksTo(ChannelServer &primaryChannel) {
+        this->callbacksChannel = &primaryChannel;
+    }
+
     bool pushCompletedCallbackId(Cal::Rpc::CallbackIdT callbackId) {
+        if (this->callbacksChannel) {
+            return this->callbacksChannel->pushCompletedCallbackId(callbackId);
+        }
+
+        std::lock_guard<std::mutex> lock(this->callbacksRingMutex);
         if (false == callbacksRing.push(callbackId, false)) {
             log<Verbosity::critical>("Could not add callbackId notification to ring");
             return false;
@@ -1200,11 +1638,7 @@ class ChannelServer : public CommandsChannel {
             }
         }
         log<Verbosity::bloat>("New command packet request arrived");
-        RingEntry newRequest = *this->ring.peekHead();
-        this->ring.pop();
-
-        return CommandPacket{getAsLocalAddress(newRequest.messageOffset), static_cast<size_t>(this->layout.clientHeapEnd - newRequest.messageOffset),
-                             newRequest.completionStampOffset == Cal::Messages::invalidOffsetWithinChannel ? nullptr : getAsLocalAddress<CompletionStampT>(newRequest.completionStampOffset)};
+        return popCommandPacket();
     }
 
     CommandPacket semaphoreWait() {
@@ -1218,6 +1652,33 @@ class ChannelServer : public CommandsChannel {
         }
 
         log<Verbosity::bloat>("New commaned packet request arrived");
+        return popCommandPacket();
+    }
+
+    CommandPacket hybridWait() {
+        log<Verbosity::bloat>("Waiting for new command packet request - hybrid wait (spin, then futex)");
+
+        auto hasNewRequest = [this]() { return false == this->ring.peekEmpty(); };
+        if (false == Cal::Utils::Futex::spinUntil(hasNewRequest)) {
+            while (ring.peekEmpty()) {
+                if (stopped) {
+                    log<Verbosity::debug>("Aborting wait for command packet request");
+                    return {};
+                }
+                auto tailSnapshot = static_cast<uint32_t>(ring.peekTailOffset());
+                __atomic_store_n(this->ringTailWaiters, 1U, __ATOMIC_SEQ_CST); // announce waiter before final check
+                if (ring.peekEmpty()) {
+                    Cal::Utils::Futex::wait(this->getRingTailFutexWord(), tailSnapshot, &futexSleepTimeout);
+                }
+                __atomic_store_n(this->ringTailWaiters, 0U, __ATOMIC_RELAXED);
+            }
+        }
+
+        log<Verbosity::bloat>("New command packet request arrived");
+        return popCommandPacket();
+    }
+
+    CommandPacket popCommandPacket() {
         RingEntry newRequest = *this->ring.peekHead();
         this->ring.pop();
 
@@ -1231,6 +1692,9 @@ class ChannelServer : public CommandsChannel {
     std::atomic_bool stopped = false;
     Cal::Messages::RespLaunchRpcShmemRingBuffer::ServiceSynchronizationMethod serviceSynchronizationMethod = Cal::Messages::RespLaunchRpcShmemRingBuffer::unknown;
     Cal::Allocators::AddressRangeAllocator serviceHeap;
+    ChannelServer *callbacksChannel = nullptr;
+    std::mutex callbacksRingMutex;
+    uint64_t hostptrCopiesBytesCount = 0U;
 };
 
 } // namespace Rpc
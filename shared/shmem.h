@@ -18,8 +18,10 @@
 #include "shared/utils.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cassert>
+#include <condition_variable>
 #include <cstdint>
 #include <deque>
 #include <errno.h>
@@ -28,11 +30,15 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/statfs.h>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -96,6 +102,15 @@ using OpenedShmemSubAllocationT = Cal::Allocators::FdSubAllocation<OpenedShmemAl
 using MmappedShmemSubAllocationT = Cal::Allocators::MmappedAllocation<OpenedShmemSubAllocationT>;
 
 // thread-safe
+// Shmem files of sizes in [minPooledSize, maxPooledSize] (powers of 2) can be served from a pool. Pool keeps spare,
+// already truncated (and optionally prefaulted) files per size class - files freed by the service are scrubbed
+// and reused, while a background thread creates new ones once the number of spare files drops below the low
+// watermark. Files that were unlinked by the client (i.e. early unlink) are destroyed as usual.
+// With memfd backing, shmems are anonymous files that clients import over the control connection (SCM_RIGHTS),
+// so nothing is left behind in /dev/shm when processes crash. Ids of such shmems are never reused, since clients
+// cache their FDs and mappings by id.
+// With hugepages enabled, allocations aligned to 2MB (or 1GB) are backed by hugetlb memfds when the hugepages can be
+// reserved, otherwise (and for named shmems) mappers only advise transparent hugepages. Hugetlb files bypass the pool.
 class ShmemAllocator final {
   public:
     static constexpr size_t maxShmems = 4096U;
@@ -103,12 +118,64 @@ class ShmemAllocator final {
     using AllocationT = OpenedShmemAllocationT;
     static constexpr size_t minAlignment = Cal::Utils::pageSize4KB;
 
+    struct PoolConfig {
+        size_t highWatermark = 0U; // max number of spare files per size class, 0 disables the pool
+        size_t lowWatermark = 0U;  // refill of size class starts when number of its spare files drops below this value
+        bool prefault = true;
+    };
+
+    static constexpr size_t minPooledSize = 64 * Cal::Utils::KB;
+    static constexpr size_t maxPooledSize = 64 * Cal::Utils::MB;
+    static constexpr size_t poolSizeClassesCount = Cal::Utils::log2Pow2(maxPooledSize / minPooledSize) + 1;
+
     ShmemAllocator() : shmemIdAllocator(maxShmems), totalShmemAvailable(queryTotalShmemAvailable()) {
     }
-    ShmemAllocator(const std::string &path) : shmemIdAllocator(maxShmems), basePath(path), totalShmemAvailable(queryTotalShmemAvailable()) {
+    ShmemAllocator(const std::string &path)
+        : ShmemAllocator(path, readPoolConfig(), Cal::Utils::getCalEnvFlag(calUseMemfdShmemEnvName, false), Cal::Utils::getCalEnvFlag(calShmemHugePagesEnvName, false)) {
+    }
+    ShmemAllocator(const std::string &path, const PoolConfig &poolConfig, bool memfdBacked = false, bool hugePages = false)
+        : shmemIdAllocator(maxShmems), basePath(path), totalShmemAvailable(queryTotalShmemAvailable()), memfdBacked(memfdBacked), hugePages(hugePages), poolConfig(poolConfig) {
+        if (this->memfdBacked) {
+            log<Verbosity::debug>("Using anonymous memfd files as shmems");
+        }
+        if (this->hugePages && this->memfdBacked) {
+            log<Verbosity::debug>("Using hugepages for large shmems");
+        } else if (this->hugePages) {
+            log<Verbosity::info>("Explicit hugepages require memfd shmems (%s=1) - only transparent hugepages will be used", calUseMemfdShmemEnvName.data());
+        }
+        if (this->poolConfig.highWatermark > 0U) {
+            log<Verbosity::debug>("Enabled pool of shmem files (low watermark : %zu, high watermark : %zu, prefault : %d)", this->poolConfig.lowWatermark, this->poolConfig.highWatermark, this->poolConfig.prefault);
+            poolRefillThread = std::thread(&ShmemAllocator::poolRefillLoop, this);
+        }
     }
 
-    mockable ~ShmemAllocator() = default;
+    mockable ~ShmemAllocator() {
+        if (poolRefillThread.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(poolMutex);
+                poolStopping = true;
+            }
+            poolWorkAvailable.notify_all();
+            poolRefillThread.join();
+        }
+        for (auto &sizeClass : poolSizeClasses) {
+            for (const auto &file : sizeClass.ready) {
+                destroy(file);
+            }
+            for (const auto &file : sizeClass.recycled) {
+                destroy(file);
+            }
+        }
+    }
+
+    static PoolConfig readPoolConfig() {
+        PoolConfig config;
+        config.highWatermark = static_cast<size_t>(std::max<int64_t>(0, Cal::Utils::getCalEnvI64(calShmemPoolHighWatermarkEnvName, 0)));
+        auto lowWatermark = Cal::Utils::getCalEnvI64(calShmemPoolLowWatermarkEnvName, static_cast<int64_t>((config.highWatermark + 1) / 2));
+        config.lowWatermark = std::min(config.highWatermark, static_cast<size_t>(std::max<int64_t>(0, lowWatermark)));
+        config.prefault = Cal::Utils::getCalEnvFlag(calShmemPoolPrefaultEnvName, true);
+        return config;
+    }
 
     size_t incrementShmemUsed(size_t sizeDiff) {
         auto incrementedShmemUsed = updateShmemUsed(sizeDiff, [](const size_t x, const size_t y) { return x + y; });
@@ -138,11 +205,76 @@ class ShmemAllocator final {
             return {};
         }
 
+        if (hugePages && memfdBacked && (alignment >= Cal::Utils::pageSize2MB)) {
+            auto hugetlbMemfd = createHugetlbMemfd(size, alignment);
+            if (hugetlbMemfd.isValid()) {
+                return hugetlbMemfd;
+            }
+        }
+
+        auto pooled = acquireFromPool(size);
+        if (pooled.isValid()) {
+            log<Verbosity::debug>("Allocated pooled shmem %s%d with size : %zu", basePath.c_str(), pooled.getShmemId(), size);
+            return pooled;
+        }
+
+        return createShmemFile(size);
+    }
+
+    mockable AllocationT allocate(size_t size) {
+        return this->allocate(size, minAlignment);
+    }
+
+    mockable void free(const AllocationT &alloc) {
+        if (recycleToPool(alloc)) {
+            return;
+        }
+        destroy(alloc);
+    }
+
+    bool usesMemfd() const {
+        return memfdBacked;
+    }
+
+    // alignment that makes allocations eligible for hugepages (0 if hugepages are disabled)
+    size_t getHugePageSize() const {
+        return hugePages ? Cal::Utils::pageSize2MB : 0U;
+    }
+
+    // calls func with FD of memfd-backed shmem (or -1 if there is no such shmem) - FD stays open until func returns
+    template <typename FuncT>
+    auto withMemfd(ShmemIdT id, FuncT &&func) {
+        std::lock_guard<std::mutex> lock(memfdsMutex);
+        auto it = memfds.find(id);
+        return func((it != memfds.end()) ? it->second : -1);
+    }
+
+    size_t getSparePooledFilesCount(size_t size) {
+        auto sizeClassId = getPoolSizeClassId(size);
+        if (poolSizeClassesCount == sizeClassId) {
+            return 0U;
+        }
+        std::lock_guard<std::mutex> lock(poolMutex);
+        return poolSizeClasses[sizeClassId].ready.size();
+    }
+
+  protected:
+    struct PoolSizeClass {
+        std::vector<AllocationT> ready;    // spare files that can be handed out
+        std::vector<AllocationT> recycled; // files freed by the service, need to be scrubbed before reuse
+        bool refilling = false;
+    };
+
+    AllocationT createShmemFile(size_t size) {
         auto updatedShmemUsed = incrementShmemUsed(size);
         if (updatedShmemUsed > (totalShmemAvailable * 0.95)) {
             log<Verbosity::warning>("Reaching size limits of /dev/shm/, allocating additional memory may fail. Please consider increasing the size of /dev/shm.");
         }
 
+        if (memfdBacked) {
+            return createMemfd(size);
+        }
+
         auto shmemId = shmemIdAllocator.allocate();
         if (Cal::Allocators::BitAllocator::invalidOffset == shmemId) {
             log<Verbosity::error>("Maximum number of shmems reached : %zu", shmemIdAllocator.getCapacity());
@@ -178,13 +310,78 @@ class ShmemAllocator final {
         return AllocationT(ShmemAllocation<>(shmemId, true), shmemFd, size, true);
     }
 
-    mockable AllocationT allocate(size_t size) {
-        return this->allocate(size, minAlignment);
+    AllocationT createMemfd(size_t size, unsigned int extraFlags = 0U) {
+        auto shmemId = nextMemfdId.fetch_add(1);
+        auto name = "cal_shmem_" + std::to_string(shmemId);
+        int shmemFd = Cal::Sys::memfd_create(name.c_str(), MFD_CLOEXEC | extraFlags);
+        if (-1 == shmemFd) {
+            auto err = errno;
+            log<Verbosity::error>("Failed to create memfd %s (errno=%d=%s)", name.c_str(), err, strerror(err));
+            decrementShmemUsed(size);
+            return {};
+        }
+
+        if (-1 == Cal::Sys::ftruncate(shmemFd, size)) {
+            log<Verbosity::error>("Failed to ftruncate memfd %s to size : %zu", name.c_str(), size);
+            Cal::Sys::close(shmemFd);
+            decrementShmemUsed(size);
+            return {};
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(memfdsMutex);
+            memfds[shmemId] = shmemFd;
+        }
+        log<Verbosity::debug>("Allocated memfd %s (FD : %d) with size : %zu", name.c_str(), shmemFd, size);
+        return AllocationT(ShmemAllocation<>(shmemId, true), shmemFd, size, true);
     }
 
-    mockable void free(const AllocationT &alloc) {
+    // hugetlb pages come from a separate pool of the kernel, which is usually small or empty - pages are reserved
+    // up front (reservation of shared mapping stays with the file), so that later page faults can't fail with SIGBUS
+    AllocationT createHugetlbMemfd(size_t size, size_t alignment) {
+        for (auto hugePageSize : {Cal::Utils::pageSize1GB, Cal::Utils::pageSize2MB}) {
+            if ((alignment < hugePageSize) || (0U != size % hugePageSize)) {
+                continue;
+            }
+
+            incrementShmemUsed(size);
+            auto file = createMemfd(size, MFD_HUGETLB | (Cal::Utils::log2Pow2(hugePageSize) << MAP_HUGE_SHIFT));
+            if (false == file.isValid()) {
+                continue;
+            }
+            auto reservation = Cal::Sys::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file.getFd(), 0);
+            if (MAP_FAILED == reservation) {
+                log<Verbosity::debug>("Could not reserve %zu hugepages of size : %zu", size / hugePageSize, hugePageSize);
+                destroy(file);
+                continue;
+            }
+            Cal::Sys::munmap(reservation, size);
+
+            {
+                std::lock_guard<std::mutex> lock(memfdsMutex);
+                hugetlbMemfds.insert(file.getShmemId());
+            }
+            log<Verbosity::debug>("Backed memfd cal_shmem_%d of size : %zu with hugepages of size : %zu", file.getShmemId(), size, hugePageSize);
+            return file;
+        }
+        return {};
+    }
+
+    bool isHugetlbMemfd(ShmemIdT id) {
+        std::lock_guard<std::mutex> lock(memfdsMutex);
+        return hugetlbMemfds.count(id) > 0U;
+    }
+
+    void destroy(const AllocationT &alloc) {
         auto path = basePath + std::to_string(alloc.getShmemId());
 
+        if (memfdBacked && alloc.isOwnerOfShmem()) {
+            // FD has to be unreachable for importers before it gets closed
+            std::lock_guard<std::mutex> lock(memfdsMutex);
+            memfds.erase(alloc.getShmemId());
+            hugetlbMemfds.erase(alloc.getShmemId());
+        }
+
         if (alloc.isOwnerOfFd()) {
             if (-1 == Cal::Sys::ftruncate(alloc.getFd(), 0)) {
                 auto err = errno;
@@ -198,7 +395,9 @@ class ShmemAllocator final {
             }
         }
 
-        if (alloc.isOwnerOfShmem()) {
+        if (alloc.isOwnerOfShmem() && memfdBacked) {
+            decrementShmemUsed(alloc.getFileSize());
+        } else if (alloc.isOwnerOfShmem()) {
             if (-1 == Cal::Sys::shm_unlink(path.c_str())) {
                 auto err = errno;
                 if (err != ENOENT) {
@@ -212,7 +411,136 @@ class ShmemAllocator final {
         }
     }
 
-  protected:
+    static size_t getPoolSizeClassId(size_t size) {
+        if ((size < minPooledSize) || (size > maxPooledSize) || (false == Cal::Utils::isPow2(size))) {
+            return poolSizeClassesCount;
+        }
+        return Cal::Utils::log2Pow2(size / minPooledSize);
+    }
+
+    static size_t getPoolSizeClassSize(size_t sizeClassId) {
+        return minPooledSize << sizeClassId;
+    }
+
+    AllocationT acquireFromPool(size_t size) {
+        auto sizeClassId = getPoolSizeClassId(size);
+        if ((0U == poolConfig.highWatermark) || (poolSizeClassesCount == sizeClassId)) {
+            return {};
+        }
+
+        AllocationT ret;
+        std::unique_lock<std::mutex> lock(poolMutex);
+        auto &sizeClass = poolSizeClasses[sizeClassId];
+        if (false == sizeClass.ready.empty()) {
+            ret = sizeClass.ready.back();
+            sizeClass.ready.pop_back();
+        }
+        if ((sizeClass.ready.size() < poolConfig.lowWatermark) && (false == sizeClass.refilling)) {
+            sizeClass.refilling = true;
+            lock.unlock();
+            poolWorkAvailable.notify_one();
+        }
+        return ret;
+    }
+
+    bool recycleToPool(const AllocationT &alloc) {
+        auto sizeClassId = getPoolSizeClassId(alloc.getFileSize());
+        if ((0U == poolConfig.highWatermark) || (poolSizeClassesCount == sizeClassId) || (false == alloc.isOwnerOfFd()) || (false == alloc.isOwnerOfShmem())) {
+            return false;
+        }
+
+        struct stat fileStat {};
+        if ((false == memfdBacked) && ((0 != Cal::Sys::fstat(alloc.getFd(), &fileStat)) || (0 == fileStat.st_nlink))) {
+            return false;
+        }
+        if (memfdBacked && isHugetlbMemfd(alloc.getShmemId())) {
+            return false; // pooled files have to be usable with any alignment
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(poolMutex);
+            auto &sizeClass = poolSizeClasses[sizeClassId];
+            if (sizeClass.ready.size() + sizeClass.recycled.size() >= poolConfig.highWatermark) {
+                return false;
+            }
+            sizeClass.recycled.push_back(alloc);
+        }
+        log<Verbosity::debug>("Returned shmem %s%d of size : %zu to pool", basePath.c_str(), alloc.getShmemId(), alloc.getFileSize());
+        poolWorkAvailable.notify_one();
+        return true;
+    }
+
+    bool hasPoolWork() const {
+        return std::any_of(poolSizeClasses.begin(), poolSizeClasses.end(), [](const auto &sizeClass) { return sizeClass.refilling || (false == sizeClass.recycled.empty()); });
+    }
+
+    // makes sure that pages of the file are allocated (zeroed), so that first touch doesn't need to do it
+    bool prefault(const AllocationT &file) {
+        if (false == poolConfig.prefault) {
+            return true;
+        }
+        auto ptr = Cal::Sys::mmap(nullptr, file.getFileSize(), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, file.getFd(), 0);
+        if (MAP_FAILED == ptr) {
+            log<Verbosity::error>("Failed to prefault shmem %s%d of size : %zu", basePath.c_str(), file.getShmemId(), file.getFileSize());
+            return false;
+        }
+        Cal::Sys::munmap(ptr, file.getFileSize());
+        return true;
+    }
+
+    // truncating drops old content, so data of previous user is never handed out to the next one
+    bool scrub(const AllocationT &file) {
+        if ((-1 == Cal::Sys::ftruncate(file.getFd(), 0)) || (-1 == Cal::Sys::ftruncate(file.getFd(), file.getFileSize()))) {
+            log<Verbosity::error>("Failed to scrub pooled shmem %s%d of size : %zu", basePath.c_str(), file.getShmemId(), file.getFileSize());
+            return false;
+        }
+        return prefault(file);
+    }
+
+    void poolRefillLoop() {
+        std::unique_lock<std::mutex> lock(poolMutex);
+        while (true) {
+            poolWorkAvailable.wait(lock, [this]() { return poolStopping || hasPoolWork(); });
+            if (poolStopping) {
+                return;
+            }
+
+            for (size_t sizeClassId = 0; sizeClassId < poolSizeClassesCount; ++sizeClassId) {
+                auto &sizeClass = poolSizeClasses[sizeClassId];
+                if (false == sizeClass.recycled.empty()) {
+                    auto file = sizeClass.recycled.back();
+                    sizeClass.recycled.pop_back();
+                    lock.unlock();
+                    bool scrubbed = scrub(file);
+                    if (false == scrubbed) {
+                        destroy(file);
+                    }
+                    lock.lock();
+                    if (scrubbed) {
+                        sizeClass.ready.push_back(file);
+                    }
+                } else if (sizeClass.refilling) {
+                    lock.unlock();
+                    auto file = createShmemFile(getPoolSizeClassSize(sizeClassId));
+                    bool created = file.isValid() && prefault(file);
+                    if (file.isValid() && (false == created)) {
+                        destroy(file);
+                    }
+                    lock.lock();
+                    if (created) {
+                        sizeClass.ready.push_back(file);
+                    } else {
+                        log<Verbosity::error>("Failed to refill pool of shmem files of size : %zu", getPoolSizeClassSize(sizeClassId));
+                        sizeClass.refilling = false;
+                    }
+                }
+                if (sizeClass.ready.size() + sizeClass.recycled.size() >= poolConfig.highWatermark) {
+                    sizeClass.refilling = false;
+                }
+            }
+        }
+    }
+
     size_t queryTotalShmemAvailable() {
         struct statfs data {};
         if (int ret = Cal::Sys::statfs("/dev/shm", &data); ret != 0u) {
@@ -227,6 +555,21 @@ class ShmemAllocator final {
     std::string basePath;
     size_t totalShmemAvailable = 0u;
     std::atomic_size_t totalShmemAllocated = 0u;
+
+    bool memfdBacked = false;
+    std::atomic<ShmemIdT> nextMemfdId = 0;
+    std::mutex memfdsMutex;
+    std::unordered_map<ShmemIdT, int> memfds;
+    std::unordered_set<ShmemIdT> hugetlbMemfds;
+
+    bool hugePages = false;
+
+    PoolConfig poolConfig;
+    std::mutex poolMutex;
+    std::condition_variable poolWorkAvailable;
+    std::array<PoolSizeClass, poolSizeClassesCount> poolSizeClasses;
+    bool poolStopping = false;
+    std::thread poolRefillThread;
 };
 
 struct RemoteShmemDesc {
@@ -252,11 +595,29 @@ class ShmemImporter {
 
     using AllocationT = MmappedShmemSubAllocationT;
 
+    struct CachedMapping {
+        AllocationT allocation;
+        uint32_t useCount = 0U;
+        uint64_t lastUse = 0U;
+    };
+
+    static constexpr int64_t defaultMappingsCacheSizeMB = 256;
+
     ShmemImporter() = default;
-    ShmemImporter(const std::string &path) : basePath(path) {
+    // memfdConnection is used to import shmems when service uses anonymous memfd files (see ShmemAllocator)
+    ShmemImporter(const std::string &path, Cal::Ipc::Connection *memfdConnection = nullptr) : basePath(path), memfdConnection(memfdConnection) {
         doEarlyUnlink = Cal::Utils::getCalEnvI64(calEarlyShmUnlinkEnvName, true);
+        // without early unlink, fds are closed on last release, so cached mappings could outlive shmem ids reused by the service
+        // (ids of memfd-backed shmems are never reused)
+        if (doEarlyUnlink || (nullptr != memfdConnection)) {
+            mappingsCacheMaxSize = static_cast<size_t>(std::max<int64_t>(0, Cal::Utils::getCalEnvI64(calShmemMappingsCacheSizeEnvName, defaultMappingsCacheSizeMB))) * Cal::Utils::MB;
+        }
+    }
+    mockable ~ShmemImporter() {
+        for (auto &[id, cached] : *mappingsCache) {
+            ShmemImporter::release(cached.allocation);
+        }
     }
-    mockable ~ShmemImporter() = default;
 
     mockable AllocationT open(ShmemIdT id, size_t offset, size_t size, void *enforcedVaForMmap) {
         if (invalidShmemId == id) {
@@ -276,7 +637,7 @@ class ShmemImporter {
             }
         }
         auto path = basePath + std::to_string(id);
-        int shmemFd = this->getFileDescriptor(path);
+        int shmemFd = memfdConnection ? this->importMemfd(id, path) : this->getFileDescriptor(path);
         if (-1 == shmemFd) {
             log<Verbosity::error>("Failed to open shmem object for path : %s", path.c_str());
             return {};
@@ -317,6 +678,76 @@ class ShmemImporter {
         }
     }
 
+    // Maps whole shmem for a memory transfer, reusing mapping left by previous transfers (if any).
+    // Allocation has to be returned with releaseCached().
+    mockable AllocationT openCached(ShmemIdT id, size_t size) {
+        if (0U == mappingsCacheMaxSize) {
+            return this->open(id, size, nullptr);
+        }
+
+        std::vector<AllocationT> evicted;
+        AllocationT ret;
+        {
+            auto lock = mappingsCache.lock();
+            auto it = mappingsCache->find(id);
+            if ((it != mappingsCache->end()) && (it->second.allocation.getMmappedSize() != size)) {
+                if (it->second.useCount > 0U) {
+                    log<Verbosity::debug>("Cached mapping of shmem %d is in use with different size - mapping it again", id);
+                    lock.unlock();
+                    return this->open(id, size, nullptr);
+                }
+                evicted.push_back(it->second.allocation);
+                mappingsCacheSize -= it->second.allocation.getMmappedSize();
+                mappingsCache->erase(it);
+                it = mappingsCache->end();
+            }
+
+            if (it == mappingsCache->end()) {
+                ret = this->open(id, size, nullptr);
+                if (ret.isValid()) {
+                    it = mappingsCache->emplace(id, CachedMapping{ret, 0U, 0U}).first;
+                    mappingsCacheSize += size;
+                }
+            }
+
+            if (it != mappingsCache->end()) {
+                ++it->second.useCount;
+                it->second.lastUse = ++mappingsCacheClock;
+                ret = it->second.allocation;
+                trimMappingsCache(evicted);
+            }
+        }
+
+        for (const auto &allocation : evicted) {
+            this->release(allocation);
+        }
+        return ret;
+    }
+
+    mockable void releaseCached(const AllocationT &shmem) {
+        std::vector<AllocationT> evicted;
+        {
+            auto lock = mappingsCache.lock();
+            auto it = mappingsCache->find(shmem.getShmemId());
+            if ((it == mappingsCache->end()) || (it->second.allocation.getMmappedPtr() != shmem.getMmappedPtr())) {
+                lock.unlock();
+                this->release(shmem);
+                return;
+            }
+            --it->second.useCount;
+            trimMappingsCache(evicted);
+        }
+
+        for (const auto &allocation : evicted) {
+            this->release(allocation);
+        }
+    }
+
+    size_t getMappingsCacheSize() {
+        auto lock = mappingsCache.lock();
+        return mappingsCacheSize;
+    }
+
     const std::string &getBasePath() {
         return this->basePath;
     }
@@ -344,6 +775,37 @@ class ShmemImporter {
         return fd;
     }
 
+    int importMemfd(ShmemIdT id, const std::string &path) {
+        auto fileMapLock = fileMap.lock();
+        auto iter = (*fileMap).find(path);
+        if (iter != (*fileMap).end()) {
+            ++iter->second.refcnt;
+            return iter->second.fd;
+        }
+
+        Cal::Messages::ReqImportShmem request(id);
+        Cal::Messages::RespImportShmem response;
+        int fd = -1;
+        {
+            auto connectionLock = memfdConnection->lock();
+            if ((false == memfdConnection->send(request)) || (false == memfdConnection->receive(response)) || response.isInvalid()) {
+                log<Verbosity::error>("Failed to request import of memfd shmem %d from service", id);
+                return -1;
+            }
+            if (false == response.available) {
+                log<Verbosity::error>("Service does not know memfd shmem %d", id);
+                return -1;
+            }
+            if (false == memfdConnection->receiveFds(&fd, 1)) {
+                log<Verbosity::error>("Failed to receive FD of memfd shmem %d from service", id);
+                return -1;
+            }
+        }
+        log<Verbosity::debug>("Imported memfd shmem %d as FD %d", id, fd);
+        (*fileMap)[path] = {fd, 1};
+        return fd;
+    }
+
     void closeFileDescriptor(const AllocationT &shmem, const std::string &path) {
         auto fileMapLock = fileMap.lock();
         auto iter = (*fileMap).find(path);
@@ -361,7 +823,7 @@ class ShmemImporter {
             log<Verbosity::error>("Found incorrect refcnt %d for path : %s with shmem FD %d", fd, path.c_str(), shmem.getFd());
             return;
         }
-        if (doEarlyUnlink) {
+        if (doEarlyUnlink && (nullptr == memfdConnection)) {
             --iter->second.refcnt;
         } else {
             if (refcnt == 1) {
@@ -379,9 +841,33 @@ class ShmemImporter {
     }
 
   protected:
+    // evicts least recently used mappings that are not in use, until cache fits into its limit
+    void trimMappingsCache(std::vector<AllocationT> &evicted) {
+        while (mappingsCacheSize > mappingsCacheMaxSize) {
+            auto lru = mappingsCache->end();
+            for (auto it = mappingsCache->begin(); it != mappingsCache->end(); ++it) {
+                if ((0U == it->second.useCount) && ((lru == mappingsCache->end()) || (it->second.lastUse < lru->second.lastUse))) {
+                    lru = it;
+                }
+            }
+            if (lru == mappingsCache->end()) {
+                return;
+            }
+            evicted.push_back(lru->second.allocation);
+            mappingsCacheSize -= lru->second.allocation.getMmappedSize();
+            mappingsCache->erase(lru);
+        }
+    }
+
     std::string basePath;
+    Cal::Ipc::Connection *memfdConnection = nullptr;
     Cal::Utils::Lockable<std::unordered_map<std::string, RefCountedFd>> fileMap{};
     bool doEarlyUnlink = false;
+
+    Cal::Utils::Lockable<std::unordered_map<ShmemIdT, CachedMapping>> mappingsCache{};
+    size_t mappingsCacheMaxSize = 0U;
+    size_t mappingsCacheSize = 0U;
+    uint64_t mappingsCacheClock = 0U;
 };
 
 inline RemoteShmemDesc allocateShmemOnRemote(Cal::Ipc::Connection &remoteConnection,
@@ -439,7 +925,8 @@ class NonUsmMmappedShmemArenaAllocator : public NonUsmMmappedShmemArenaAllocator
     static_assert(NonUsmMmappedShmemArenaAllocatorBaseT::isThreadSafe);
 
     NonUsmMmappedShmemArenaAllocator(ShmemAllocator &shmemAllocator)
-        : NonUsmMmappedShmemArenaAllocatorBaseT(NonUsmMmappedShmemAllocator(shmemAllocator), Cal::Utils::MB * 64) {
+        : NonUsmMmappedShmemArenaAllocatorBaseT(NonUsmMmappedShmemAllocator(shmemAllocator), Cal::Utils::MB * 64, shmemAllocator.getHugePageSize(), true) {
+        this->setIdleTrimming(Cal::Utils::IdleTrimmer::readConfig());
     }
 };
 
@@ -672,14 +1159,17 @@ class BasicMemoryBlock {
         const auto srcBegin = reinterpret_cast<uintptr_t>(srcPtr);
         const auto srcEnd = srcBegin + srcSize;
 
-        const auto chunkOverlaps = [this, srcBegin, srcEnd](const auto &chunk) {
-            const auto chunkBegin = chunk.firstPageAddress;
-            const auto chunkEnd = chunkBegin + chunk.shmem.getFileSize();
-
-            return overlaps(srcBegin, srcEnd, chunkBegin, chunkEnd);
-        };
+        size_t count{0};
+        for (auto it = getFirstChunkEndingAfter(srcBegin); it != chunks.end(); ++it) {
+            const auto chunkBegin = it->firstPageAddress;
+            const auto chunkEnd = chunkBegin + it->shmem.getFileSize();
+            if (!overlaps(srcBegin, srcEnd, chunkBegin, chunkEnd)) {
+                break;
+            }
+            ++count;
+        }
 
-        return std::count_if(chunks.begin(), chunks.end(), chunkOverlaps);
+        return count;
     }
 
     bool appendOverlappingChunks(const void *srcPtr,
@@ -690,37 +1180,48 @@ class BasicMemoryBlock {
         const auto srcBegin = reinterpret_cast<uintptr_t>(srcPtr);
         const auto srcEnd = srcBegin + srcSize;
 
-        for (const auto &chunk : chunks) {
+        for (auto it = getFirstChunkEndingAfter(srcBegin); it != chunks.end(); ++it) {
+            const auto &chunk = *it;
             const auto chunkBegin = chunk.firstPageAddress;
             const auto chunkEnd = chunkBegin + chunk.shmem.getFileSize();
 
-            if (overlaps(srcBegin, srcEnd, chunkBegin, chunkEnd)) {
-                // Not enough space.
-                if (appendedTransfersCount >= transferDescsCount) {
-                    return false;
-                }
+            if (!overlaps(srcBegin, srcEnd, chunkBegin, chunkEnd)) {
+                break;
+            }
 
-                transferDescs[appendedTransfersCount].shmemId = chunk.shmem.getShmemId();
-                transferDescs[appendedTransfersCount].underlyingSize = chunk.shmem.getFileSize();
+            // Not enough space.
+            if (appendedTransfersCount >= transferDescsCount) {
+                return false;
+            }
 
-                const auto copyBegin = std::max(chunkBegin, srcBegin);
-                const auto copyEnd = std::min(chunkEnd, srcEnd);
-                const auto bytesCountToCopy = copyEnd - copyBegin;
+            transferDescs[appendedTransfersCount].shmemId = chunk.shmem.getShmemId();
+            transferDescs[appendedTransfersCount].underlyingSize = chunk.shmem.getFileSize();
 
-                transferDescs[appendedTransfersCount].bytesCountToCopy = bytesCountToCopy;
-                transferDescs[appendedTransfersCount].clientAddress = copyBegin;
+            const auto copyBegin = std::max(chunkBegin, srcBegin);
+            const auto copyEnd = std::min(chunkEnd, srcEnd);
+            const auto bytesCountToCopy = copyEnd - copyBegin;
 
-                const auto offset = copyBegin - chunkBegin;
-                transferDescs[appendedTransfersCount].offsetFromResourceStart = offset;
+            transferDescs[appendedTransfersCount].bytesCountToCopy = bytesCountToCopy;
+            transferDescs[appendedTransfersCount].clientAddress = copyBegin;
 
-                ++appendedTransfersCount;
-            }
+            const auto offset = copyBegin - chunkBegin;
+            transferDescs[appendedTransfersCount].offsetFromResourceStart = offset;
+
+            ++appendedTransfersCount;
         }
 
         return true;
     }
 
   protected:
+    // Chunks are sorted by address and cover the block without holes, so overlapping ones can be found with binary search.
+    std::deque<ChunkDescription>::const_iterator getFirstChunkEndingAfter(uintptr_t address) const {
+        auto it = std::upper_bound(chunks.begin(), chunks.end(), address, [](uintptr_t address, const ChunkDescription &chunk) {
+            return address < chunk.firstPageAddress;
+        });
+        return (it == chunks.begin()) ? it : std::prev(it);
+    }
+
     void prependChunk(uintptr_t blockBegin, uintptr_t srcPageBegin) {
         auto &prependedChunk = chunks.emplace_front();
         prependedChunk.firstPageAddress = srcPageBegin;
@@ -808,18 +1309,9 @@ class BasicMemoryBlocksManager {
             if (memoryBlock) {
                 transferDescsCount += memoryBlock->getCountOfOverlappingChunks(chunks[i].address, chunks[i].size);
                 continue;
-            } else {
-                bool foundAsUSM{false};
-                for (auto &pair : usmMemoryPairs) {
-                    if (pair.first == chunks[i].address) {
-                        transferDescsCount++;
-                        foundAsUSM = true;
-                        break;
-                    }
-                }
-                if (foundAsUSM) {
-                    continue;
-                }
+            } else if (usmMemoryPairs.count(chunks[i].address)) {
+                transferDescsCount++;
+                continue;
             }
 
             log<Verbosity::error>("Could not retrieve memory block, which includes given chunk!");
@@ -829,7 +1321,7 @@ class BasicMemoryBlocksManager {
         return true;
     }
 
-    inline void fillTransferDescFromUsmPair(Cal::Rpc::TransferDesc &transferDesc, std::pair<const void *, size_t> &usmMemoryPair) {
+    inline void fillTransferDescFromUsmPair(Cal::Rpc::TransferDesc &transferDesc, const std::pair<const void *, size_t> &usmMemoryPair) {
         transferDesc.offsetFromResourceStart = reinterpret_cast<uint64_t>(usmMemoryPair.first);
         transferDesc.bytesCountToCopy = usmMemoryPair.second;
         transferDesc.shmemId = -1;
@@ -854,20 +1346,11 @@ class BasicMemoryBlocksManager {
                     return false;
                 }
                 continue;
-            } else {
-                bool foundAsUSM{false};
-                for (auto &pair : usmMemoryPairs) {
-                    if (pair.first == chunks[i].address) {
-                        fillTransferDescFromUsmPair(transferDescs[appendedTransfersCount], pair);
-                        appendedTransfersCount++;
-                        usmMemoryPairs.erase(pair.first);
-                        foundAsUSM = true;
-                        break;
-                    }
-                }
-                if (foundAsUSM) {
-                    continue;
-                }
+            } else if (auto usmPair = usmMemoryPairs.find(chunks[i].address); usmPair != usmMemoryPairs.end()) {
+                fillTransferDescFromUsmPair(transferDescs[appendedTransfersCount], *usmPair);
+                appendedTransfersCount++;
+                usmMemoryPairs.erase(usmPair);
+                continue;
             }
 
             log<Verbosity::error>("Could not retrieve memory block, which includes given chunk!");
@@ -881,12 +1364,10 @@ class BasicMemoryBlocksManager {
     bool getRequiredTransferDescs(Cal::Utils::AddressRange range, std::vector<Cal::Rpc::TransferDesc> &transferDescs) {
         auto memoryBlock = getMemoryBlockWhichIncludesChunk(range.base(), range.size());
         if (!memoryBlock) {
-            for (auto &pair : usmMemoryPairs) {
-                if (pair.first == range.base()) {
-                    fillTransferDescFromUsmPair(transferDescs.emplace_back(), pair);
-                    usmMemoryPairs.erase(pair.first);
-                    return true;
-                }
+            if (auto usmPair = usmMemoryPairs.find(range.base()); usmPair != usmMemoryPairs.end()) {
+                fillTransferDescFromUsmPair(transferDescs.emplace_back(), *usmPair);
+                usmMemoryPairs.erase(usmPair);
+                return true;
             }
 
             log<Verbosity::error>("Could not retrieve memory block, which includes given range!");
@@ -915,6 +1396,13 @@ class BasicMemoryBlocksManager {
         return true;
     }
 
+    // address of service's mapping of client memory described by given transfer (nullptr if it's not a part of any memory block)
+    void *translateTransferDesc(const Cal::Rpc::TransferDesc &transferDesc) {
+        const auto clientAddress = reinterpret_cast<const void *>(transferDesc.clientAddress);
+        auto memoryBlock = getMemoryBlockWhichIncludesChunk(clientAddress, transferDesc.bytesCountToCopy);
+        return memoryBlock ? memoryBlock->translate(clientAddress) : nullptr;
+    }
+
   protected:
     BasicMemoryBlockT *getMemoryBlockWhichIncludesChunk(const void *srcptr, size_t size) {
         const auto overlappingBegin = getOverlappingBlocksBegin(srcptr, size);
@@ -923,8 +1411,8 @@ class BasicMemoryBlocksManager {
         }
 
         const auto overlappingEnd = getOverlappingBlocksEnd(srcptr, size);
-        const auto overlappingBlocksCount = std::distance(overlappingBegin, overlappingEnd);
-        if (overlappingBlocksCount != 1) {
+        if (std::next(overlappingBegin) != overlappingEnd) {
+            const auto overlappingBlocksCount = std::distance(overlappingBegin, overlappingEnd);
             log<Verbosity::error>("Number of registered overlapping blocks should be 1! Actual value: %d", static_cast<int>(overlappingBlocksCount));
 
             std::stringstream errorMessage;
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/idle_trimmer.h"
+
 #include <algorithm>
 #include <cstddef>
 #include <mutex>
@@ -20,10 +22,13 @@ class StagingAreaManager {
         void *ptr{};
         size_t size{};
         bool isInUse{};
+        Cal::Utils::IdleTrimmer::ClockT::time_point lastUse{};
     };
 
     StagingAreaManager() = delete;
     StagingAreaManager(Allocator allocator, Deallocator deallocator) : allocator(allocator), deallocator(deallocator) {}
+    StagingAreaManager(Allocator allocator, Deallocator deallocator, const Cal::Utils::IdleTrimmer::Config &idleTrimming)
+        : allocator(allocator), deallocator(deallocator), idleTrimmer(idleTrimming) {}
     ~StagingAreaManager() {
         clearStagingAreaAllocations();
     }
@@ -37,6 +42,13 @@ class StagingAreaManager {
     }
 
     void *allocateStagingArea(size_t size) {
+        if (idleTrimmer.isEnabled()) { // trimming is piggybacked on allocations, as frees may happen with RPC channel locked
+            auto now = Cal::Utils::IdleTrimmer::ClockT::now();
+            if (idleTrimmer.shouldTrim(now)) {
+                this->trimIdleStagingAreas(now);
+            }
+        }
+
         std::lock_guard<std::mutex> lock(mutex);
         auto found = std::find_if(allocations.begin(), allocations.end(), [size](const auto &it) {
             return (false == it.isInUse) && (it.size == size);
@@ -58,6 +70,9 @@ class StagingAreaManager {
         });
         if (found != allocations.end()) {
             found->isInUse = false;
+            if (idleTrimmer.isEnabled()) {
+                found->lastUse = Cal::Utils::IdleTrimmer::ClockT::now();
+            }
         }
     }
 
@@ -72,6 +87,27 @@ class StagingAreaManager {
         }
     }
 
+    // deallocates staging areas that stayed unused for longer than idle timeout (except for low watermark of most recently used ones)
+    size_t trimIdleStagingAreas(Cal::Utils::IdleTrimmer::ClockT::time_point now) {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<size_t> unusedAreas;
+        std::vector<Cal::Utils::IdleTrimmer::ClockT::time_point> lastUses;
+        for (size_t i = 0; i < allocations.size(); ++i) {
+            if (false == allocations[i].isInUse) {
+                unusedAreas.push_back(i);
+                lastUses.push_back(allocations[i].lastUse);
+            }
+        }
+
+        auto toTrim = idleTrimmer.selectEntriesToTrim(lastUses, now);
+        for (auto it = toTrim.rbegin(); it != toTrim.rend(); ++it) { // from the back, so that indices stay valid
+            auto areaIt = allocations.begin() + unusedAreas[*it];
+            deallocator(areaIt->ptr);
+            allocations.erase(areaIt);
+        }
+        return toTrim.size();
+    }
+
   protected:
     std::vector<StagingArea> allocations{};
 
@@ -79,4 +115,5 @@ class StagingAreaManager {
     std::mutex mutex{};
     Allocator allocator;
     Deallocator deallocator;
+    Cal::Utils::IdleTrimmer idleTrimmer; // disabled by default
 };
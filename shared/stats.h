@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "include/cal.h"
+#include "shared/log.h"
+#include "shared/rpc_message.h"
+#include "shared/sys.h"
+#include "shared/utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <linux/taskstats.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <sys/mman.h>
+#include <sys/types.h>
+
+namespace Cal::Stats {
+
+// per-API call statistics, updated concurrently by service and client threads (lock-free)
+struct CallStats {
+    // bucket 0 holds latencies < 1ns, bucket i holds latencies in [2^(i-1), 2^i) ns, last bucket holds all above
+    static constexpr size_t latencyBucketsCount = 32U;
+
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> bytesCopied;
+    std::atomic<uint64_t> totalLatencyNs;
+    std::atomic<uint64_t> latencyHistogram[latencyBucketsCount];
+
+    static size_t getLatencyBucket(uint64_t latencyNs) {
+        if (0U == latencyNs) {
+            return 0U;
+        }
+        return std::min<size_t>(Cal::Utils::leadingBitNum(latencyNs), latencyBucketsCount - 1);
+    }
+
+    // lower bound of latencies (in ns) that land in given bucket
+    static uint64_t getLatencyBucketLowerBound(size_t bucket) {
+        return (0U == bucket) ? 0U : (1ULL << (bucket - 1));
+    }
+
+    void record(uint64_t latencyNs, uint64_t bytesCopied) {
+        this->count.fetch_add(1, std::memory_order_relaxed);
+        this->totalLatencyNs.fetch_add(latencyNs, std::memory_order_relaxed);
+        this->latencyHistogram[getLatencyBucket(latencyNs)].fetch_add(1, std::memory_order_relaxed);
+        if (bytesCopied) {
+            this->bytesCopied.fetch_add(bytesCopied, std::memory_order_relaxed);
+        }
+    }
+};
+static_assert(std::atomic<uint64_t>::is_always_lock_free); // required for sharing between processes
+static_assert(std::is_standard_layout_v<CallStats>);
+
+// kinds of memory that service accounts per client - USM allocations are accounted as device/host/shared (regardless of backing),
+// shmem covers remaining shmems (e.g. RPC channels, staging areas), shared VA overlaps other kinds (memory that is mapped at the same addresses in client and service)
+enum MemoryKind : uint32_t {
+    device = 0,
+    host,
+    shared,
+    shmem,
+    sharedVa,
+    memoryKindsCount
+};
+inline constexpr const char *memoryKindNames[memoryKindsCount] = {"device", "host", "shared", "shmem", "shared_va"};
+
+inline std::optional<MemoryKind> getMemoryKindByName(const char *name) {
+    for (uint32_t kind = 0; kind < memoryKindsCount; ++kind) {
+        if (0 == strcmp(memoryKindNames[kind], name)) {
+            return static_cast<MemoryKind>(kind);
+        }
+    }
+    return std::nullopt;
+}
+
+// per-client memory usage (in bytes) and quotas, updated by service
+struct MemoryUsageStats {
+    std::atomic<uint64_t> bytesInUse[memoryKindsCount];
+    std::atomic<uint64_t> peakBytesInUse[memoryKindsCount];
+    std::atomic<uint64_t> softQuota[memoryKindsCount]; // 0 means no quota
+    std::atomic<uint64_t> hardQuota[memoryKindsCount]; // 0 means no quota
+    std::atomic<uint64_t> rejectedAllocations[memoryKindsCount];
+};
+static_assert(std::is_standard_layout_v<MemoryUsageStats>);
+
+// per-client statistics page that lives in shared memory - created by service, updated by service and client, read by calstat
+struct StatsPage {
+    static constexpr uint64_t magicValue = 0x5441545354534c41; // "ALSTSTAT"
+    static constexpr uint32_t currentVersion = 2U;
+    static constexpr size_t messageTypesCount = Cal::Rpc::RpcMessageHeader::messageTypeRpcLevelZero + 1;
+    static constexpr size_t messageSubtypesCount = 512U;
+
+    uint64_t magic;
+    uint32_t version;
+    pid_t clientPid;
+    uint64_t clientOrdinal;
+    char clientProcessName[TS_COMM_LEN];
+
+    CallStats serviced[messageTypesCount][messageSubtypesCount];    // time spent by service in RPC handlers (including bytes copied back to client)
+    CallStats clientWaits[messageTypesCount][messageSubtypesCount]; // time spent by client waiting for completion of synchronous calls
+    MemoryUsageStats memoryUsage;                                   // memory allocated by service on behalf of client
+
+    bool isValid() const {
+        return (magicValue == magic) && (currentVersion == version);
+    }
+
+    static bool isInRange(const Cal::Rpc::RpcMessageHeader &header) {
+        return (header.type < messageTypesCount) && (header.subtype < messageSubtypesCount);
+    }
+
+    CallStats *getServiced(const Cal::Rpc::RpcMessageHeader &header) {
+        return isInRange(header) ? &serviced[header.type][header.subtype] : nullptr;
+    }
+
+    CallStats *getClientWaits(const Cal::Rpc::RpcMessageHeader &header) {
+        return isInRange(header) ? &clientWaits[header.type][header.subtype] : nullptr;
+    }
+};
+static_assert(std::is_standard_layout_v<StatsPage>);
+
+inline std::string getStatsShmemPathPrefix() {
+    return std::string(calShmemPathPrefix) + "stats_";
+}
+
+inline std::string getStatsShmemPath(pid_t servicePid, uint64_t clientOrdinal) {
+    return getStatsShmemPathPrefix() + std::to_string(servicePid) + "_" + std::to_string(clientOrdinal);
+}
+
+inline uint64_t getTimestampNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// mapping of stats page - service creates (and unlinks) it, client and calstat open existing one
+class StatsShmem {
+  public:
+    static std::unique_ptr<StatsShmem> create(pid_t servicePid, uint64_t clientOrdinal, pid_t clientPid, const char *clientProcessName) {
+        auto path = getStatsShmemPath(servicePid, clientOrdinal);
+        Cal::Sys::shm_unlink(path.c_str()); // stale file (if exists)
+        int fd = Cal::Sys::shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        if (-1 == fd) {
+            auto err = errno;
+            log<Verbosity::error>("Failed to create stats shmem for path : %s (errno=%d=%s)", path.c_str(), err, strerror(err));
+            return nullptr;
+        }
+        if (-1 == Cal::Sys::ftruncate(fd, sizeof(StatsPage))) {
+            log<Verbosity::error>("Failed to ftruncate stats shmem %s to size : %zu", path.c_str(), sizeof(StatsPage));
+            Cal::Sys::close(fd);
+            Cal::Sys::shm_unlink(path.c_str());
+            return nullptr;
+        }
+        auto page = map(fd, false);
+        Cal::Sys::close(fd);
+        if (nullptr == page) {
+            log<Verbosity::error>("Failed to mmap stats shmem %s", path.c_str());
+            Cal::Sys::shm_unlink(path.c_str());
+            return nullptr;
+        }
+
+        // freshly truncated file is zeroed - only header needs to be filled
+        page->clientPid = clientPid;
+        page->clientOrdinal = clientOrdinal;
+        strncpy(page->clientProcessName, clientProcessName, sizeof(page->clientProcessName) - 1);
+        page->version = StatsPage::currentVersion;
+        std::atomic_thread_fence(std::memory_order_release);
+        page->magic = StatsPage::magicValue;
+        log<Verbosity::debug>("Created stats shmem %s for client ordinal : %llu", path.c_str(), static_cast<unsigned long long>(clientOrdinal));
+
+        return std::unique_ptr<StatsShmem>(new StatsShmem(path, page, true));
+    }
+
+    static std::unique_ptr<StatsShmem> open(const std::string &path, bool readOnly) {
+        int fd = Cal::Sys::shm_open(path.c_str(), readOnly ? O_RDONLY : O_RDWR, 0);
+        if (-1 == fd) {
+            log<Verbosity::debug>("Could not open stats shmem %s", path.c_str());
+            return nullptr;
+        }
+        auto page = map(fd, readOnly);
+        Cal::Sys::close(fd);
+        if (nullptr == page) {
+            log<Verbosity::error>("Failed to mmap stats shmem %s", path.c_str());
+            return nullptr;
+        }
+        if (false == page->isValid()) {
+            log<Verbosity::error>("Stats shmem %s has unknown format", path.c_str());
+            Cal::Sys::munmap(page, sizeof(StatsPage));
+            return nullptr;
+        }
+        return std::unique_ptr<StatsShmem>(new StatsShmem(path, page, false));
+    }
+
+    ~StatsShmem() {
+        Cal::Sys::munmap(page, sizeof(StatsPage));
+        if (isOwner) {
+            Cal::Sys::shm_unlink(path.c_str());
+        }
+    }
+
+    StatsShmem(const StatsShmem &) = delete;
+    StatsShmem &operator=(const StatsShmem &) = delete;
+
+    StatsPage &getPage() {
+        return *page;
+    }
+
+    const std::string &getPath() const {
+        return path;
+    }
+
+  protected:
+    StatsShmem(const std::string &path, StatsPage *page, bool isOwner) : path(path), page(page), isOwner(isOwner) {
+    }
+
+    static StatsPage *map(int fd, bool readOnly) {
+        auto ptr = Cal::Sys::mmap(nullptr, sizeof(StatsPage), readOnly ? PROT_READ : (PROT_READ | PROT_WRITE), MAP_SHARED, fd, 0);
+        return (MAP_FAILED == ptr) ? nullptr : reinterpret_cast<StatsPage *>(ptr);
+    }
+
+    std::string path;
+    StatsPage *page = nullptr;
+    bool isOwner = false;
+};
+
+} // namespace Cal::Stats
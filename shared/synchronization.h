@@ -7,10 +7,15 @@
 
 #pragma once
 
+#include "shared/log.h"
+#include "shared/sys.h"
 #include "shared/utils.h"
 
 #include <atomic>
+#include <cerrno>
 #include <chrono>
+#include <limits>
+#include <linux/futex.h>
 #include <thread>
 
 namespace Cal {
@@ -110,5 +115,51 @@ ReturnT waitForCompletionWithTimeout(ContextT ctx, std::chrono::nanoseconds time
     }
 }
 
+// Hybrid (spin-then-sleep) waiting on 32-bit words that can live in memory shared between processes
+// (hence no FUTEX_PRIVATE_FLAG). Waiter announces itself before going to sleep, so that producer
+// can skip the FUTEX_WAKE syscall when nobody sleeps.
+namespace Futex {
+
+inline constexpr uint32_t spinIterations = 4096U; // polling iterations before going to sleep
+
+inline void relaxCpu() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+template <typename PredicateT>
+bool spinUntil(PredicateT &&isReady) {
+    for (uint32_t i = 0; i < spinIterations; ++i) {
+        if (isReady()) {
+            return true;
+        }
+        relaxCpu();
+    }
+    return isReady();
+}
+
+// returns immediately if *word != expectedValue, timeout == nullptr means infinite wait
+inline bool wait(uint32_t *word, uint32_t expectedValue, const struct timespec *timeout = nullptr) {
+    if (0 == Cal::Sys::futex(word, FUTEX_WAIT, expectedValue, timeout)) {
+        return true;
+    }
+    if ((EAGAIN == errno) || (EINTR == errno) || (ETIMEDOUT == errno)) {
+        return true;
+    }
+    log<Verbosity::error>("FUTEX_WAIT failed (errno = %d)", errno);
+    return false;
+}
+
+inline bool wakeAll(uint32_t *word) {
+    if (0 > Cal::Sys::futex(word, FUTEX_WAKE, std::numeric_limits<int>::max(), nullptr)) {
+        log<Verbosity::error>("FUTEX_WAKE failed (errno = %d)", errno);
+        return false;
+    }
+    return true;
+}
+
+} // namespace Futex
+
 } // namespace Utils
 } // namespace Cal
@@ -7,6 +7,8 @@
 
 #include "shared/sys.h"
 
+#include <sys/syscall.h>
+
 namespace Cal {
 namespace Sys {
 
@@ -23,14 +25,23 @@ std::unique_ptr<std::istream> (*openFileForRead)(const char *filename, std::ios_
 
 int (*shm_open)(const char *name, int oflag, mode_t mode) = ::shm_open;
 int (*shm_unlink)(const char *name) = ::shm_unlink;
+int (*memfd_create)(const char *name, unsigned int flags) = ::memfd_create;
 
 int (*mprotect)(void *addr, size_t len, int prot) = ::mprotect;
+int (*madvise)(void *addr, size_t length, int advice) = ::madvise;
 
 int (*sem_init)(sem_t *sem, int pshared, unsigned int value) = ::sem_init;
 int (*sem_destroy)(sem_t *sem) = ::sem_destroy;
 int (*sem_wait)(sem_t *sem) = ::sem_wait;
 int (*sem_post)(sem_t *sem) = ::sem_post;
 
+long (*futex)(uint32_t *uaddr, int futexOp, uint32_t val, const struct timespec *timeout) = +[](uint32_t *uaddr, int futexOp, uint32_t val, const struct timespec *timeout) -> long {
+    return ::syscall(SYS_futex, uaddr, futexOp, val, timeout, nullptr, 0);
+};
+
+ssize_t (*process_vm_readv)(pid_t pid, const struct iovec *localIov, unsigned long localIovCount, const struct iovec *remoteIov, unsigned long remoteIovCount, unsigned long flags) = ::process_vm_readv;
+ssize_t (*process_vm_writev)(pid_t pid, const struct iovec *localIov, unsigned long localIovCount, const struct iovec *remoteIov, unsigned long remoteIovCount, unsigned long flags) = ::process_vm_writev;
+
 int (*close)(int fd) = ::close;
 int (*ftruncate)(int fd, off_t length) = ::ftruncate;
 int (*statfs)(const char *path, struct statfs *buf) = ::statfs;
@@ -44,6 +55,7 @@ int (*flock)(int fd, int operation) = ::flock;
 int (*mkdir)(const char *path, mode_t mode) = ::mkdir;
 int (*chmod)(const char *pathname, mode_t mode) = ::chmod;
 int (*stat)(const char *path, struct stat *buf) = ::stat;
+int (*fstat)(int fd, struct stat *buf) = ::fstat;
 
 } // namespace Sys
 } // namespace Cal
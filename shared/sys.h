@@ -17,6 +17,8 @@
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/statfs.h>
+#include <sys/uio.h>
+#include <time.h>
 #include <unistd.h>
 
 namespace Cal {
@@ -32,15 +34,22 @@ extern int (*unsetenv)(const char *name);
 extern std::unique_ptr<std::istream> (*openFileForRead)(const char *filename, std::ios_base::openmode mode);
 
 extern int (*mprotect)(void *addr, size_t len, int prot);
+extern int (*madvise)(void *addr, size_t length, int advice);
 
 extern int (*shm_open)(const char *name, int oflag, mode_t mode);
 extern int (*shm_unlink)(const char *name);
+extern int (*memfd_create)(const char *name, unsigned int flags);
 
 extern int (*sem_init)(sem_t *sem, int pshared, unsigned int value);
 extern int (*sem_destroy)(sem_t *sem);
 extern int (*sem_wait)(sem_t *sem);
 extern int (*sem_post)(sem_t *sem);
 
+extern long (*futex)(uint32_t *uaddr, int futexOp, uint32_t val, const struct timespec *timeout);
+
+extern ssize_t (*process_vm_readv)(pid_t pid, const struct iovec *localIov, unsigned long localIovCount, const struct iovec *remoteIov, unsigned long remoteIovCount, unsigned long flags);
+extern ssize_t (*process_vm_writev)(pid_t pid, const struct iovec *localIov, unsigned long localIovCount, const struct iovec *remoteIov, unsigned long remoteIovCount, unsigned long flags);
+
 extern int (*ftruncate)(int fd, off_t length);
 extern int (*close)(int fd);
 extern int (*statfs)(const char *path, struct statfs *buf);
@@ -54,6 +63,7 @@ extern int (*flock)(int fd, int operation);
 extern int (*mkdir)(const char *path, mode_t mode);
 extern int (*chmod)(const char *pathname, mode_t mode);
 extern int (*stat)(const char *path, struct stat *buf);
+extern int (*fstat)(int fd, struct stat *buf);
 
 } // namespace Sys
 } // namespace Cal
@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "include/cal.h"
+#include "shared/utils.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+namespace Cal::Utils {
+
+// Copies of bulk memory transfers between client and service (staging shmems, hostptr copies, captured arrays).
+// Copies below threshold go to libc's memcpy (which already selects vector width for the CPU it runs on).
+// Larger ones are done with non-temporal stores, which bypass caches - destination of such copy is consumed by
+// the other process (or the GPU), so keeping it in caches would only evict application's working set.
+// Instruction set used for non-temporal stores is selected at runtime, based on CPUID.
+namespace TransferCopy {
+
+using CopyFunctionT = void (*)(void *dst, const void *src, size_t size);
+
+enum class Isa {
+    libc,
+    sse2,
+    avx2,
+    avx512,
+};
+
+inline constexpr size_t defaultStreamingThreshold = 1 * MB;
+inline constexpr size_t prefetchDistance = 512U; // in bytes, ahead of the currently copied block
+
+inline void copyWithLibc(void *dst, const void *src, size_t size) {
+    std::memcpy(dst, src, size);
+}
+
+#if defined(__x86_64__)
+// Copies bytes until destination is aligned to vector size, so that all stores of the main loop can be streamed.
+template <size_t alignment>
+inline size_t copyUntilDstIsAligned(uint8_t *&dst, const uint8_t *&src, size_t size) {
+    auto head = std::min(size, (alignment - (reinterpret_cast<uintptr_t>(dst) & (alignment - 1))) & (alignment - 1));
+    std::memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    return size - head;
+}
+
+inline void copyStreamingSse2(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+    size = copyUntilDstIsAligned<16>(dstBytes, srcBytes, size);
+    for (; size >= 64; size -= 64, dstBytes += 64, srcBytes += 64) {
+        _mm_prefetch(reinterpret_cast<const char *>(srcBytes + prefetchDistance), _MM_HINT_NTA);
+        auto v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes));
+        auto v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes + 16));
+        auto v2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes + 32));
+        auto v3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes), v0);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes + 16), v1);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes + 32), v2);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes + 48), v3);
+    }
+    _mm_sfence(); // non-temporal stores are weakly ordered - make them visible before the transfer is signaled
+    std::memcpy(dstBytes, srcBytes, size);
+}
+
+__attribute__((target("avx2"))) inline void copyStreamingAvx2(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+    size = copyUntilDstIsAligned<32>(dstBytes, srcBytes, size);
+    for (; size >= 128; size -= 128, dstBytes += 128, srcBytes += 128) {
+        _mm_prefetch(reinterpret_cast<const char *>(srcBytes + prefetchDistance), _MM_HINT_NTA);
+        _mm_prefetch(reinterpret_cast<const char *>(srcBytes + prefetchDistance + 64), _MM_HINT_NTA);
+        auto v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes));
+        auto v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + 32));
+        auto v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + 64));
+        auto v3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + 96));
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes), v0);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + 32), v1);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + 64), v2);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + 96), v3);
+    }
+    _mm_sfence();
+    std::memcpy(dstBytes, srcBytes, size);
+}
+
+__attribute__((target("avx512f"))) inline void copyStreamingAvx512(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+    size = copyUntilDstIsAligned<64>(dstBytes, srcBytes, size);
+    for (; size >= 256; size -= 256, dstBytes += 256, srcBytes += 256) {
+        for (size_t line = 0; line < 256; line += 64) {
+            _mm_prefetch(reinterpret_cast<const char *>(srcBytes + prefetchDistance + line), _MM_HINT_NTA);
+        }
+        auto v0 = _mm512_loadu_si512(srcBytes);
+        auto v1 = _mm512_loadu_si512(srcBytes + 64);
+        auto v2 = _mm512_loadu_si512(srcBytes + 128);
+        auto v3 = _mm512_loadu_si512(srcBytes + 192);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dstBytes), v0);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dstBytes + 64), v1);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dstBytes + 128), v2);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dstBytes + 192), v3);
+    }
+    _mm_sfence();
+    std::memcpy(dstBytes, srcBytes, size);
+}
+#endif
+
+#if defined(__x86_64__)
+// Vector registers can be used only if CPU supports the extension and OS saves their state on context switches.
+inline bool isExtensionSupported(uint32_t leaf7EbxBit, uint64_t requiredXcr0Mask) {
+    uint32_t eax = 0U, ebx = 0U, ecx = 0U, edx = 0U;
+    constexpr uint32_t osxsaveBit = 1U << 27;
+    if ((0 == __get_cpuid(1, &eax, &ebx, &ecx, &edx)) || (0U == (ecx & osxsaveBit))) {
+        return false;
+    }
+    if ((0 == __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) || (0U == (ebx & leaf7EbxBit))) {
+        return false;
+    }
+    uint32_t xcr0Low = 0U, xcr0High = 0U;
+    __asm__ volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0U));
+    auto xcr0 = (static_cast<uint64_t>(xcr0High) << 32) | xcr0Low;
+    return requiredXcr0Mask == (xcr0 & requiredXcr0Mask);
+}
+#endif
+
+inline bool isSupported(Isa isa) {
+#if defined(__x86_64__)
+    constexpr uint64_t avxStateMask = 0x6;     // SSE and AVX registers
+    constexpr uint64_t avx512StateMask = 0xe6; // as above + opmask and ZMM registers
+    switch (isa) {
+    default:
+        return false;
+    case Isa::libc:
+    case Isa::sse2:
+        return true;
+    case Isa::avx2:
+        return isExtensionSupported(1U << 5, avxStateMask);
+    case Isa::avx512:
+        return isExtensionSupported(1U << 16, avx512StateMask);
+    }
+#else
+    return Isa::libc == isa;
+#endif
+}
+
+inline Isa detectIsa() {
+    for (auto isa : {Isa::avx512, Isa::avx2, Isa::sse2}) {
+        if (isSupported(isa)) {
+            return isa;
+        }
+    }
+    return Isa::libc;
+}
+
+inline CopyFunctionT getStreamingCopyFunction(Isa isa) {
+    switch (isa) {
+    default:
+        return &copyWithLibc;
+#if defined(__x86_64__)
+    case Isa::sse2:
+        return &copyStreamingSse2;
+    case Isa::avx2:
+        return &copyStreamingAvx2;
+    case Isa::avx512:
+        return &copyStreamingAvx512;
+#endif
+    }
+}
+
+inline const char *getIsaName(Isa isa) {
+    switch (isa) {
+    default:
+        return "libc";
+    case Isa::sse2:
+        return "sse2";
+    case Isa::avx2:
+        return "avx2";
+    case Isa::avx512:
+        return "avx512";
+    }
+}
+
+struct Config {
+    size_t streamingThreshold = defaultStreamingThreshold; // 0 disables non-temporal copies
+    CopyFunctionT streamingCopy = &copyWithLibc;
+
+    static Config read() {
+        Config config;
+        config.streamingThreshold = static_cast<size_t>(std::max<int64_t>(0, Cal::Utils::getCalEnvI64(calTransferCopyStreamingThresholdEnvName, defaultStreamingThreshold)));
+        config.streamingCopy = getStreamingCopyFunction(detectIsa());
+        return config;
+    }
+
+    bool isStreamingUsed(size_t totalSize) const {
+        return (0U != streamingThreshold) && (totalSize >= streamingThreshold);
+    }
+
+    // copy function for transfer of given total size (transfers can be split and copied in parts)
+    CopyFunctionT select(size_t totalSize) const {
+        return isStreamingUsed(totalSize) ? streamingCopy : &copyWithLibc;
+    }
+};
+
+inline const Config &getConfig() {
+    static const Config config = Config::read();
+    return config;
+}
+
+inline void copy(void *dst, const void *src, size_t size) {
+    const auto &config = getConfig();
+    if (config.isStreamingUsed(size)) {
+        config.streamingCopy(dst, src, size);
+        return;
+    }
+    std::memcpy(dst, src, size);
+}
+
+} // namespace TransferCopy
+
+} // namespace Cal::Utils
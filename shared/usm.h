@@ -140,7 +140,8 @@ class UsmMmappedShmemArenaAllocator : public UsmMmappedShmemArenaAllocatorBaseT
     static_assert(UsmMmappedShmemArenaAllocatorBaseT::isThreadSafe);
 
     UsmMmappedShmemArenaAllocator(Cal::Ipc::ShmemAllocator &shmemAllocator, Cal::Utils::AddressRange bounds, size_t arenaSize)
-        : UsmMmappedShmemArenaAllocatorBaseT(UsmMmappedShmemAllocator(shmemAllocator, bounds), arenaSize) {
+        : UsmMmappedShmemArenaAllocatorBaseT(UsmMmappedShmemAllocator(shmemAllocator, bounds), arenaSize, shmemAllocator.getHugePageSize(), true) {
+        this->setIdleTrimming(Cal::Utils::IdleTrimmer::readConfig());
     }
 };
 
@@ -13,6 +13,7 @@
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #if __has_include(<filesystem>)
 #include <filesystem>
@@ -83,6 +84,10 @@ constexpr bool isPow2(size_t v) {
     return popcount(v) == 1;
 }
 
+constexpr uint32_t log2Pow2(size_t v) {
+    return popcount(v - 1);
+}
+
 template <size_t Pow2Alignment, typename T>
 constexpr bool isAlignedPow2(T value) {
     static_assert(isPow2(Pow2Alignment));
@@ -217,6 +222,7 @@ constexpr size_t GB = MB * 1024U;
 constexpr size_t pageSize4KB = KB * 4U;
 constexpr size_t pageSize64KB = KB * 64U;
 constexpr size_t pageSize2MB = MB * 2U;
+constexpr size_t pageSize1GB = GB;
 
 struct CpuInfo {
     static std::optional<CpuInfo> read();
@@ -759,6 +765,86 @@ inline std::string concatenate(const std::vector<std::string> &vec, const char *
 std::string encodeIntAsPath(uint64_t v);
 uint64_t decodeIntFromPath(const char *str);
 
+// 64-bit hash that can be fed incrementally and, unlike std::hash, is stable between processes
+// (result does not depend on how input was split into chunks)
+class StreamingHash64 {
+  public:
+    static constexpr uint64_t defaultSeed = 0x9e3779b97f4a7c15ULL;
+
+    explicit StreamingHash64(uint64_t seed = defaultSeed) : state(seed) {}
+
+    StreamingHash64 &update(const void *data, size_t size) {
+        auto bytes = static_cast<const uint8_t *>(data);
+        totalSize += size;
+        if (pendingSize > 0U) {
+            auto toCopy = std::min(size, sizeof(pending) - pendingSize);
+            memcpy(reinterpret_cast<uint8_t *>(&pending) + pendingSize, bytes, toCopy);
+            pendingSize += toCopy;
+            bytes += toCopy;
+            size -= toCopy;
+            if (pendingSize < sizeof(pending)) {
+                return *this;
+            }
+            state = mix(state, pending);
+            pending = 0U;
+            pendingSize = 0U;
+        }
+        while (size >= sizeof(uint64_t)) {
+            uint64_t word = 0U;
+            memcpy(&word, bytes, sizeof(word));
+            state = mix(state, word);
+            bytes += sizeof(word);
+            size -= sizeof(word);
+        }
+        if (size > 0U) {
+            memcpy(&pending, bytes, size);
+            pendingSize = size;
+        }
+        return *this;
+    }
+
+    template <typename T>
+    std::enable_if_t<std::is_trivially_copyable_v<T> && (false == std::is_pointer_v<T>), StreamingHash64 &> update(const T &value) {
+        return update(&value, sizeof(T));
+    }
+
+    StreamingHash64 &updateString(const char *str) {
+        uint64_t length = str ? strlen(str) : std::numeric_limits<uint64_t>::max();
+        update(length);
+        return str ? update(str, static_cast<size_t>(length)) : *this;
+    }
+
+    uint64_t finalize() const {
+        auto ret = pendingSize ? mix(state, pending) : state;
+        ret ^= totalSize;
+        ret ^= ret >> 30;
+        ret *= 0xbf58476d1ce4e5b9ULL;
+        ret ^= ret >> 27;
+        ret *= 0x94d049bb133111ebULL;
+        ret ^= ret >> 31;
+        return ret;
+    }
+
+  protected:
+    static constexpr uint64_t rotl(uint64_t v, int bits) {
+        return (v << bits) | (v >> (64 - bits));
+    }
+
+    static constexpr uint64_t mix(uint64_t state, uint64_t word) {
+        word *= 0x87c37b91114253d5ULL;
+        word = rotl(word, 31);
+        word *= 0x4cf5ad432745937fULL;
+        state ^= word;
+        state = rotl(state, 27);
+        return state * 5U + 0x52dce729U;
+    }
+
+    uint64_t state = 0U;
+    uint64_t pending = 0U;
+    size_t pendingSize = 0U;
+    uint64_t totalSize = 0U;
+};
+
 bool isDebuggerConnected();
 
 void enforceNullWithWarning(const char *sourceLocation, const void *&pointer);
@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "generated_rpc_messages_level_zero.h"
+#include "generated_rpc_messages_ocl.h"
+#include "include/cal.h"
+#include "shared/stats.h"
+#include "shared/utils.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <getopt.h>
+#include <string>
+#include <vector>
+
+void printCalStatHelp();
+std::vector<std::string> findStatsShmems(pid_t servicePid);
+void printStats(const std::string &path, const Cal::Stats::StatsPage &page);
+void exportStatsAsCsv(const std::string &path, const Cal::Stats::StatsPage &page);
+
+constexpr option options[] = {
+    {"pid", required_argument, nullptr, 'p'},
+    {"csv", no_argument, nullptr, 'c'},
+    {"help", no_argument, nullptr, 'h'},
+    {nullptr, 0, nullptr, 0}};
+
+int main(int argc, const char *argv[]) {
+    pid_t servicePid = 0;
+    bool csv = false;
+
+    int option;
+    while ((option = getopt_long(argc, const_cast<char *const *>(argv), "p:ch", options, nullptr)) != -1) {
+        switch (option) {
+        case 'p':
+            servicePid = static_cast<pid_t>(atoi(optarg));
+            break;
+        case 'c':
+            csv = true;
+            break;
+        case 'h':
+            printCalStatHelp();
+            return 0;
+        default:
+            fprintf(stderr, "Use -h or --help to get help\n");
+            return 1;
+        }
+    }
+
+    Cal::Utils::initDynamicVerbosity();
+
+    auto paths = findStatsShmems(servicePid);
+    if (paths.empty()) {
+        fprintf(stderr, "Did not detect any client of active cal service%s\n", servicePid ? (" with pid " + std::to_string(servicePid)).c_str() : "");
+        return 1;
+    }
+
+    if (csv) {
+        printf("stats_shmem,client_ordinal,client_pid,client_process,side,api,calls,total_latency_ns,bytes_copied");
+        for (size_t bucket = 0; bucket < Cal::Stats::CallStats::latencyBucketsCount; ++bucket) {
+            printf(",latency_ge_%llu_ns", static_cast<unsigned long long>(Cal::Stats::CallStats::getLatencyBucketLowerBound(bucket)));
+        }
+        printf("\n");
+    }
+
+    for (const auto &path : paths) {
+        auto stats = Cal::Stats::StatsShmem::open(path, true);
+        if (nullptr == stats) {
+            continue; // client has just disconnected
+        }
+        if (csv) {
+            exportStatsAsCsv(path, stats->getPage());
+        } else {
+            printStats(path, stats->getPage());
+        }
+    }
+
+    return 0;
+}
+
+void printCalStatHelp() {
+    printf("Prints per-API statistics of clients connected to running Compute Aggregation Layer services.\n\n");
+    printf("Synopsis:\n");
+    printf("    calstat [options]\n\n");
+    printf("Available command line options:\n");
+    printf("   -h  --help                 Show this help\n");
+    printf("   -p  --pid <pid>            Show only clients of CAL service with given pid (default: clients of all services)\n");
+    printf("   -c  --csv                  Export statistics (including latency histograms) in CSV format\n");
+    printf("\n");
+    printf("Statistics are collected by the service unless disabled with %s=0\n", calEnableStatsEnvName.data());
+}
+
+std::vector<std::string> findStatsShmems(pid_t servicePid) {
+    std::vector<std::string> ret;
+    auto prefix = Cal::Stats::getStatsShmemPathPrefix();
+    if (servicePid) {
+        prefix += std::to_string(servicePid) + "_";
+    }
+    auto fileNamePrefix = prefix.substr(1); // skip leading '/'
+
+    std::error_code ec;
+    for (const auto &entry : std::filesystem::directory_iterator("/dev/shm", ec)) {
+        auto fileName = entry.path().filename().string();
+        if (0 == fileName.compare(0, fileNamePrefix.size(), fileNamePrefix)) {
+            ret.push_back("/" + fileName);
+        }
+    }
+    std::sort(ret.begin(), ret.end());
+    return ret;
+}
+
+std::string getApiName(Cal::Rpc::RpcMessageHeader::MessageTypeT type, Cal::Rpc::RpcMessageHeader::MessageSubTypeT subtype) {
+    const char *name = "UNKNOWN";
+    if (Cal::Rpc::RpcMessageHeader::messageTypeRpcOcl == type) {
+        name = Cal::Rpc::Ocl::getRpcCallFname(Cal::Rpc::RpcCallId(type, subtype));
+    } else if (Cal::Rpc::RpcMessageHeader::messageTypeRpcLevelZero == type) {
+        name = Cal::Rpc::LevelZero::getRpcCallFname(Cal::Rpc::RpcCallId(type, subtype));
+    }
+    if (0 == strcmp(name, "UNKNOWN")) {
+        return "rpc_" + std::to_string(type) + "_" + std::to_string(subtype);
+    }
+    return name;
+}
+
+uint64_t getLatencyPercentileUpperBoundNs(const Cal::Stats::CallStats &stats, uint64_t count, double percentile) {
+    uint64_t threshold = static_cast<uint64_t>(percentile * count);
+    uint64_t accumulated = 0U;
+    for (size_t bucket = 0; bucket < Cal::Stats::CallStats::latencyBucketsCount; ++bucket) {
+        accumulated += stats.latencyHistogram[bucket].load(std::memory_order_relaxed);
+        if (accumulated >= threshold) {
+            return Cal::Stats::CallStats::getLatencyBucketLowerBound(bucket + 1);
+        }
+    }
+    return Cal::Stats::CallStats::getLatencyBucketLowerBound(Cal::Stats::CallStats::latencyBucketsCount);
+}
+
+using StatsTableT = Cal::Stats::CallStats[Cal::Stats::StatsPage::messageTypesCount][Cal::Stats::StatsPage::messageSubtypesCount];
+
+template <typename FuncT>
+void forEachCalledApi(const StatsTableT &stats, FuncT &&func) {
+    struct CalledApi {
+        uint64_t totalLatencyNs;
+        std::string name;
+        const Cal::Stats::CallStats *stats;
+    };
+    std::vector<CalledApi> called;
+    for (size_t type = 0; type < Cal::Stats::StatsPage::messageTypesCount; ++type) {
+        for (size_t subtype = 0; subtype < Cal::Stats::StatsPage::messageSubtypesCount; ++subtype) {
+            if (0U == stats[type][subtype].count.load(std::memory_order_relaxed)) {
+                continue;
+            }
+            called.push_back({stats[type][subtype].totalLatencyNs.load(std::memory_order_relaxed),
+                              getApiName(static_cast<Cal::Rpc::RpcMessageHeader::MessageTypeT>(type), static_cast<Cal::Rpc::RpcMessageHeader::MessageSubTypeT>(subtype)),
+                              &stats[type][subtype]});
+        }
+    }
+
+    // hottest APIs first
+    std::sort(called.begin(), called.end(), [](const CalledApi &lhs, const CalledApi &rhs) { return lhs.totalLatencyNs > rhs.totalLatencyNs; });
+    for (const auto &api : called) {
+        func(api.name, *api.stats);
+    }
+}
+
+void printStatsTable(const char *title, const StatsTableT &stats) {
+    printf("  %s:\n", title);
+    printf("    %-56s %12s %14s %12s %12s %12s %16s\n", "API", "calls", "total[ms]", "avg[us]", "p50<=[us]", "p99<=[us]", "copied[B]");
+    forEachCalledApi(stats, [](const std::string &name, const Cal::Stats::CallStats &apiStats) {
+        auto count = apiStats.count.load(std::memory_order_relaxed);
+        auto totalNs = apiStats.totalLatencyNs.load(std::memory_order_relaxed);
+        printf("    %-56s %12llu %14.3f %12.3f %12.3f %12.3f %16llu\n", name.c_str(), static_cast<unsigned long long>(count),
+               totalNs / 1e6, (totalNs / 1e3) / count,
+               getLatencyPercentileUpperBoundNs(apiStats, count, 0.5) / 1e3, getLatencyPercentileUpperBoundNs(apiStats, count, 0.99) / 1e3,
+               static_cast<unsigned long long>(apiStats.bytesCopied.load(std::memory_order_relaxed)));
+    });
+}
+
+void printMemoryUsage(const Cal::Stats::MemoryUsageStats &memoryUsage) {
+    auto toMB = [](const std::atomic<uint64_t> &bytes) { return bytes.load(std::memory_order_relaxed) / static_cast<double>(Cal::Utils::MB); };
+    printf("  Memory allocated by service on behalf of client (0 quota means no quota):\n");
+    printf("    %-12s %14s %14s %14s %14s %12s\n", "kind", "in use[MB]", "peak[MB]", "soft quota[MB]", "hard quota[MB]", "rejected");
+    for (uint32_t kind = 0; kind < Cal::Stats::memoryKindsCount; ++kind) {
+        printf("    %-12s %14.1f %14.1f %14.1f %14.1f %12llu\n", Cal::Stats::memoryKindNames[kind], toMB(memoryUsage.bytesInUse[kind]), toMB(memoryUsage.peakBytesInUse[kind]),
+               toMB(memoryUsage.softQuota[kind]), toMB(memoryUsage.hardQuota[kind]), static_cast<unsigned long long>(memoryUsage.rejectedAllocations[kind].load(std::memory_order_relaxed)));
+    }
+}
+
+void printStats(const std::string &path, const Cal::Stats::StatsPage &page) {
+    printf("Client #%llu (pid : %d, process : %s) - %s\n", static_cast<unsigned long long>(page.clientOrdinal), page.clientPid, page.clientProcessName, path.c_str());
+    printStatsTable("Serviced RPC calls (time spent in service)", page.serviced);
+    printStatsTable("Synchronous RPC calls (time spent by client waiting for completion)", page.clientWaits);
+    printMemoryUsage(page.memoryUsage);
+    printf("\n");
+}
+
+void exportStatsAsCsv(const std::string &path, const Cal::Stats::StatsPage &page) {
+    auto exportSide = [&](const char *side, const StatsTableT &stats) {
+        forEachCalledApi(stats, [&](const std::string &name, const Cal::Stats::CallStats &apiStats) {
+            printf("%s,%llu,%d,%s,%s,%s,%llu,%llu,%llu", path.c_str(), static_cast<unsigned long long>(page.clientOrdinal), page.clientPid, page.clientProcessName, side, name.c_str(),
+                   static_cast<unsigned long long>(apiStats.count.load(std::memory_order_relaxed)),
+                   static_cast<unsigned long long>(apiStats.totalLatencyNs.load(std::memory_order_relaxed)),
+                   static_cast<unsigned long long>(apiStats.bytesCopied.load(std::memory_order_relaxed)));
+            for (size_t bucket = 0; bucket < Cal::Stats::CallStats::latencyBucketsCount; ++bucket) {
+                printf(",%llu", static_cast<unsigned long long>(apiStats.latencyHistogram[bucket].load(std::memory_order_relaxed)));
+            }
+            printf("\n");
+        });
+    };
+    exportSide("service", page.serviced);
+    exportSide("client_wait", page.clientWaits);
+}
@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/allocators.h"
+#include "shared/log.h"
+#include "shared/utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <getopt.h>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Replays allocation traces on AddressRangeAllocator (the allocator behind the client's standalone heap and
+// the shared VA space) and reports latency of allocations/frees together with fragmentation of free space.
+// Trace is a text file with one operation per line :
+//   a <id> <size> <alignment>   - allocation identified by id
+//   f <id>                      - free of allocation identified by id
+// Lines starting with '#' are ignored. Without a trace, a synthetic one is generated (and can be recorded).
+
+struct TraceOp {
+    bool isAllocation = false;
+    uint64_t id = 0U;
+    size_t size = 0U;
+    size_t alignment = 0U;
+};
+
+struct LatencyStats {
+    std::vector<uint64_t> samplesNs;
+
+    void print(const char *name) {
+        if (samplesNs.empty()) {
+            printf("%-8s : no samples\n", name);
+            return;
+        }
+        std::sort(samplesNs.begin(), samplesNs.end());
+        uint64_t total = 0U;
+        for (auto sample : samplesNs) {
+            total += sample;
+        }
+        auto percentile = [&](double p) { return samplesNs[std::min(samplesNs.size() - 1, static_cast<size_t>(p * samplesNs.size()))]; };
+        printf("%-8s : count %zu, avg %.1f ns, p50 %lu ns, p99 %lu ns, max %lu ns\n", name, samplesNs.size(), static_cast<double>(total) / samplesNs.size(),
+               percentile(0.50), percentile(0.99), samplesNs.back());
+    }
+};
+
+double getFragmentation(const Cal::Allocators::AddressRangeAllocator &heap) {
+    auto sizeLeft = heap.getSizeLeft();
+    return (0U == sizeLeft) ? 0.0 : 1.0 - static_cast<double>(heap.getLargestFreeRangeSize()) / sizeLeft;
+}
+
+bool loadTrace(const std::string &path, std::vector<TraceOp> &trace) {
+    std::ifstream file(path);
+    if (false == file.is_open()) {
+        fprintf(stderr, "Could not open trace file %s\n", path.c_str());
+        return false;
+    }
+
+    std::string line;
+    size_t lineNumber = 0U;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        if (line.empty() || ('#' == line[0])) {
+            continue;
+        }
+        std::istringstream ss(line);
+        std::string type;
+        TraceOp op;
+        ss >> type >> op.id;
+        op.isAllocation = ("a" == type);
+        if (op.isAllocation) {
+            ss >> op.size >> op.alignment;
+        }
+        if (ss.fail() || (false == op.isAllocation && ("f" != type))) {
+            fprintf(stderr, "Malformed trace entry at line %zu : %s\n", lineNumber, line.c_str());
+            return false;
+        }
+        trace.push_back(op);
+    }
+    return true;
+}
+
+bool recordTrace(const std::string &path, const std::vector<TraceOp> &trace) {
+    std::ofstream file(path);
+    if (false == file.is_open()) {
+        fprintf(stderr, "Could not create trace file %s\n", path.c_str());
+        return false;
+    }
+    file << "# CAL allocators trace\n";
+    for (const auto &op : trace) {
+        if (op.isAllocation) {
+            file << "a " << op.id << " " << op.size << " " << op.alignment << "\n";
+        } else {
+            file << "f " << op.id << "\n";
+        }
+    }
+    return true;
+}
+
+// mix of small (malloc-like) and big (buffer-like) allocations with random lifetimes
+std::vector<TraceOp> generateTrace(size_t opsCount, uint32_t seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> log2SizeDist(4.0, 22.0);
+    std::uniform_int_distribution<int> alignmentDist(0, 9);
+    std::bernoulli_distribution freeDist(0.5);
+
+    std::vector<TraceOp> trace;
+    trace.reserve(opsCount);
+    std::vector<uint64_t> live;
+    uint64_t nextId = 0U;
+    while (trace.size() < opsCount) {
+        if (false == live.empty() && freeDist(rng)) {
+            std::uniform_int_distribution<size_t> victimDist(0, live.size() - 1);
+            auto victim = victimDist(rng);
+            std::swap(live[victim], live.back());
+            trace.push_back({false, live.back(), 0U, 0U});
+            live.pop_back();
+            continue;
+        }
+        auto size = static_cast<size_t>(std::exp2(log2SizeDist(rng)));
+        auto alignmentSelector = alignmentDist(rng);
+        size_t alignment = (alignmentSelector < 7) ? Cal::Allocators::AddressRangeAllocator::MinAlignment : ((alignmentSelector < 9) ? Cal::Utils::pageSize4KB : Cal::Utils::pageSize2MB);
+        trace.push_back({true, nextId, size, alignment});
+        live.push_back(nextId++);
+    }
+    return trace;
+}
+
+void printHelp() {
+    printf(R"===(Replays allocation traces on CAL's range allocator and reports latency and fragmentation.
+
+Usage : allocators_benchmark [options]
+  -t, --trace <path>     replay trace from given file (default : generate synthetic trace)
+  -r, --record <path>    save replayed trace to given file
+  -n, --ops <count>      number of operations in synthetic trace (default : 1000000)
+  -s, --seed <seed>      seed of synthetic trace (default : 0)
+  -m, --heap-mb <size>   size of the heap in MB (default : 4096)
+  -h, --help             print this help
+)===");
+}
+
+constexpr option options[] = {
+    {"trace", required_argument, nullptr, 't'},
+    {"record", required_argument, nullptr, 'r'},
+    {"ops", required_argument, nullptr, 'n'},
+    {"seed", required_argument, nullptr, 's'},
+    {"heap-mb", required_argument, nullptr, 'm'},
+    {"help", no_argument, nullptr, 'h'},
+    {nullptr, 0, nullptr, 0}};
+
+int main(int argc, const char *argv[]) {
+    std::string tracePath;
+    std::string recordPath;
+    size_t opsCount = 1000000U;
+    uint32_t seed = 0U;
+    size_t heapSize = 4096U * Cal::Utils::MB;
+
+    int option;
+    while ((option = getopt_long(argc, const_cast<char *const *>(argv), "t:r:n:s:m:h", options, nullptr)) != -1) {
+        switch (option) {
+        case 't':
+            tracePath = optarg;
+            break;
+        case 'r':
+            recordPath = optarg;
+            break;
+        case 'n':
+            opsCount = static_cast<size_t>(strtoull(optarg, nullptr, 10));
+            break;
+        case 's':
+            seed = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+            break;
+        case 'm':
+            heapSize = static_cast<size_t>(strtoull(optarg, nullptr, 10)) * Cal::Utils::MB;
+            break;
+        case 'h':
+            printHelp();
+            return 0;
+        default:
+            fprintf(stderr, "Use -h or --help to get help\n");
+            return 1;
+        }
+    }
+
+    Cal::Utils::initDynamicVerbosity();
+
+    std::vector<TraceOp> trace;
+    if (tracePath.empty()) {
+        trace = generateTrace(opsCount, seed);
+    } else if (false == loadTrace(tracePath, trace)) {
+        return 1;
+    }
+    if ((false == recordPath.empty()) && (false == recordTrace(recordPath, trace))) {
+        return 1;
+    }
+
+    // VA range is never touched, so it does not need to be backed by memory
+    const uintptr_t heapBase = uintptr_t{1} << 40;
+    Cal::Allocators::AddressRangeAllocator heap({heapBase, heapBase + heapSize});
+
+    LatencyStats allocations;
+    LatencyStats frees;
+    allocations.samplesNs.reserve(trace.size());
+    frees.samplesNs.reserve(trace.size());
+    std::unordered_map<uint64_t, void *> live;
+    size_t failedAllocations = 0U;
+    size_t unknownFrees = 0U;
+    size_t peakSizeUsed = 0U;
+    double fragmentationAtPeak = 0.0;
+    double maxFragmentation = 0.0;
+
+    for (const auto &op : trace) {
+        if (op.isAllocation) {
+            auto start = std::chrono::steady_clock::now();
+            auto ptr = heap.allocate(op.size, op.alignment);
+            auto end = std::chrono::steady_clock::now();
+            allocations.samplesNs.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            if (nullptr == ptr) {
+                ++failedAllocations;
+                continue;
+            }
+            live[op.id] = ptr;
+            if (heap.getSizeUsed() > peakSizeUsed) {
+                peakSizeUsed = heap.getSizeUsed();
+                fragmentationAtPeak = getFragmentation(heap);
+            }
+        } else {
+            auto it = live.find(op.id);
+            if (it == live.end()) {
+                ++unknownFrees; // e.g. allocation failed
+                continue;
+            }
+            auto start = std::chrono::steady_clock::now();
+            heap.free(it->second);
+            auto end = std::chrono::steady_clock::now();
+            frees.samplesNs.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            live.erase(it);
+        }
+        maxFragmentation = std::max(maxFragmentation, getFragmentation(heap));
+    }
+
+    printf("Trace    : %zu operations (%s)\n", trace.size(), tracePath.empty() ? "synthetic" : tracePath.c_str());
+    allocations.print("allocate");
+    frees.print("free");
+    printf("Failures : %zu allocations, %zu frees of unknown allocations\n", failedAllocations, unknownFrees);
+    printf("Heap     : %zu MB, peak used %.1f MB, used at end %.1f MB (%zu live allocations)\n", heapSize / Cal::Utils::MB,
+           static_cast<double>(peakSizeUsed) / Cal::Utils::MB, static_cast<double>(heap.getSizeUsed()) / Cal::Utils::MB, live.size());
+    printf("Fragmentation (1 - largest free range / free space) : at peak usage %.3f, max %.3f, at end %.3f (%zu free ranges)\n",
+           fragmentationAtPeak, maxFragmentation, getFragmentation(heap), heap.getFreeRangesCount());
+    return 0;
+}
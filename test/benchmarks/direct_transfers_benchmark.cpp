@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "service/direct_transfers.h"
+#include "shared/log.h"
+#include "shared/transfer_copy.h"
+#include "shared/utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <getopt.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+// Compares transports of hostptr memory from client to service. Forked child plays the client, parent plays the service :
+//   shmem  - client copies its memory to shmem shared with service (default transport)
+//   direct - service reads client's memory straight into shmem with process_vm_readv (CAL_DIRECT_TRANSFERS=1)
+// Both transports split each transfer into pieces (page-sized by default), just like transfers of scattered hostptr memory.
+
+int64_t toNs(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+
+// Client copies requested number of bytes to shmem, until it gets request of 0 bytes.
+void runClient(int requestsFd, int resultsFd, uint8_t *clientMemory, uint8_t *shmem, size_t maxSize, size_t pieceSize) {
+    std::memset(clientMemory, 7, maxSize); // fault-in client's own copy of pages
+    int64_t ready = 0;
+    if (sizeof(ready) != write(resultsFd, &ready, sizeof(ready))) {
+        return;
+    }
+    uint64_t size = 0U;
+    while ((sizeof(size) == read(requestsFd, &size, sizeof(size))) && (0U != size)) {
+        auto start = std::chrono::steady_clock::now();
+        auto copy = Cal::Utils::TransferCopy::getConfig().select(size);
+        for (size_t offset = 0; offset < size; offset += pieceSize) {
+            copy(shmem + offset, clientMemory + offset, std::min<size_t>(pieceSize, size - offset));
+        }
+        int64_t elapsedNs = toNs(std::chrono::steady_clock::now() - start);
+        if (sizeof(elapsedNs) != write(resultsFd, &elapsedNs, sizeof(elapsedNs))) {
+            return;
+        }
+    }
+}
+
+void printHelp() {
+    printf(R"===(Compares transfers of client's memory through shmem against direct transfers with process_vm_readv.
+
+Usage : direct_transfers_benchmark [options]
+  -s, --sizes <list>     comma-separated sizes of transfers in KB (default : 64,1024,16384,65536)
+  -i, --iterations <n>   number of transfers per size and transport (default : 16)
+  -p, --piece <KB>       size of a single piece of transfer in KB (default : 4)
+  -h, --help             print this help
+)===");
+}
+
+constexpr option options[] = {
+    {"sizes", required_argument, nullptr, 's'},
+    {"iterations", required_argument, nullptr, 'i'},
+    {"piece", required_argument, nullptr, 'p'},
+    {"help", no_argument, nullptr, 'h'},
+    {nullptr, 0, nullptr, 0}};
+
+int main(int argc, const char *argv[]) {
+    std::vector<size_t> sizes = {64 * Cal::Utils::KB, 1 * Cal::Utils::MB, 16 * Cal::Utils::MB, 64 * Cal::Utils::MB};
+    size_t iterations = 16U;
+    size_t pieceSize = 4 * Cal::Utils::KB;
+
+    int option;
+    while ((option = getopt_long(argc, const_cast<char *const *>(argv), "s:i:p:h", options, nullptr)) != -1) {
+        switch (option) {
+        case 's':
+            sizes.clear();
+            for (const auto &size : Cal::Utils::split(optarg, ",")) {
+                sizes.push_back(static_cast<size_t>(strtoull(size.c_str(), nullptr, 10)) * Cal::Utils::KB);
+            }
+            break;
+        case 'i':
+            iterations = std::max<size_t>(1U, static_cast<size_t>(strtoull(optarg, nullptr, 10)));
+            break;
+        case 'p':
+            pieceSize = std::max<size_t>(1U, static_cast<size_t>(strtoull(optarg, nullptr, 10))) * Cal::Utils::KB;
+            break;
+        case 'h':
+            printHelp();
+            return 0;
+        default:
+            fprintf(stderr, "Use -h or --help to get help\n");
+            return 1;
+        }
+    }
+
+    Cal::Utils::initDynamicVerbosity();
+
+    if (sizes.empty()) {
+        fprintf(stderr, "No sizes to measure\n");
+        return 1;
+    }
+    auto maxSize = *std::max_element(sizes.begin(), sizes.end());
+    auto clientMemory = static_cast<uint8_t *>(mmap(nullptr, maxSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    auto shmem = static_cast<uint8_t *>(mmap(nullptr, maxSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0));
+    if ((MAP_FAILED == clientMemory) || (MAP_FAILED == shmem)) {
+        fprintf(stderr, "Could not allocate %zu bytes\n", maxSize);
+        return 1;
+    }
+    std::memset(shmem, 0, maxSize);
+
+    int requests[2] = {};
+    int results[2] = {};
+    if ((0 != pipe(requests)) || (0 != pipe(results))) {
+        fprintf(stderr, "Could not create pipes\n");
+        return 1;
+    }
+
+    auto clientPid = fork();
+    if (clientPid < 0) {
+        fprintf(stderr, "Could not fork client process\n");
+        return 1;
+    }
+    if (0 == clientPid) {
+        runClient(requests[0], results[1], clientMemory, shmem, maxSize, pieceSize);
+        _exit(0);
+    }
+
+    int64_t clientReady = 0;
+    if (sizeof(clientReady) != read(results[0], &clientReady, sizeof(clientReady))) {
+        fprintf(stderr, "Client process did not start\n");
+        return 1;
+    }
+
+    Cal::Service::DirectTransfers directTransfers;
+    directTransfers.enable(clientPid);
+
+    printf("Average time of transfer in us (bandwidth in GB/s), pieces of %zu KB\n", pieceSize / Cal::Utils::KB);
+    printf("%10s | %20s | %20s\n", "size [KB]", "shmem", "direct");
+    int ret = 0;
+    for (auto size : sizes) {
+        int64_t shmemNs = 0;
+        for (size_t i = 0; i < iterations; ++i) {
+            uint64_t request = size;
+            int64_t elapsedNs = 0;
+            if ((sizeof(request) != write(requests[1], &request, sizeof(request))) || (sizeof(elapsedNs) != read(results[0], &elapsedNs, sizeof(elapsedNs)))) {
+                fprintf(stderr, "Lost connection with client process\n");
+                return 1;
+            }
+            shmemNs += elapsedNs;
+        }
+
+        std::vector<Cal::Service::DirectTransfers::CopyDesc> copies;
+        for (size_t offset = 0; offset < size; offset += pieceSize) {
+            copies.push_back({shmem + offset, reinterpret_cast<uintptr_t>(clientMemory + offset), std::min(pieceSize, size - offset)});
+        }
+        int64_t directNs = 0;
+        for (size_t i = 0; (i < iterations) && directTransfers.isEnabled(); ++i) {
+            auto start = std::chrono::steady_clock::now();
+            directTransfers.readFromClient(copies);
+            directNs += toNs(std::chrono::steady_clock::now() - start);
+        }
+
+        auto print = [&](int64_t totalNs) {
+            auto averageNs = static_cast<double>(totalNs) / iterations;
+            printf(" | %9.1f (%7.2f)", averageNs / 1000.0, (0.0 == averageNs) ? 0.0 : size / averageNs);
+        };
+        printf("%10zu", size / Cal::Utils::KB);
+        print(shmemNs);
+        if (directTransfers.isEnabled()) {
+            print(directNs);
+        } else {
+            printf(" | %20s", "not permitted");
+            ret = 1;
+        }
+        printf("\n");
+    }
+
+    uint64_t quit = 0U;
+    if (sizeof(quit) != write(requests[1], &quit, sizeof(quit))) {
+        fprintf(stderr, "Lost connection with client process\n");
+    }
+    waitpid(clientPid, nullptr, 0);
+    return ret;
+}
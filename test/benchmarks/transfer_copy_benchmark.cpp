@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/log.h"
+#include "shared/transfer_copy.h"
+#include "shared/utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <getopt.h>
+#include <string>
+#include <vector>
+
+// Compares copy routines used for memory transfers between client and service (non-temporal copies with each
+// instruction set supported by the CPU) against libc's memcpy. For every size, reports bandwidth of copying
+// the whole buffer and bandwidth of reading a cache-sized working set right after the copy - the latter
+// shows how much the copy evicted from caches.
+
+using Isa = Cal::Utils::TransferCopy::Isa;
+
+struct Result {
+    double copyGBps = 0.0;
+    double workingSetGBps = 0.0;
+};
+
+double toGBps(size_t bytes, std::chrono::steady_clock::duration duration) {
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    return (0 == ns) ? 0.0 : static_cast<double>(bytes) / ns;
+}
+
+Result measure(Cal::Utils::TransferCopy::CopyFunctionT copy, std::vector<uint8_t> &dst, const std::vector<uint8_t> &src, size_t size, size_t offset,
+               std::vector<uint8_t> &workingSet, size_t iterations) {
+    Result result;
+    volatile uint64_t sink = 0U;
+    std::chrono::steady_clock::duration copyTime{0};
+    std::chrono::steady_clock::duration workingSetTime{0};
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t j = 0; j < workingSet.size(); j += 64) {
+            sink = sink + workingSet[j];
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        copy(dst.data() + offset, src.data() + offset, size);
+        auto end = std::chrono::steady_clock::now();
+        copyTime += end - start;
+
+        start = std::chrono::steady_clock::now();
+        for (size_t j = 0; j < workingSet.size(); j += 64) {
+            sink = sink + workingSet[j];
+        }
+        end = std::chrono::steady_clock::now();
+        workingSetTime += end - start;
+    }
+    result.copyGBps = toGBps(size * iterations, copyTime);
+    result.workingSetGBps = toGBps(workingSet.size() * iterations, workingSetTime);
+    return result;
+}
+
+void printHelp() {
+    printf(R"===(Compares copy routines used for memory transfers between client and service against libc's memcpy.
+
+Usage : transfer_copy_benchmark [options]
+  -s, --sizes <list>     comma-separated sizes of copies in KB (default : 4,64,512,1024,4096,16384,65536)
+  -i, --iterations <n>   number of copies per size and routine (default : 32)
+  -o, --offset <bytes>   offset of source and destination from page start, to measure misaligned copies (default : 0)
+  -w, --working-set <KB> size of working set read after each copy (default : 1024)
+  -h, --help             print this help
+)===");
+}
+
+constexpr option options[] = {
+    {"sizes", required_argument, nullptr, 's'},
+    {"iterations", required_argument, nullptr, 'i'},
+    {"offset", required_argument, nullptr, 'o'},
+    {"working-set", required_argument, nullptr, 'w'},
+    {"help", no_argument, nullptr, 'h'},
+    {nullptr, 0, nullptr, 0}};
+
+int main(int argc, const char *argv[]) {
+    std::vector<size_t> sizes = {4 * Cal::Utils::KB, 64 * Cal::Utils::KB, 512 * Cal::Utils::KB, 1 * Cal::Utils::MB, 4 * Cal::Utils::MB, 16 * Cal::Utils::MB, 64 * Cal::Utils::MB};
+    size_t iterations = 32U;
+    size_t offset = 0U;
+    size_t workingSetSize = 1 * Cal::Utils::MB;
+
+    int option;
+    while ((option = getopt_long(argc, const_cast<char *const *>(argv), "s:i:o:w:h", options, nullptr)) != -1) {
+        switch (option) {
+        case 's':
+            sizes.clear();
+            for (const auto &size : Cal::Utils::split(optarg, ",")) {
+                sizes.push_back(static_cast<size_t>(strtoull(size.c_str(), nullptr, 10)) * Cal::Utils::KB);
+            }
+            break;
+        case 'i':
+            iterations = std::max<size_t>(1U, static_cast<size_t>(strtoull(optarg, nullptr, 10)));
+            break;
+        case 'o':
+            offset = static_cast<size_t>(strtoull(optarg, nullptr, 10)) % Cal::Utils::pageSize4KB;
+            break;
+        case 'w':
+            workingSetSize = static_cast<size_t>(strtoull(optarg, nullptr, 10)) * Cal::Utils::KB;
+            break;
+        case 'h':
+            printHelp();
+            return 0;
+        default:
+            fprintf(stderr, "Use -h or --help to get help\n");
+            return 1;
+        }
+    }
+
+    Cal::Utils::initDynamicVerbosity();
+
+    if (sizes.empty()) {
+        fprintf(stderr, "No sizes to measure\n");
+        return 1;
+    }
+    auto maxSize = *std::max_element(sizes.begin(), sizes.end());
+    std::vector<uint8_t> src(maxSize + offset, 7U);
+    std::vector<uint8_t> dst(maxSize + offset, 0U);
+    std::vector<uint8_t> workingSet(workingSetSize, 1U);
+
+    std::vector<Isa> isas;
+    for (auto isa : {Isa::libc, Isa::sse2, Isa::avx2, Isa::avx512}) {
+        if (Cal::Utils::TransferCopy::isSupported(isa)) {
+            isas.push_back(isa);
+        }
+    }
+
+    const auto &config = Cal::Utils::TransferCopy::getConfig();
+    printf("Detected : %s, non-temporal copies from %zu KB (%s)\n", Cal::Utils::TransferCopy::getIsaName(Cal::Utils::TransferCopy::detectIsa()),
+           config.streamingThreshold / Cal::Utils::KB, (0U == config.streamingThreshold) ? "disabled" : "enabled");
+    printf("Bandwidth in GB/s, copy / reading %zu KB working set after copy\n", workingSetSize / Cal::Utils::KB);
+    printf("%10s", "size [KB]");
+    for (auto isa : isas) {
+        printf(" | %17s", Cal::Utils::TransferCopy::getIsaName(isa));
+    }
+    printf("\n");
+
+    for (auto size : sizes) {
+        printf("%10zu", size / Cal::Utils::KB);
+        for (auto isa : isas) {
+            auto copy = Cal::Utils::TransferCopy::getStreamingCopyFunction(isa);
+            copy(dst.data() + offset, src.data() + offset, size); // warm-up
+            auto result = measure(copy, dst, src, size, offset, workingSet, iterations);
+            printf(" | %7.2f / %7.2f", result.copyGBps, result.workingSetGBps);
+        }
+        printf("\n");
+        if (false == std::equal(src.begin() + offset, src.begin() + offset + size, dst.begin() + offset)) {
+            fprintf(stderr, "Copy of %zu bytes produced wrong results\n", size);
+            return 1;
+        }
+    }
+    return 0;
+}
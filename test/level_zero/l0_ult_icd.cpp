@@ -6,16 +6,23 @@
  */
 
 #include "client/icd/level_zero/icd_level_zero.h"
+#include "client/icd/level_zero/logic/dirty_pages_tracker.h"
 #include "client/icd/level_zero/logic/hostptr_copies_reader.h"
 #include "client/icd/level_zero/logic/imported_host_pointers_manager.h"
 #include "gtest/gtest.h"
+#include "test/mocks/connection_mock.h"
 #include "test/mocks/icd_l0_command_list_mock.h"
 #include "test/mocks/log_mock.h"
+#include "test/mocks/page_fault_manager_mock.h"
+#include "test/mocks/sys_mock.h"
 #include "test/utils/cli_utils.h"
 #include "test/utils/custom_event_listener.h"
 #include "test/utils/signal_utils.h"
 
 #include <cstddef>
+#include <new>
+#include <set>
+#include <sys/mman.h>
 
 using Cal::Client::Icd::LevelZero::Logic::ImportedHostPointersManager;
 
@@ -245,6 +252,251 @@ TEST_F(ImportedHostPointersManagerTest, GivenEmptyManagerWhenPointerIsImportedAn
     EXPECT_EQ(nullptr, baseAddress);
 }
 
+class MockDirtyPagesTracker : public Logic::DirtyPagesTracker {
+  public:
+    bool readSoftDirtyBits(uintptr_t firstPage, size_t pagesCount, std::vector<bool> &outBits) override {
+        outBits.resize(pagesCount);
+        for (size_t i = 0; i < pagesCount; ++i) {
+            outBits[i] = (dirtyPages.count(firstPage + i * pageSize) > 0);
+        }
+        return true;
+    }
+
+    bool clearSoftDirtyBits() override {
+        dirtyPages.clear();
+        ++clearCallsCount;
+        return true;
+    }
+
+    void write(uintptr_t address) {
+        dirtyPages.insert(address & ~(pageSize - 1));
+    }
+
+    std::set<uintptr_t> dirtyPages;
+    uint32_t clearCallsCount = 0U;
+};
+
+class DirtyPagesTrackerTest : public ::testing::Test {
+  protected:
+    static constexpr size_t pageSize = Logic::DirtyPagesTracker::pageSize;
+
+    Cal::Rpc::TransferDesc createTransfer(uintptr_t clientAddress, size_t size, uint64_t offsetFromResourceStart) {
+        Cal::Rpc::TransferDesc transfer{};
+        transfer.shmemId = 7;
+        transfer.underlyingSize = 64 * pageSize;
+        transfer.bytesCountToCopy = size;
+        transfer.offsetFromResourceStart = offsetFromResourceStart;
+        transfer.clientAddress = clientAddress;
+        return transfer;
+    }
+
+    Cal::Mocks::LogCaptureContext logs;
+    MockDirtyPagesTracker tracker;
+    uintptr_t base = 0x7f0000000000ULL;
+};
+
+TEST_F(DirtyPagesTrackerTest, GivenNewRegistrationThenAllTransfersArePerformed) {
+    auto registration = tracker.createRegistration();
+    std::vector<Cal::Rpc::TransferDesc> transfers = {createTransfer(base + 16, 3 * pageSize, 16), createTransfer(base + 8 * pageSize, pageSize, 8 * pageSize)};
+
+    auto selected = tracker.selectModified(*registration, transfers);
+    ASSERT_EQ(2U, selected.size());
+    for (size_t i = 0; i < transfers.size(); ++i) {
+        EXPECT_EQ(transfers[i].clientAddress, selected[i].clientAddress);
+        EXPECT_EQ(transfers[i].bytesCountToCopy, selected[i].bytesCountToCopy);
+        EXPECT_EQ(transfers[i].offsetFromResourceStart, selected[i].offsetFromResourceStart);
+    }
+    EXPECT_EQ(1U, tracker.clearCallsCount);
+}
+
+TEST_F(DirtyPagesTrackerTest, GivenUnmodifiedMemoryWhenTransfersAreSelectedAgainThenNothingIsTransferred) {
+    auto registration = tracker.createRegistration();
+    std::vector<Cal::Rpc::TransferDesc> transfers = {createTransfer(base + 16, 3 * pageSize, 16)};
+    tracker.selectModified(*registration, transfers);
+
+    EXPECT_TRUE(tracker.selectModified(*registration, transfers).empty());
+}
+
+TEST_F(DirtyPagesTrackerTest, GivenModifiedPagesThenOnlyTheirPartsOfTransfersAreSelected) {
+    auto registration = tracker.createRegistration();
+    std::vector<Cal::Rpc::TransferDesc> transfers = {createTransfer(base + 16, 4 * pageSize, 1024)};
+    tracker.selectModified(*registration, transfers);
+
+    tracker.write(base);
+    tracker.write(base + 2 * pageSize + 100);
+    tracker.write(base + 3 * pageSize);
+    auto selected = tracker.selectModified(*registration, transfers);
+    ASSERT_EQ(2U, selected.size());
+
+    EXPECT_EQ(base + 16, selected[0].clientAddress);
+    EXPECT_EQ(pageSize - 16, selected[0].bytesCountToCopy);
+    EXPECT_EQ(1024U, selected[0].offsetFromResourceStart);
+    EXPECT_EQ(transfers[0].shmemId, selected[0].shmemId);
+    EXPECT_EQ(transfers[0].underlyingSize, selected[0].underlyingSize);
+
+    EXPECT_EQ(base + 2 * pageSize, selected[1].clientAddress);
+    EXPECT_EQ(2 * pageSize, selected[1].bytesCountToCopy);
+    EXPECT_EQ(1024U + 2 * pageSize - 16, selected[1].offsetFromResourceStart);
+}
+
+TEST_F(DirtyPagesTrackerTest, GivenPagesModifiedBeforeOtherRegistrationClearedBitsThenTheyAreStillTransferred) {
+    auto first = tracker.createRegistration();
+    auto second = tracker.createRegistration();
+    std::vector<Cal::Rpc::TransferDesc> firstTransfers = {createTransfer(base, 2 * pageSize, 0)};
+    std::vector<Cal::Rpc::TransferDesc> secondTransfers = {createTransfer(base + 16 * pageSize, 2 * pageSize, 16 * pageSize)};
+    tracker.selectModified(*first, firstTransfers);
+    tracker.selectModified(*second, secondTransfers);
+
+    tracker.write(base + pageSize);
+    EXPECT_TRUE(tracker.selectModified(*second, secondTransfers).empty());
+    EXPECT_TRUE(tracker.dirtyPages.empty());
+
+    auto selected = tracker.selectModified(*first, firstTransfers);
+    ASSERT_EQ(1U, selected.size());
+    EXPECT_EQ(base + pageSize, selected[0].clientAddress);
+    EXPECT_EQ(pageSize, selected[0].bytesCountToCopy);
+}
+
+TEST_F(DirtyPagesTrackerTest, GivenChangedTransfersThenAllOfThemArePerformed) {
+    auto registration = tracker.createRegistration();
+    std::vector<Cal::Rpc::TransferDesc> transfers = {createTransfer(base, 2 * pageSize, 0)};
+    tracker.selectModified(*registration, transfers);
+
+    transfers[0].offsetFromResourceStart = 4 * pageSize;
+    auto selected = tracker.selectModified(*registration, transfers);
+    ASSERT_EQ(1U, selected.size());
+    EXPECT_EQ(2 * pageSize, selected[0].bytesCountToCopy);
+    EXPECT_EQ(4 * pageSize, selected[0].offsetFromResourceStart);
+}
+
+TEST_F(DirtyPagesTrackerTest, GivenReleasedRegistrationThenItIsNoLongerTracked) {
+    auto first = tracker.createRegistration();
+    auto second = tracker.createRegistration();
+    tracker.selectModified(*first, {createTransfer(base, pageSize, 0)});
+    second.reset();
+
+    tracker.write(base);
+    auto selected = tracker.selectModified(*first, {createTransfer(base, pageSize, 0)});
+    EXPECT_EQ(1U, selected.size());
+}
+
+class PageFaultManagerTest : public ::testing::Test {
+  protected:
+    static constexpr uint64_t chunkSize = 4 * Cal::Utils::pageSize4KB;
+
+    void SetUp() override {
+        tempSysCallsCtx.apiConfig.mprotect.impl = [this](void *addr, size_t len, int prot) {
+            mprotectCalls.push_back({reinterpret_cast<uintptr_t>(addr), len, prot});
+            return 0;
+        };
+        connection.apiConfig.send.impl = [this](const void *data, size_t dataSize) {
+            auto request = reinterpret_cast<const Cal::Messages::ReqPageFault *>(data);
+            pageFaultRequests.push_back({reinterpret_cast<uintptr_t>(request->ptr), request->size, 0});
+            return static_cast<int>(dataSize);
+        };
+        connection.apiConfig.receive.impl = [](void *data, size_t dataSize) {
+            new (data) Cal::Messages::RespPageFault();
+            return static_cast<int>(dataSize);
+        };
+    }
+
+    struct Range {
+        uintptr_t address = 0U;
+        size_t size = 0U;
+        int prot = 0;
+
+        bool operator==(const Range &rhs) const {
+            return (address == rhs.address) && (size == rhs.size) && (prot == rhs.prot);
+        }
+    };
+
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+    Cal::Mocks::ConnectionMock connection;
+    Cal::Mocks::PageFaultManagerMock pageFaultManager{connection, true, false, false, chunkSize};
+    std::vector<Range> mprotectCalls;
+    std::vector<Range> pageFaultRequests;
+    uintptr_t base = 0x7f0000000000ULL;
+};
+
+TEST_F(PageFaultManagerTest, GivenAddressesInsideAndOutsideOfSharedAllocationsThenOnlyAddressesInsideAreFound) {
+    pageFaultManager.registerSharedAlloc(reinterpret_cast<void *>(base + 16 * chunkSize), chunkSize, Cal::Client::Icd::PageFaultManager::Placement::HOST);
+    pageFaultManager.registerSharedAlloc(reinterpret_cast<void *>(base), 2 * chunkSize, Cal::Client::Icd::PageFaultManager::Placement::HOST);
+    pageFaultManager.registerSharedAlloc(reinterpret_cast<void *>(base + 4 * chunkSize), 3 * chunkSize + 100, Cal::Client::Icd::PageFaultManager::Placement::HOST);
+
+    EXPECT_FALSE(pageFaultManager.isAllocShared(reinterpret_cast<void *>(base - 1)));
+    EXPECT_TRUE(pageFaultManager.isAllocShared(reinterpret_cast<void *>(base)));
+    EXPECT_TRUE(pageFaultManager.isAllocShared(reinterpret_cast<void *>(base + 2 * chunkSize - 1)));
+    EXPECT_FALSE(pageFaultManager.isAllocShared(reinterpret_cast<void *>(base + 2 * chunkSize)));
+    EXPECT_EQ(reinterpret_cast<void *>(base + 4 * chunkSize), pageFaultManager.findSharedAlloc(reinterpret_cast<void *>(base + 7 * chunkSize + 99))->first);
+    EXPECT_FALSE(pageFaultManager.isAllocShared(reinterpret_cast<void *>(base + 7 * chunkSize + 100)));
+    EXPECT_TRUE(pageFaultManager.isAllocShared(reinterpret_cast<void *>(base + 16 * chunkSize + 5)));
+    EXPECT_FALSE(pageFaultManager.isAllocShared(reinterpret_cast<void *>(base + 17 * chunkSize)));
+    EXPECT_TRUE(mprotectCalls.empty());
+}
+
+TEST_F(PageFaultManagerTest, GivenSharedAllocationOnDeviceWhenPageFaultOccursThenOnlyFaultedChunkIsMigratedToHost) {
+    pageFaultManager.registerSharedAlloc(reinterpret_cast<void *>(base), 8 * chunkSize, Cal::Client::Icd::PageFaultManager::Placement::DEVICE);
+    ASSERT_EQ(1U, mprotectCalls.size());
+    EXPECT_EQ((Range{base, 8 * chunkSize, PROT_NONE}), mprotectCalls[0]);
+
+    EXPECT_TRUE(pageFaultManager.verifyPageFault(reinterpret_cast<void *>(base + 5 * chunkSize + 123)));
+    ASSERT_EQ(1U, pageFaultRequests.size());
+    EXPECT_EQ((Range{base + 5 * chunkSize, chunkSize, 0}), pageFaultRequests[0]);
+    ASSERT_EQ(2U, mprotectCalls.size());
+    EXPECT_EQ((Range{base + 5 * chunkSize, chunkSize, PROT_READ | PROT_WRITE}), mprotectCalls[1]);
+
+    EXPECT_TRUE(pageFaultManager.verifyPageFault(reinterpret_cast<void *>(base + 5 * chunkSize)));
+    EXPECT_EQ(1U, pageFaultRequests.size());
+    EXPECT_EQ(2U, mprotectCalls.size());
+}
+
+TEST_F(PageFaultManagerTest, GivenPageFaultInLastPartialChunkThenMigratedSizeIsLimitedToAllocation) {
+    pageFaultManager.registerSharedAlloc(reinterpret_cast<void *>(base), chunkSize + Cal::Utils::pageSize4KB, Cal::Client::Icd::PageFaultManager::Placement::DEVICE);
+
+    EXPECT_TRUE(pageFaultManager.verifyPageFault(reinterpret_cast<void *>(base + chunkSize + 8)));
+    ASSERT_EQ(1U, pageFaultRequests.size());
+    EXPECT_EQ((Range{base + chunkSize, Cal::Utils::pageSize4KB, 0}), pageFaultRequests[0]);
+    EXPECT_EQ((Range{base + chunkSize, Cal::Utils::pageSize4KB, PROT_READ | PROT_WRITE}), mprotectCalls.back());
+}
+
+TEST_F(PageFaultManagerTest, GivenChunksMigratedToHostWhenMovingAllocationToGpuThenOnlyRunsOfHostChunksAreProtected) {
+    pageFaultManager.registerSharedAlloc(reinterpret_cast<void *>(base), 8 * chunkSize, Cal::Client::Icd::PageFaultManager::Placement::DEVICE);
+    pageFaultManager.verifyPageFault(reinterpret_cast<void *>(base + 1 * chunkSize));
+    pageFaultManager.verifyPageFault(reinterpret_cast<void *>(base + 2 * chunkSize));
+    pageFaultManager.verifyPageFault(reinterpret_cast<void *>(base + 7 * chunkSize));
+    mprotectCalls.clear();
+
+    pageFaultManager.moveAllocationToGpu(reinterpret_cast<void *>(base + 3 * chunkSize));
+    ASSERT_EQ(2U, mprotectCalls.size());
+    EXPECT_EQ((Range{base + 1 * chunkSize, 2 * chunkSize, PROT_NONE}), mprotectCalls[0]);
+    EXPECT_EQ((Range{base + 7 * chunkSize, chunkSize, PROT_NONE}), mprotectCalls[1]);
+
+    pageFaultManager.moveAllAllocationsToGpu();
+    EXPECT_EQ(2U, mprotectCalls.size());
+}
+
+TEST_F(PageFaultManagerTest, GivenSharedAllocationOnHostWhenMovingAllAllocationsToGpuThenWholeAllocationIsProtectedOnce) {
+    pageFaultManager.registerSharedAlloc(reinterpret_cast<void *>(base), 3 * chunkSize + 100, Cal::Client::Icd::PageFaultManager::Placement::HOST);
+
+    pageFaultManager.moveAllAllocationsToGpu();
+    pageFaultManager.moveAllAllocationsToGpu();
+    ASSERT_EQ(1U, mprotectCalls.size());
+    EXPECT_EQ((Range{base, 3 * chunkSize + 100, PROT_NONE}), mprotectCalls[0]);
+
+    pageFaultManager.unregisterSharedAlloc(reinterpret_cast<void *>(base + 10));
+    ASSERT_EQ(2U, mprotectCalls.size());
+    EXPECT_EQ((Range{base, 3 * chunkSize + 100, PROT_READ | PROT_WRITE}), mprotectCalls[1]);
+    EXPECT_FALSE(pageFaultManager.isAllocShared(reinterpret_cast<void *>(base)));
+}
+
+TEST(PageFaultManagerChunkSizeTest, GivenChunkSizeNotAlignedToPageThenItIsAlignedUp) {
+    Cal::Mocks::LogCaptureContext logs;
+    Cal::Mocks::ConnectionMock connection;
+    EXPECT_EQ(Cal::Utils::pageSize4KB, Cal::Mocks::PageFaultManagerMock(connection, true, false, false, 0).getMigrationChunkSize());
+    EXPECT_EQ(2 * Cal::Utils::pageSize4KB, Cal::Mocks::PageFaultManagerMock(connection, true, false, false, Cal::Utils::pageSize4KB + 1).getMigrationChunkSize());
+}
+
 } // namespace Cal::Client::Icd::LevelZero
 
 int main(int argc, char **argv) {
@@ -17,6 +17,8 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <thread>
+#include <vector>
 
 namespace Cal::Rpc::LevelZero {
 
@@ -947,20 +949,22 @@ TEST(CopyGroupAssign, givenParsedCommandQueueGroupsWhenOverrideClientsDescsThenA
 }
 
 struct MockModuleCache : public Cal::Service::Provider::ModuleCache {
-    using Cal::Service::Provider::ModuleCache::cache;
+    using Cal::Service::Provider::ModuleCache::getShard;
+    using Cal::Service::Provider::ModuleCache::shards;
+
+    size_t getEntriesCount() {
+        size_t ret = 0U;
+        for (auto &shard : shards) {
+            std::lock_guard<std::mutex> lock(shard.mtx);
+            ret += shard.entries.size();
+        }
+        return ret;
+    }
 };
-TEST(L0Service, givenServiceWhenStoreNativeBinaryThenBinaryIsStoredWithModuleDesc) {
-    MockModuleCache cache;
-    EXPECT_TRUE(cache.cache.empty());
 
-    ze_context_handle_t hContext = reinterpret_cast<ze_context_handle_t>(0x1234);
+TEST(L0Service, givenModuleDescWhenCreatingModuleCacheKeyThenKeyDependsOnDeviceInputBuildOptionsAndConstants) {
     ze_device_handle_t hDevice = reinterpret_cast<ze_device_handle_t>(0x5678);
     uint8_t binary[] = {1, 2, 3, 4, 5, 0, 6, 7, 8, 9};
-    constexpr size_t nativeSize = 5;
-    auto native = new uint8_t[nativeSize];
-    for (uint32_t i = 0u; i < nativeSize; ++i) {
-        native[i] = 10 + i;
-    }
     char buildOptions[] = {"--build=option"};
     uint32_t ids[] = {1, 5, 9};
     uint64_t values[] = {0x13, 0x45, 0x89};
@@ -977,68 +981,146 @@ TEST(L0Service, givenServiceWhenStoreNativeBinaryThenBinaryIsStoredWithModuleDes
     desc.pInputModule = binary;
     desc.pConstants = &constants;
 
-    cache.store(hContext, hDevice, &desc, nativeSize, native);
-    EXPECT_EQ(cache.cache.size(), 1u);
-    EXPECT_EQ(cache.cache[0].hContext, hContext);
-    EXPECT_EQ(cache.cache[0].hDevice, hDevice);
-    EXPECT_EQ(cache.cache[0].format, desc.format);
-    EXPECT_EQ(cache.cache[0].inputSize, desc.inputSize);
-    EXPECT_EQ(cache.cache[0].nativeSize, nativeSize);
-    EXPECT_EQ(cache.cache[0].pNativeBinary, native);
-    EXPECT_EQ(cache.cache[0].binaryHash, std::hash<std::string>{}(std::string(reinterpret_cast<const char *>(desc.pInputModule), desc.inputSize)));
-    EXPECT_EQ(cache.cache[0].buildOptionsHash, std::hash<std::string>{}(std::string(reinterpret_cast<const char *>(desc.pBuildFlags))));
-    EXPECT_EQ(cache.cache[0].constants.numConstants, desc.pConstants->numConstants);
-    for (uint32_t i = 0; i < desc.pConstants->numConstants; ++i) {
-        EXPECT_EQ(cache.cache[0].constants.pConstantIds[i], desc.pConstants->pConstantIds[i]);
-        EXPECT_EQ(reinterpret_cast<uint64_t *>(cache.cache[0].constants.pConstantValues)[i], *static_cast<const uint64_t *>(desc.pConstants->pConstantValues[i]));
-    }
+    auto key = MockModuleCache::createKey(hDevice, &desc);
+    ASSERT_TRUE(key.has_value());
+    EXPECT_EQ(hDevice, key->hDevice);
+    EXPECT_EQ(desc.format, key->format);
+    EXPECT_EQ(desc.inputSize, key->inputSize);
+    EXPECT_EQ(Cal::Utils::StreamingHash64{}.update(binary, sizeof(binary)).finalize(), key->inputHash);
+    EXPECT_EQ(Cal::Utils::StreamingHash64{}.updateString(buildOptions).finalize(), key->buildOptionsHash);
+    EXPECT_TRUE(key.value() == MockModuleCache::createKey(hDevice, &desc).value());
 
     {
-        auto ret = cache.find(hContext, hDevice, &desc);
-        EXPECT_TRUE(ret.has_value());
-    }
-    {
-        ze_context_handle_t hContext = reinterpret_cast<ze_context_handle_t>(0x11223344);
-        auto ret = cache.find(hContext, hDevice, &desc);
-        EXPECT_TRUE(ret.has_value());
+        ze_device_handle_t hDevice = reinterpret_cast<ze_device_handle_t>(0x55667788);
+        EXPECT_FALSE(key.value() == MockModuleCache::createKey(hDevice, &desc).value());
     }
     {
-        ze_device_handle_t hDevice = reinterpret_cast<ze_device_handle_t>(0x55667788);
-        auto ret = cache.find(hContext, hDevice, &desc);
-        EXPECT_FALSE(ret.has_value());
+        desc.format = ZE_MODULE_FORMAT_NATIVE;
+        EXPECT_FALSE(key.value() == MockModuleCache::createKey(hDevice, &desc).value());
+        desc.format = ZE_MODULE_FORMAT_IL_SPIRV;
     }
     {
         values[1] = 0x126;
-        auto ret = cache.find(hContext, hDevice, &desc);
-        EXPECT_FALSE(ret.has_value());
+        EXPECT_FALSE(key.value() == MockModuleCache::createKey(hDevice, &desc).value());
         values[1] = 0x45;
     }
     {
-        binary[6] = 1;
-        binary[7] = 2;
-        binary[8] = 3;
         binary[9] = 4;
-        auto ret = cache.find(hContext, hDevice, &desc);
-        EXPECT_FALSE(ret.has_value());
-        binary[6] = 6;
-        binary[7] = 7;
-        binary[8] = 8;
+        EXPECT_FALSE(key.value() == MockModuleCache::createKey(hDevice, &desc).value());
         binary[9] = 9;
     }
     {
         desc.pBuildFlags = nullptr;
-        auto ret = cache.find(hContext, hDevice, &desc);
-        EXPECT_FALSE(ret.has_value());
-        auto native2 = new uint8_t[nativeSize];
-        for (uint32_t i = 0u; i < nativeSize; ++i) {
-            native2[i] = native[i];
-        }
-        cache.store(hContext, hDevice, &desc, nativeSize, native2);
+        EXPECT_FALSE(key.value() == MockModuleCache::createKey(hDevice, &desc).value());
+        desc.pBuildFlags = buildOptions;
+    }
+    {
+        desc.pConstants = nullptr;
+        EXPECT_FALSE(key.value() == MockModuleCache::createKey(hDevice, &desc).value());
+        desc.pConstants = &constants;
+    }
+    EXPECT_TRUE(key.value() == MockModuleCache::createKey(hDevice, &desc).value());
+
+    EXPECT_FALSE(MockModuleCache::createKey(hDevice, nullptr).has_value());
+    ze_module_program_exp_desc_t programDesc = {ZE_STRUCTURE_TYPE_MODULE_PROGRAM_EXP_DESC};
+    desc.pNext = &programDesc;
+    EXPECT_FALSE(MockModuleCache::createKey(hDevice, &desc).has_value());
+}
+
+TEST(L0Service, givenModuleNotInCacheWhenAcquiringThenCallerBecomesBuilderAndPublishedBinaryIsReturnedToNextCallers) {
+    MockModuleCache cache;
+    MockModuleCache::Key key = {reinterpret_cast<ze_device_handle_t>(0x5678), ZE_MODULE_FORMAT_IL_SPIRV, 10U, 1U, 2U, 3U};
+
+    auto [entry, isBuilder] = cache.acquire(key);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_TRUE(isBuilder);
+    EXPECT_TRUE(entry->isBuilding);
+    EXPECT_EQ(1U, cache.getEntriesCount());
+
+    cache.publish(key, {10, 11, 12});
+    EXPECT_FALSE(entry->isBuilding);
+
+    auto [cachedEntry, isCachedEntryBuilder] = cache.acquire(key);
+    EXPECT_FALSE(isCachedEntryBuilder);
+    EXPECT_EQ(entry, cachedEntry);
+    EXPECT_EQ((std::vector<uint8_t>{10, 11, 12}), cachedEntry->nativeBinary);
+    EXPECT_EQ(1U, cache.getEntriesCount());
+
+    auto otherKey = key;
+    otherKey.buildOptionsHash = 5U;
+    auto [otherEntry, isOtherEntryBuilder] = cache.acquire(otherKey);
+    EXPECT_TRUE(isOtherEntryBuilder);
+    EXPECT_NE(entry, otherEntry);
+    EXPECT_EQ(2U, cache.getEntriesCount());
+}
 
-        ret = cache.find(hContext, hDevice, &desc);
-        EXPECT_TRUE(ret.has_value());
-        EXPECT_EQ(cache.cache.size(), 2u);
+TEST(L0Service, givenModuleBeingBuiltWhenAcquiringFromOtherThreadThenItWaitsForBuildToFinish) {
+    Cal::Mocks::LogCaptureContext logs;
+    MockModuleCache cache;
+    MockModuleCache::Key key = {reinterpret_cast<ze_device_handle_t>(0x5678), ZE_MODULE_FORMAT_IL_SPIRV, 10U, 1U, 2U, 3U};
+    auto otherKey = key;
+    otherKey.inputHash = 7U;
+
+    auto [entry, isBuilder] = cache.acquire(key);
+    ASSERT_TRUE(isBuilder);
+
+    std::atomic_bool waiterFinished = false;
+    std::thread waiter([&]() {
+        auto [waitedEntry, isWaiterBuilder] = cache.acquire(key);
+        EXPECT_FALSE(isWaiterBuilder);
+        EXPECT_FALSE(waitedEntry->isBuilding);
+        EXPECT_EQ((std::vector<uint8_t>{10, 11, 12}), waitedEntry->nativeBinary);
+        waiterFinished = true;
+    });
+
+    // other modules can be built in the meantime
+    std::thread otherBuilder([&]() {
+        auto [otherEntry, isOtherBuilder] = cache.acquire(otherKey);
+        EXPECT_TRUE(isOtherBuilder);
+        cache.publish(otherKey, {1});
+    });
+    otherBuilder.join();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(waiterFinished);
+
+    cache.publish(key, {10, 11, 12});
+    waiter.join();
+    EXPECT_TRUE(waiterFinished);
+}
+
+TEST(L0Service, givenModuleBuildAbandonedWhenOtherThreadWaitsForItThenItGetsEmptyBinaryAndEntryIsRemoved) {
+    Cal::Mocks::LogCaptureContext logs;
+    MockModuleCache cache;
+    MockModuleCache::Key key = {reinterpret_cast<ze_device_handle_t>(0x5678), ZE_MODULE_FORMAT_IL_SPIRV, 10U, 1U, 2U, 3U};
+
+    auto [entry, isBuilder] = cache.acquire(key);
+    ASSERT_TRUE(isBuilder);
+
+    std::thread waiter([&]() {
+        auto [waitedEntry, isWaiterBuilder] = cache.acquire(key);
+        EXPECT_FALSE(isWaiterBuilder);
+        EXPECT_FALSE(waitedEntry->isBuilding);
+        EXPECT_TRUE(waitedEntry->nativeBinary.empty());
+    });
+
+    // make sure waiter is blocked on the entry before it's abandoned
+    while (true) {
+        {
+            auto &shard = cache.getShard(key);
+            std::lock_guard<std::mutex> lock(shard.mtx);
+            if (entry.use_count() > 2) {
+                break;
+            }
+        }
+        std::this_thread::yield();
     }
+    cache.abandon(key);
+    waiter.join();
+    EXPECT_EQ(0U, cache.getEntriesCount());
+
+    auto [newEntry, isNewBuilder] = cache.acquire(key);
+    EXPECT_TRUE(isNewBuilder);
 }
 
 } // namespace Cal::Rpc::LevelZero
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "gtest/gtest.h"
+#include "service/client_memory_usage.h"
+#include "test/mocks/log_mock.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace Cal::Test::LevelZero::Service {
+
+using Cal::Service::ClientMemoryQuotas;
+using Cal::Service::ClientMemoryUsage;
+using Cal::Service::MemoryKind;
+
+TEST(ClientMemoryQuotasTest, givenListOfQuotasThenQuotasInMBAreParsedPerKind) {
+    auto quotas = ClientMemoryQuotas::parse("device=4096,shmem=16,,shared_va=1");
+    ASSERT_TRUE(quotas.has_value());
+    EXPECT_EQ(4096U * Cal::Utils::MB, quotas.value()[MemoryKind::device]);
+    EXPECT_EQ(0U, quotas.value()[MemoryKind::host]);
+    EXPECT_EQ(0U, quotas.value()[MemoryKind::shared]);
+    EXPECT_EQ(16U * Cal::Utils::MB, quotas.value()[MemoryKind::shmem]);
+    EXPECT_EQ(1U * Cal::Utils::MB, quotas.value()[MemoryKind::sharedVa]);
+
+    auto noQuotas = ClientMemoryQuotas::parse(nullptr);
+    ASSERT_TRUE(noQuotas.has_value());
+    for (auto quota : noQuotas.value()) {
+        EXPECT_EQ(0U, quota);
+    }
+}
+
+TEST(ClientMemoryQuotasTest, givenInvalidListOfQuotasThenParsingFails) {
+    EXPECT_FALSE(ClientMemoryQuotas::parse("vram=4096").has_value());
+    EXPECT_FALSE(ClientMemoryQuotas::parse("device").has_value());
+    EXPECT_FALSE(ClientMemoryQuotas::parse("device=4G").has_value());
+    EXPECT_FALSE(ClientMemoryQuotas::parse("device=1=2").has_value());
+}
+
+TEST(ClientMemoryUsageTest, givenNoQuotasThenAllChargesSucceedAndAreAccountedUntilReleased) {
+    ClientMemoryUsage usage;
+    EXPECT_TRUE(usage.tryCharge(MemoryKind::device, 1024U, false));
+    EXPECT_TRUE(usage.tryCharge(MemoryKind::host, 2048U, true));
+    EXPECT_EQ(1024U, usage.getBytesInUse(MemoryKind::device));
+    EXPECT_EQ(2048U, usage.getBytesInUse(MemoryKind::host));
+    EXPECT_EQ(2048U, usage.getBytesInUse(MemoryKind::sharedVa));
+
+    usage.release(MemoryKind::host, 2048U, true);
+    EXPECT_EQ(0U, usage.getBytesInUse(MemoryKind::host));
+    EXPECT_EQ(0U, usage.getBytesInUse(MemoryKind::sharedVa));
+    EXPECT_EQ(2048U, usage.getPeakBytesInUse(MemoryKind::host));
+    EXPECT_EQ(1024U, usage.getBytesInUse(MemoryKind::device));
+}
+
+TEST(ClientMemoryUsageTest, givenTrackedAllocationWhenReleasingItByPointerThenItsChargeIsReleased) {
+    ClientMemoryUsage usage;
+    int allocation = 0;
+    ASSERT_TRUE(usage.tryCharge(MemoryKind::shared, 4096U, true));
+    usage.trackAllocation(&allocation, MemoryKind::shared, 4096U, true);
+
+    usage.releaseAllocation(nullptr);
+    EXPECT_EQ(4096U, usage.getBytesInUse(MemoryKind::shared));
+
+    usage.releaseAllocation(&allocation);
+    EXPECT_EQ(0U, usage.getBytesInUse(MemoryKind::shared));
+    EXPECT_EQ(0U, usage.getBytesInUse(MemoryKind::sharedVa));
+
+    usage.releaseAllocation(&allocation);
+    EXPECT_EQ(0U, usage.getBytesInUse(MemoryKind::shared));
+}
+
+TEST(ClientMemoryUsageTest, givenHardQuotaWhenChargeWouldExceedItThenChargeIsRejected) {
+    ClientMemoryQuotas quotas;
+    quotas.hard[MemoryKind::device] = 4096U;
+    ClientMemoryUsage usage;
+    usage.setQuotas(quotas);
+
+    EXPECT_TRUE(usage.tryCharge(MemoryKind::device, 4096U, false));
+    {
+        Cal::Mocks::LogCaptureContext logs;
+        EXPECT_FALSE(usage.tryCharge(MemoryKind::device, 1U, false));
+        EXPECT_FALSE(logs.empty());
+    }
+    EXPECT_EQ(4096U, usage.getBytesInUse(MemoryKind::device));
+    EXPECT_EQ(1U, usage.getRejectedAllocationsCount(MemoryKind::device));
+
+    usage.release(MemoryKind::device, 1024U, false);
+    EXPECT_TRUE(usage.tryCharge(MemoryKind::device, 1024U, false));
+}
+
+TEST(ClientMemoryUsageTest, givenHardQuotaOfSharedVaWhenChargeFromSharedVaWouldExceedItThenChargeIsRejectedWithoutChargingItsKind) {
+    ClientMemoryQuotas quotas;
+    quotas.hard[MemoryKind::sharedVa] = 4096U;
+    ClientMemoryUsage usage;
+    usage.setQuotas(quotas);
+
+    EXPECT_TRUE(usage.tryCharge(MemoryKind::shmem, 8192U, false));
+    EXPECT_TRUE(usage.tryCharge(MemoryKind::host, 4096U, true));
+    {
+        Cal::Mocks::LogCaptureContext logs;
+        EXPECT_FALSE(usage.tryCharge(MemoryKind::shared, 4096U, true));
+    }
+    EXPECT_EQ(0U, usage.getBytesInUse(MemoryKind::shared));
+    EXPECT_EQ(4096U, usage.getBytesInUse(MemoryKind::sharedVa));
+    EXPECT_EQ(1U, usage.getRejectedAllocationsCount(MemoryKind::sharedVa));
+}
+
+TEST(ClientMemoryUsageTest, givenSoftQuotaWhenChargeExceedsItThenChargeSucceedsAndItIsReportedOnce) {
+    ClientMemoryQuotas quotas;
+    quotas.soft[MemoryKind::host] = 4096U;
+    ClientMemoryUsage usage;
+    usage.setQuotas(quotas);
+
+    Cal::Mocks::LogCaptureContext logs;
+    EXPECT_TRUE(usage.tryCharge(MemoryKind::host, 4096U, false));
+    EXPECT_TRUE(logs.empty());
+
+    EXPECT_TRUE(usage.tryCharge(MemoryKind::host, 1U, false));
+    EXPECT_FALSE(logs.empty());
+    auto reported = logs.str();
+
+    EXPECT_TRUE(usage.tryCharge(MemoryKind::host, 1U, false));
+    EXPECT_EQ(reported, logs.str());
+    EXPECT_EQ(0U, usage.getRejectedAllocationsCount(MemoryKind::host));
+}
+
+TEST(ClientMemoryUsageTest, givenStatsThenUsageAndQuotasArePublished) {
+    auto stats = std::make_unique<Cal::Stats::MemoryUsageStats>();
+    ClientMemoryQuotas quotas;
+    quotas.soft[MemoryKind::device] = 1024U;
+    quotas.hard[MemoryKind::device] = 2048U;
+    ClientMemoryUsage usage;
+    usage.setQuotas(quotas);
+    usage.setStats(stats.get());
+    EXPECT_EQ(1024U, stats->softQuota[MemoryKind::device].load());
+    EXPECT_EQ(2048U, stats->hardQuota[MemoryKind::device].load());
+
+    Cal::Mocks::LogCaptureContext logs;
+    EXPECT_TRUE(usage.tryCharge(MemoryKind::device, 1536U, false));
+    EXPECT_FALSE(usage.tryCharge(MemoryKind::device, 1024U, false));
+    usage.release(MemoryKind::device, 512U, false);
+    EXPECT_EQ(1024U, stats->bytesInUse[MemoryKind::device].load());
+    EXPECT_EQ(1536U, stats->peakBytesInUse[MemoryKind::device].load());
+    EXPECT_EQ(1U, stats->rejectedAllocations[MemoryKind::device].load());
+
+    usage.setStats(nullptr);
+    usage.release(MemoryKind::device, 1024U, false);
+    EXPECT_EQ(1024U, stats->bytesInUse[MemoryKind::device].load());
+}
+
+} // namespace Cal::Test::LevelZero::Service
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "gtest/gtest.h"
+#include "service/direct_transfers.h"
+#include "test/mocks/log_mock.h"
+#include "test/mocks/sys_mock.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <unistd.h>
+#include <vector>
+
+namespace Cal::Test::LevelZero::Service {
+
+using Cal::Service::DirectTransfers;
+
+TEST(DirectTransfersTest, givenDirectTransfersNotEnabledThenNothingIsTransferred) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    DirectTransfers directTransfers;
+    std::vector<uint8_t> serviceMemory(64, 1U);
+    std::vector<uint8_t> clientMemory(64, 2U);
+
+    EXPECT_FALSE(directTransfers.isEnabled());
+    EXPECT_EQ(0U, directTransfers.readFromClient({{serviceMemory.data(), reinterpret_cast<uintptr_t>(clientMemory.data()), clientMemory.size()}}));
+    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.process_vm_readv.callCount);
+    EXPECT_EQ(std::vector<uint8_t>(64, 1U), serviceMemory);
+}
+
+TEST(DirectTransfersTest, givenAccessToProcessThenMemoryIsReadFromItAndWrittenToIt) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    DirectTransfers directTransfers;
+    directTransfers.enable(getpid());
+    ASSERT_TRUE(directTransfers.isEnabled());
+
+    std::vector<uint8_t> serviceMemory(8192, 0U);
+    std::vector<uint8_t> clientMemory(8192);
+    for (size_t i = 0; i < clientMemory.size(); ++i) {
+        clientMemory[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    const auto clientAddress = reinterpret_cast<uintptr_t>(clientMemory.data());
+
+    EXPECT_EQ(2U, directTransfers.readFromClient({{serviceMemory.data(), clientAddress, 4096}, {serviceMemory.data() + 5000, clientAddress + 5000, 3000}}));
+    EXPECT_TRUE(std::equal(clientMemory.begin(), clientMemory.begin() + 4096, serviceMemory.begin()));
+    EXPECT_TRUE(std::equal(clientMemory.begin() + 5000, clientMemory.begin() + 8000, serviceMemory.begin() + 5000));
+    EXPECT_EQ(0U, serviceMemory[4096]);
+    EXPECT_EQ(0U, serviceMemory[8000]);
+
+    std::fill(serviceMemory.begin(), serviceMemory.end(), 9U);
+    EXPECT_EQ(1U, directTransfers.writeToClient({{serviceMemory.data() + 128, clientAddress + 128, 256}}));
+    EXPECT_EQ(9U, clientMemory[128]);
+    EXPECT_EQ(9U, clientMemory[383]);
+    EXPECT_NE(9U, clientMemory[384]);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.process_vm_readv.callCount);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.process_vm_writev.callCount);
+}
+
+TEST(DirectTransfersTest, givenPartialTransferThenOnlyFullyTransferredCopiesAreReportedAndTransfersStayEnabled) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+    tempSysCallsCtx.apiConfig.process_vm_readv.returnValue = 4096 + 100;
+    DirectTransfers directTransfers;
+    directTransfers.enable(getpid());
+
+    std::vector<uint8_t> memory(8192);
+    auto address = reinterpret_cast<uintptr_t>(memory.data());
+    EXPECT_EQ(1U, directTransfers.readFromClient({{memory.data(), address, 4096}, {memory.data() + 4096, address + 4096, 4096}}));
+    EXPECT_TRUE(directTransfers.isEnabled());
+}
+
+TEST(DirectTransfersTest, givenPermissionDeniedThenTransfersGetDisabled) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+    tempSysCallsCtx.apiConfig.process_vm_writev.impl = [](pid_t, const struct iovec *, unsigned long, const struct iovec *, unsigned long, unsigned long) -> ssize_t {
+        errno = EPERM;
+        return -1;
+    };
+    DirectTransfers directTransfers;
+    directTransfers.enable(getpid());
+
+    std::vector<uint8_t> memory(4096);
+    EXPECT_EQ(0U, directTransfers.writeToClient({{memory.data(), reinterpret_cast<uintptr_t>(memory.data()), memory.size()}}));
+    EXPECT_FALSE(directTransfers.isEnabled());
+
+    EXPECT_EQ(0U, directTransfers.writeToClient({{memory.data(), reinterpret_cast<uintptr_t>(memory.data()), memory.size()}}));
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.process_vm_writev.callCount);
+}
+
+TEST(DirectTransfersTest, givenMoreCopiesThanIovecLimitThenTheyAreTransferredInBatches) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    DirectTransfers directTransfers;
+    directTransfers.enable(getpid());
+
+    const size_t copiesCount = IOV_MAX + 10;
+    std::vector<uint8_t> src(copiesCount * 2);
+    std::vector<uint8_t> dst(copiesCount * 2, 0U);
+    std::vector<DirectTransfers::CopyDesc> copies;
+    for (size_t i = 0; i < copiesCount; ++i) {
+        src[i * 2] = static_cast<uint8_t>(i);
+        copies.push_back({dst.data() + i * 2, reinterpret_cast<uintptr_t>(src.data() + i * 2), 1});
+    }
+    EXPECT_EQ(copiesCount, directTransfers.readFromClient(copies));
+    EXPECT_EQ(2U, tempSysCallsCtx.apiConfig.process_vm_readv.callCount);
+    EXPECT_EQ(src, dst);
+}
+
+} // namespace Cal::Test::LevelZero::Service
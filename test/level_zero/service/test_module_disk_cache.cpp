@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "generated_service_level_zero.h"
+#include "gtest/gtest.h"
+#include "service/level_zero/module_disk_cache.h"
+#include "test/mocks/log_mock.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace Cal::Test::LevelZero::Service {
+
+struct MockModuleDiskCache : public Cal::Service::LevelZero::ModuleDiskCache {
+    using ModuleDiskCache::getEntryPath;
+    using ModuleDiskCache::ModuleDiskCache;
+};
+
+class ModuleDiskCacheTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        directory = (std::filesystem::temp_directory_path() / ("cal_module_disk_cache_ult_" + std::to_string(getpid()))).string();
+        std::error_code ec;
+        std::filesystem::remove_all(directory, ec);
+
+        originalZeDeviceGetProperties = Cal::Service::Apis::LevelZero::Standard::zeDeviceGetProperties;
+        originalZeDriverGetProperties = Cal::Service::Apis::LevelZero::Standard::zeDriverGetProperties;
+        Cal::Service::Apis::LevelZero::Standard::zeDeviceGetProperties = +[](ze_device_handle_t hDevice, ze_device_properties_t *pDeviceProperties) -> ze_result_t {
+            pDeviceProperties->vendorId = 0x8086;
+            pDeviceProperties->deviceId = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(hDevice));
+            strcpy(pDeviceProperties->name, "MockDevice");
+            return ZE_RESULT_SUCCESS;
+        };
+        Cal::Service::Apis::LevelZero::Standard::zeDriverGetProperties = +[](ze_driver_handle_t hDriver, ze_driver_properties_t *pDriverProperties) -> ze_result_t {
+            pDriverProperties->driverVersion = driverVersion;
+            return ZE_RESULT_SUCCESS;
+        };
+        driverVersion = 1U;
+    }
+
+    void TearDown() override {
+        Cal::Service::Apis::LevelZero::Standard::zeDeviceGetProperties = originalZeDeviceGetProperties;
+        Cal::Service::Apis::LevelZero::Standard::zeDriverGetProperties = originalZeDriverGetProperties;
+
+        std::error_code ec;
+        std::filesystem::remove_all(directory, ec);
+    }
+
+    static std::vector<uint8_t> createPayload(size_t size, uint8_t seed) {
+        std::vector<uint8_t> payload(size);
+        for (size_t i = 0; i < size; ++i) {
+            payload[i] = static_cast<uint8_t>(seed + i);
+        }
+        return payload;
+    }
+
+    ze_module_desc_t createModuleDesc() {
+        ze_module_desc_t desc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+        desc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+        desc.inputSize = sizeof(spirv);
+        desc.pInputModule = spirv;
+        desc.pBuildFlags = "-ze-opt-level=2";
+        return desc;
+    }
+
+    inline static uint32_t driverVersion = 1U;
+    decltype(Cal::Service::Apis::LevelZero::Standard::zeDeviceGetProperties) originalZeDeviceGetProperties = nullptr;
+    decltype(Cal::Service::Apis::LevelZero::Standard::zeDriverGetProperties) originalZeDriverGetProperties = nullptr;
+
+    std::string directory;
+    const uint8_t spirv[8] = {0x03, 0x02, 0x23, 0x07, 0x00, 0x01, 0x02, 0x03};
+    ze_device_handle_t device = reinterpret_cast<ze_device_handle_t>(0x1234);
+    Cal::Mocks::LogCaptureContext logs;
+};
+
+TEST_F(ModuleDiskCacheTest, givenNotExistingDirectoryWhenCreatingCacheThenDirectoryIsCreated) {
+    MockModuleDiskCache cache(directory, 1024U);
+    EXPECT_TRUE(cache.isUsable());
+    EXPECT_TRUE(std::filesystem::is_directory(directory));
+}
+
+TEST_F(ModuleDiskCacheTest, givenEmptyDirectoryPathWhenCreatingCacheThenCacheIsNotUsable) {
+    MockModuleDiskCache cache("", 1024U);
+    EXPECT_FALSE(cache.isUsable());
+    EXPECT_FALSE(cache.store({1, 2}, spirv, sizeof(spirv)));
+    EXPECT_FALSE(cache.load({1, 2}).has_value());
+}
+
+TEST_F(ModuleDiskCacheTest, givenStoredBinaryWhenLoadingWithSameKeyThenSameBinaryIsReturned) {
+    auto payload = createPayload(100, 7);
+    {
+        MockModuleDiskCache cache(directory, 4096U);
+        EXPECT_FALSE(cache.load({1, 2}).has_value());
+        EXPECT_TRUE(cache.store({1, 2}, payload.data(), payload.size()));
+    }
+
+    MockModuleDiskCache cacheAfterRestart(directory, 4096U);
+    auto loaded = cacheAfterRestart.load({1, 2});
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(payload, loaded.value());
+
+    EXPECT_FALSE(cacheAfterRestart.load({1, 3}).has_value());
+    EXPECT_FALSE(cacheAfterRestart.load({2, 2}).has_value());
+}
+
+TEST_F(ModuleDiskCacheTest, givenStoredBinaryThenNoTemporaryFilesAreLeftInCacheDirectory) {
+    MockModuleDiskCache cache(directory, 4096U);
+    auto payload = createPayload(100, 7);
+    ASSERT_TRUE(cache.store({1, 2}, payload.data(), payload.size()));
+
+    std::vector<std::string> files;
+    for (const auto &entry : std::filesystem::directory_iterator(directory)) {
+        files.push_back(entry.path().string());
+    }
+    ASSERT_EQ(1U, files.size());
+    EXPECT_EQ(cache.getEntryPath({1, 2}), files[0]);
+}
+
+TEST_F(ModuleDiskCacheTest, givenCorruptedPayloadWhenLoadingThenMissIsReportedAndEntryIsRemoved) {
+    MockModuleDiskCache cache(directory, 4096U);
+    auto payload = createPayload(100, 7);
+    ASSERT_TRUE(cache.store({1, 2}, payload.data(), payload.size()));
+
+    auto path = cache.getEntryPath({1, 2});
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(sizeof(Cal::Service::LevelZero::ModuleDiskCache::FileHeader) + 50);
+        file.put(static_cast<char>(0xFF));
+    }
+
+    EXPECT_FALSE(cache.load({1, 2}).has_value());
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+TEST_F(ModuleDiskCacheTest, givenTruncatedEntryWhenLoadingThenMissIsReportedAndEntryIsRemoved) {
+    MockModuleDiskCache cache(directory, 4096U);
+    auto payload = createPayload(100, 7);
+    ASSERT_TRUE(cache.store({1, 2}, payload.data(), payload.size()));
+
+    auto path = cache.getEntryPath({1, 2});
+    std::filesystem::resize_file(path, sizeof(Cal::Service::LevelZero::ModuleDiskCache::FileHeader) + 10);
+
+    EXPECT_FALSE(cache.load({1, 2}).has_value());
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+TEST_F(ModuleDiskCacheTest, givenEntryPublishedUnderWrongKeyWhenLoadingThenMissIsReported) {
+    MockModuleDiskCache cache(directory, 4096U);
+    auto payload = createPayload(100, 7);
+    ASSERT_TRUE(cache.store({1, 2}, payload.data(), payload.size()));
+    std::filesystem::rename(cache.getEntryPath({1, 2}), cache.getEntryPath({3, 4}));
+
+    EXPECT_FALSE(cache.load({3, 4}).has_value());
+}
+
+TEST_F(ModuleDiskCacheTest, givenCacheSizeLimitExceededWhenStoringThenLeastRecentlyUsedEntriesAreEvicted) {
+    constexpr size_t payloadSize = 1000U;
+    constexpr size_t entrySize = payloadSize + sizeof(Cal::Service::LevelZero::ModuleDiskCache::FileHeader);
+    MockModuleDiskCache cache(directory, 2 * entrySize);
+    auto payload = createPayload(payloadSize, 3);
+
+    ASSERT_TRUE(cache.store({1, 1}, payload.data(), payload.size()));
+    ASSERT_TRUE(cache.store({2, 2}, payload.data(), payload.size()));
+    auto now = std::filesystem::file_time_type::clock::now();
+    std::filesystem::last_write_time(cache.getEntryPath({1, 1}), now - std::chrono::hours(2));
+    std::filesystem::last_write_time(cache.getEntryPath({2, 2}), now - std::chrono::hours(1));
+
+    ASSERT_TRUE(cache.load({1, 1}).has_value()); // {2, 2} becomes least recently used
+
+    ASSERT_TRUE(cache.store({3, 3}, payload.data(), payload.size()));
+    EXPECT_TRUE(std::filesystem::exists(cache.getEntryPath({1, 1})));
+    EXPECT_FALSE(std::filesystem::exists(cache.getEntryPath({2, 2})));
+    EXPECT_TRUE(std::filesystem::exists(cache.getEntryPath({3, 3})));
+}
+
+TEST_F(ModuleDiskCacheTest, givenBinaryLargerThanCacheSizeLimitWhenStoringThenItIsRejected) {
+    MockModuleDiskCache cache(directory, 100U);
+    auto payload = createPayload(100U, 3);
+    EXPECT_FALSE(cache.store({1, 1}, payload.data(), payload.size()));
+    EXPECT_FALSE(std::filesystem::exists(cache.getEntryPath({1, 1})));
+}
+
+TEST_F(ModuleDiskCacheTest, givenSameModuleDescWhenCreatingKeyThenSameKeyIsReturned) {
+    MockModuleDiskCache cache(directory, 4096U);
+    auto desc = createModuleDesc();
+    auto key = cache.createKey(device, &desc);
+    ASSERT_TRUE(key.has_value());
+
+    auto descCopy = createModuleDesc();
+    auto sameKey = cache.createKey(device, &descCopy);
+    ASSERT_TRUE(sameKey.has_value());
+    EXPECT_EQ(key->toString(), sameKey->toString());
+}
+
+TEST_F(ModuleDiskCacheTest, givenDifferentInputBuildFlagsConstantsDeviceOrDriverWhenCreatingKeyThenDifferentKeysAreReturned) {
+    MockModuleDiskCache cache(directory, 4096U);
+    auto desc = createModuleDesc();
+    auto baseKey = cache.createKey(device, &desc)->toString();
+
+    {
+        auto otherDesc = createModuleDesc();
+        const uint8_t otherSpirv[8] = {0x03, 0x02, 0x23, 0x07, 0x00, 0x01, 0x02, 0x04};
+        otherDesc.pInputModule = otherSpirv;
+        EXPECT_NE(baseKey, cache.createKey(device, &otherDesc)->toString());
+    }
+    {
+        auto otherDesc = createModuleDesc();
+        otherDesc.pBuildFlags = "-ze-opt-level=1";
+        EXPECT_NE(baseKey, cache.createKey(device, &otherDesc)->toString());
+    }
+    {
+        auto otherDesc = createModuleDesc();
+        otherDesc.pBuildFlags = nullptr;
+        EXPECT_NE(baseKey, cache.createKey(device, &otherDesc)->toString());
+    }
+    {
+        uint32_t ids[] = {1};
+        uint64_t values[] = {0x13};
+        const void *pValues[] = {values};
+        ze_module_constants_t constants = {1U, ids, pValues};
+        auto otherDesc = createModuleDesc();
+        otherDesc.pConstants = &constants;
+        EXPECT_NE(baseKey, cache.createKey(device, &otherDesc)->toString());
+    }
+    {
+        auto otherDevice = reinterpret_cast<ze_device_handle_t>(0x5678);
+        EXPECT_NE(baseKey, cache.createKey(otherDevice, &desc)->toString());
+    }
+    {
+        driverVersion = 2U;
+        MockModuleDiskCache cacheWithUpdatedDriver(directory, 4096U);
+        EXPECT_NE(baseKey, cacheWithUpdatedDriver.createKey(device, &desc)->toString());
+    }
+}
+
+TEST_F(ModuleDiskCacheTest, givenUnsupportedModuleDescWhenCreatingKeyThenNoKeyIsReturned) {
+    MockModuleDiskCache cache(directory, 4096U);
+    EXPECT_FALSE(cache.createKey(device, nullptr).has_value());
+
+    auto nativeDesc = createModuleDesc();
+    nativeDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    EXPECT_FALSE(cache.createKey(device, &nativeDesc).has_value());
+
+    ze_module_program_exp_desc_t programDesc = {ZE_STRUCTURE_TYPE_MODULE_PROGRAM_EXP_DESC};
+    auto extendedDesc = createModuleDesc();
+    extendedDesc.pNext = &programDesc;
+    EXPECT_FALSE(cache.createKey(device, &extendedDesc).has_value());
+}
+
+TEST_F(ModuleDiskCacheTest, givenFailingDevicePropertiesQueryWhenCreatingKeyThenNoKeyIsReturned) {
+    Cal::Service::Apis::LevelZero::Standard::zeDeviceGetProperties = +[](ze_device_handle_t hDevice, ze_device_properties_t *pDeviceProperties) -> ze_result_t {
+        return ZE_RESULT_ERROR_DEVICE_LOST;
+    };
+    MockModuleDiskCache cache(directory, 4096U);
+    auto desc = createModuleDesc();
+    EXPECT_FALSE(cache.createKey(device, &desc).has_value());
+}
+
+} // namespace Cal::Test::LevelZero::Service
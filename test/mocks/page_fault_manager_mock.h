@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "client/client_platform.h"
+#include "client/icd/icd_page_fault_manager.h"
 
 namespace Cal {
 namespace Mocks {
@@ -22,6 +22,8 @@ struct MockFdAllocator {
     static constexpr bool isThreadSafe = true;
 
     AllocationT allocate(size_t size, size_t alignment) {
+        lastAllocationSize = size;
+        lastAllocationAlignment = alignment;
         return AllocationT{fdToReturn++, size, true};
     }
 
@@ -35,6 +37,8 @@ struct MockFdAllocator {
 
     int fdToReturn = 1;
     int freeCallCount = 0;
+    size_t lastAllocationSize = 0U;
+    size_t lastAllocationAlignment = 0U;
 };
 
 struct MockFdSubAllocator {
@@ -74,6 +74,10 @@ int (*shm_unlink)(const char *name) = +[](const char *name) -> int {
     return Cal::Mocks::getSysCallsContext()->shm_unlink(name);
 };
 
+int (*memfd_create)(const char *name, unsigned int flags) = +[](const char *name, unsigned int flags) -> int {
+    return Cal::Mocks::getSysCallsContext()->memfd_create(name, flags);
+};
+
 int (*sem_init)(sem_t *sem, int pshared, unsigned int value) = +[](sem_t *sem, int pshared, unsigned int value) -> int {
     return Cal::Mocks::getSysCallsContext()->sem_init(sem, pshared, value);
 };
@@ -90,6 +94,18 @@ int (*sem_post)(sem_t *sem) = +[](sem_t *sem) -> int {
     return Cal::Mocks::getSysCallsContext()->sem_post(sem);
 };
 
+long (*futex)(uint32_t *uaddr, int futexOp, uint32_t val, const struct timespec *timeout) = +[](uint32_t *uaddr, int futexOp, uint32_t val, const struct timespec *timeout) -> long {
+    return Cal::Mocks::getSysCallsContext()->futex(uaddr, futexOp, val, timeout);
+};
+
+ssize_t (*process_vm_readv)(pid_t pid, const struct iovec *localIov, unsigned long localIovCount, const struct iovec *remoteIov, unsigned long remoteIovCount, unsigned long flags) = +[](pid_t pid, const struct iovec *localIov, unsigned long localIovCount, const struct iovec *remoteIov, unsigned long remoteIovCount, unsigned long flags) -> ssize_t {
+    return Cal::Mocks::getSysCallsContext()->process_vm_readv(pid, localIov, localIovCount, remoteIov, remoteIovCount, flags);
+};
+
+ssize_t (*process_vm_writev)(pid_t pid, const struct iovec *localIov, unsigned long localIovCount, const struct iovec *remoteIov, unsigned long remoteIovCount, unsigned long flags) = +[](pid_t pid, const struct iovec *localIov, unsigned long localIovCount, const struct iovec *remoteIov, unsigned long remoteIovCount, unsigned long flags) -> ssize_t {
+    return Cal::Mocks::getSysCallsContext()->process_vm_writev(pid, localIov, localIovCount, remoteIov, remoteIovCount, flags);
+};
+
 int (*close)(int fd) = +[](int fd) -> int {
     return Cal::Mocks::getSysCallsContext()->close(fd);
 };
@@ -106,6 +122,10 @@ int (*mprotect)(void *addr, size_t len, int prot) = +[](void *addr, size_t len,
     return Cal::Mocks::getSysCallsContext()->mprotect(addr, len, prot);
 };
 
+int (*madvise)(void *addr, size_t length, int advice) = +[](void *addr, size_t length, int advice) -> int {
+    return Cal::Mocks::getSysCallsContext()->madvise(addr, length, advice);
+};
+
 int (*unlink)(const char *pathname) = +[](const char *pathname) -> int {
     return Cal::Mocks::getSysCallsContext()->unlink(pathname);
 };
@@ -142,5 +162,9 @@ int (*stat)(const char *path, struct stat *buf) = +[](const char *path, struct s
     return Cal::Mocks::getSysCallsContext()->stat(path, buf);
 };
 
+int (*fstat)(int fd, struct stat *buf) = +[](int fd, struct stat *buf) -> int {
+    return Cal::Mocks::getSysCallsContext()->fstat(fd, buf);
+};
+
 } // namespace Sys
 } // namespace Cal
@@ -11,8 +11,11 @@
 #include "shared/sys.h"
 #include "shared/utils.h"
 
+#include <chrono>
+#include <condition_variable>
 #include <cstring>
 #include <functional>
+#include <linux/futex.h>
 #include <mutex>
 #include <optional>
 #include <unordered_map>
@@ -82,6 +85,19 @@ struct SysCallsContext {
         return 0;
     }
 
+    virtual int madvise(void *addr, size_t length, int advice) {
+        ++apiConfig.madvise.callCount;
+        if (apiConfig.madvise.returnValue) {
+            return apiConfig.madvise.returnValue.value();
+        }
+
+        if (apiConfig.madvise.impl) {
+            return apiConfig.madvise.impl.value()(addr, length, advice);
+        }
+
+        return 0;
+    }
+
     virtual char *getenv(const char *name) {
         ++apiConfig.getenv.callCount;
         if (apiConfig.getenv.returnValue) {
@@ -131,6 +147,17 @@ struct SysCallsContext {
         return shm_unlinkBaseImpl(name);
     }
 
+    virtual int memfd_create(const char *name, unsigned int flags) {
+        ++apiConfig.memfd_create.callCount;
+        if (apiConfig.memfd_create.returnValue.has_value()) {
+            return apiConfig.memfd_create.returnValue.value();
+        }
+        if (apiConfig.memfd_create.impl) {
+            return apiConfig.memfd_create.impl.value()(name, flags);
+        }
+        return memfd_createBaseImpl(name, flags);
+    }
+
     virtual int sem_init(sem_t *sem, int pshared, unsigned int value) {
         ++apiConfig.sem_init.callCount;
         if (apiConfig.sem_init.returnValue) {
@@ -175,6 +202,39 @@ struct SysCallsContext {
         return sem_postBaseImpl(sem);
     };
 
+    virtual long futex(uint32_t *uaddr, int futexOp, uint32_t val, const struct timespec *timeout) {
+        ++apiConfig.futex.callCount;
+        if (apiConfig.futex.returnValue) {
+            return apiConfig.futex.returnValue.value();
+        }
+        if (apiConfig.futex.impl) {
+            return apiConfig.futex.impl.value()(uaddr, futexOp, val, timeout);
+        }
+        return futexBaseImpl(uaddr, futexOp, val, timeout);
+    }
+
+    virtual ssize_t process_vm_readv(pid_t pid, const struct iovec *localIov, unsigned long localIovCount, const struct iovec *remoteIov, unsigned long remoteIovCount, unsigned long flags) {
+        ++apiConfig.process_vm_readv.callCount;
+        if (apiConfig.process_vm_readv.returnValue) {
+            return apiConfig.process_vm_readv.returnValue.value();
+        }
+        if (apiConfig.process_vm_readv.impl) {
+            return apiConfig.process_vm_readv.impl.value()(pid, localIov, localIovCount, remoteIov, remoteIovCount, flags);
+        }
+        return ::process_vm_readv(pid, localIov, localIovCount, remoteIov, remoteIovCount, flags);
+    }
+
+    virtual ssize_t process_vm_writev(pid_t pid, const struct iovec *localIov, unsigned long localIovCount, const struct iovec *remoteIov, unsigned long remoteIovCount, unsigned long flags) {
+        ++apiConfig.process_vm_writev.callCount;
+        if (apiConfig.process_vm_writev.returnValue) {
+            return apiConfig.process_vm_writev.returnValue.value();
+        }
+        if (apiConfig.process_vm_writev.impl) {
+            return apiConfig.process_vm_writev.impl.value()(pid, localIov, localIovCount, remoteIov, remoteIovCount, flags);
+        }
+        return ::process_vm_writev(pid, localIov, localIovCount, remoteIov, remoteIovCount, flags);
+    }
+
     virtual int setenv(const char *name, const char *value, int overwrite) {
         ++apiConfig.setenv.callCount;
         if (apiConfig.setenv.returnValue) {
@@ -322,6 +382,21 @@ struct SysCallsContext {
         return 0;
     }
 
+    virtual int fstat(int fd, struct stat *buf) {
+        ++apiConfig.fstat.callCount;
+        if (apiConfig.fstat.returnValue) {
+            return apiConfig.fstat.returnValue.value();
+        }
+
+        if (apiConfig.fstat.impl) {
+            return apiConfig.fstat.impl.value()(fd, buf);
+        }
+
+        *buf = {};
+        buf->st_nlink = 1;
+        return 0;
+    }
+
     virtual int mkdir(const char *path, mode_t mode) {
         ++apiConfig.mkdir.callCount;
         if (apiConfig.mkdir.returnValue) {
@@ -432,6 +507,16 @@ struct SysCallsContext {
         return fd;
     }
 
+    int memfd_createBaseImpl(const char *name, unsigned int flags) {
+        auto fd = fds.allocate();
+        if (Cal::Allocators::BitAllocator::invalidOffset == fd) {
+            return -1;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        openFiles[fd] = FileOpenArgs{name, O_RDWR, 0};
+        return fd;
+    }
+
     int shm_unlinkBaseImpl(const char *name) {
         std::lock_guard<std::mutex> lock(mutex);
         auto descIt = shmems.find(name);
@@ -487,6 +572,34 @@ struct SysCallsContext {
         return 0;
     }
 
+    long futexBaseImpl(uint32_t *uaddr, int futexOp, uint32_t val, const struct timespec *timeout) {
+        std::unique_lock<std::mutex> lock(futexMutex);
+        switch (futexOp & FUTEX_CMD_MASK) {
+        default:
+            errno = ENOSYS;
+            return -1;
+        case FUTEX_WAIT: {
+            if (__atomic_load_n(uaddr, __ATOMIC_SEQ_CST) != val) {
+                errno = EAGAIN;
+                return -1;
+            }
+            auto wakeupsBefore = futexWakeups[uaddr];
+            auto isWokenUp = [&]() { return futexWakeups[uaddr] != wakeupsBefore; };
+            if (nullptr == timeout) {
+                futexWakeupsCv.wait(lock, isWokenUp);
+            } else if (false == futexWakeupsCv.wait_for(lock, std::chrono::seconds(timeout->tv_sec) + std::chrono::nanoseconds(timeout->tv_nsec), isWokenUp)) {
+                errno = ETIMEDOUT;
+                return -1;
+            }
+            return 0;
+        }
+        case FUTEX_WAKE:
+            ++futexWakeups[uaddr];
+            futexWakeupsCv.notify_all();
+            return 0;
+        }
+    }
+
     int closeBaseImpl(int fd) {
         fds.free(fd);
         std::lock_guard<std::mutex> lock(mutex);
@@ -512,6 +625,9 @@ struct SysCallsContext {
 
     Vma vma = {{static_cast<uintptr_t>(0U), static_cast<uintptr_t>(1ULL << 48)}};
     std::unordered_map<sem_t *, std::unique_ptr<PSemaphore>> semaphores;
+    std::unordered_map<uint32_t *, uint64_t> futexWakeups;
+    std::condition_variable futexWakeupsCv;
+    std::mutex futexMutex;
     std::unordered_map<std::string, std::string> envVariables;
     Cal::Allocators::BitAllocator fds;
     std::unordered_map<int, FileOpenArgs> openFiles;
@@ -567,6 +683,12 @@ struct SysCallsContext {
             uint64_t callCount = 0U;
         } shm_unlink;
 
+        struct {
+            std::optional<int> returnValue;
+            std::optional<std::function<int(const char *name, unsigned int flags)>> impl;
+            uint64_t callCount = 0U;
+        } memfd_create;
+
         struct {
             std::optional<int> returnValue;
             std::optional<std::function<int(sem_t *sem, int pshared, unsigned int value)>> impl;
@@ -591,6 +713,24 @@ struct SysCallsContext {
             uint64_t callCount = 0U;
         } sem_post;
 
+        struct {
+            std::optional<long> returnValue;
+            std::optional<std::function<long(uint32_t *uaddr, int futexOp, uint32_t val, const struct timespec *timeout)>> impl;
+            uint64_t callCount = 0U;
+        } futex;
+
+        struct {
+            std::optional<ssize_t> returnValue;
+            std::optional<std::function<ssize_t(pid_t pid, const struct iovec *localIov, unsigned long localIovCount, const struct iovec *remoteIov, unsigned long remoteIovCount, unsigned long flags)>> impl;
+            uint64_t callCount = 0U;
+        } process_vm_readv;
+
+        struct {
+            std::optional<ssize_t> returnValue;
+            std::optional<std::function<ssize_t(pid_t pid, const struct iovec *localIov, unsigned long localIovCount, const struct iovec *remoteIov, unsigned long remoteIovCount, unsigned long flags)>> impl;
+            uint64_t callCount = 0U;
+        } process_vm_writev;
+
         struct {
             std::optional<int> returnValue;
             std::optional<std::function<int(int fd)>> impl;
@@ -615,6 +755,12 @@ struct SysCallsContext {
             uint64_t callCount = 0U;
         } mprotect;
 
+        struct {
+            std::optional<int> returnValue;
+            std::optional<std::function<int(void *addr, size_t length, int advice)>> impl;
+            uint64_t callCount = 0U;
+        } madvise;
+
         struct {
             std::optional<int> returnValue;
             std::optional<std::function<int(const char *pathname)>> impl;
@@ -668,6 +814,12 @@ struct SysCallsContext {
             std::optional<std::function<int(const char *path, struct stat *buf)>> impl;
             uint64_t callCount = 0U;
         } stat;
+
+        struct {
+            std::optional<int> returnValue;
+            std::optional<std::function<int(int fd, struct stat *buf)>> impl;
+            uint64_t callCount = 0U;
+        } fstat;
     } apiConfig;
 };
 
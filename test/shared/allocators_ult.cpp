@@ -12,6 +12,11 @@
 #include "test/mocks/shmem_manager_mock.h"
 #include "test/mocks/sys_mock.h"
 
+#include <chrono>
+#include <deque>
+#include <set>
+#include <vector>
+
 namespace Cal::Ult {
 
 using namespace Cal::Allocators;
@@ -292,6 +297,85 @@ TEST(TagAllocator, WhenFreeingTagsThenTheyCanBeReallocated) {
     EXPECT_EQ(nullptr, allocator.allocate());
 }
 
+TEST(CircularAllocator, whenCreatedFromRangeThenRepresentsThatRangeAndIsEmpty) {
+    Cal::Utils::AddressRange heapRange = {4096U, 8192U};
+    Cal::Allocators::CircularAllocator heap(heapRange);
+    EXPECT_EQ(heapRange, heap.getRange());
+    EXPECT_EQ(0U, heap.getSizeUsed());
+    EXPECT_EQ(0U, heap.getAllocationsEnd());
+}
+
+TEST(CircularAllocator, whenAllocatingThenReturnsConsecutiveAlignedAddressesUntilRangeIsFull) {
+    Cal::Utils::AddressRange heapRange = {4096U, 8192U};
+    Cal::Allocators::CircularAllocator heap(heapRange);
+    EXPECT_EQ(reinterpret_cast<void *>(4096U), heap.allocate(100, 8));
+    EXPECT_EQ(reinterpret_cast<void *>(4096U + 128U), heap.allocate(64, 128));
+    EXPECT_EQ(128U + 128U, heap.getSizeUsed());
+    EXPECT_EQ(reinterpret_cast<void *>(4096U + 256U), heap.allocate(4096U - 256U, 8));
+    EXPECT_EQ(4096U, heap.getSizeUsed());
+    EXPECT_EQ(nullptr, heap.allocate(8, 8));
+    EXPECT_EQ(4096U, heap.getSizeUsed());
+}
+
+TEST(CircularAllocator, whenReclaimingUpToMarkerThenReleasesOnlyAllocationsMadeBeforeMarkerWasTaken) {
+    Cal::Utils::AddressRange heapRange = {4096U, 8192U};
+    Cal::Allocators::CircularAllocator heap(heapRange);
+    heap.allocate(1024, 8);
+    auto marker = heap.getAllocationsEnd();
+    heap.allocate(2048, 8);
+    heap.allocate(1024, 8);
+    EXPECT_EQ(nullptr, heap.allocate(8, 8));
+
+    heap.reclaim(marker);
+    EXPECT_EQ(3072U, heap.getSizeUsed());
+    EXPECT_EQ(reinterpret_cast<void *>(4096U), heap.allocate(1024, 8));
+    EXPECT_EQ(nullptr, heap.allocate(8, 8));
+
+    heap.reclaim(marker); // already reclaimed
+    EXPECT_EQ(4096U, heap.getSizeUsed());
+}
+
+TEST(CircularAllocator, givenAllocationThatDoesNotFitAtTheEndOfRangeThenItIsPlacedAtTheBeginningAndRemainingSpaceIsSkipped) {
+    Cal::Utils::AddressRange heapRange = {4096U, 8192U};
+    Cal::Allocators::CircularAllocator heap(heapRange);
+    heap.allocate(1024, 8);
+    auto marker = heap.getAllocationsEnd();
+    heap.allocate(2048, 8);
+    heap.reclaim(marker);
+
+    EXPECT_EQ(nullptr, heap.allocate(1536, 8));
+    EXPECT_EQ(reinterpret_cast<void *>(4096U + 3072U), heap.allocate(512, 8));
+    EXPECT_EQ(reinterpret_cast<void *>(4096U), heap.allocate(1024, 8));
+    EXPECT_EQ(4096U, heap.getSizeUsed());
+    EXPECT_EQ(nullptr, heap.allocate(8, 8));
+
+    heap.free();
+    EXPECT_EQ(0U, heap.getSizeUsed());
+    EXPECT_EQ(reinterpret_cast<void *>(4096U + 1024U), heap.allocate(2048, 8));
+}
+
+TEST(CircularAllocator, whenAllocatingAndReclaimingManyTimesThenAllocationsNeverOverlapWithUnreclaimedOnesNorCrossRangeBounds) {
+    Cal::Utils::AddressRange heapRange = {4096U, 4096U + 3000U};
+    Cal::Allocators::CircularAllocator heap(heapRange);
+    std::deque<std::pair<Cal::Utils::AddressRange, Cal::Allocators::CircularAllocator::MarkerT>> live;
+    for (size_t i = 0; i < 100000; ++i) {
+        size_t size = 8 + (i * 37) % 400;
+        auto ptr = heap.allocate(size, 8);
+        while (nullptr == ptr) {
+            ASSERT_FALSE(live.empty());
+            heap.reclaim(live.front().second);
+            live.pop_front();
+            ptr = heap.allocate(size, 8);
+        }
+        Cal::Utils::AddressRange range{ptr, size};
+        ASSERT_TRUE(heapRange.contains(range));
+        for (auto &[liveRange, marker] : live) {
+            ASSERT_FALSE(liveRange.intersects(range));
+        }
+        live.push_back({range, heap.getAllocationsEnd()});
+    }
+}
+
 TEST(AddressRangeAllocator, whenDefaultInitializedThenRepresentsEmptyRange) {
     Cal::Utils::AddressRange emptyRange = {0U, 0U};
     Cal::Allocators::AddressRangeAllocator heap;
@@ -475,6 +559,98 @@ TEST(AddressRangeAllocator, whenAllocatingAddressessThenAlignmentsAreTakenIntoAc
     EXPECT_TRUE(Cal::Utils::isAlignedPow2<4096U>(ptr3));
 }
 
+TEST(AddressRangeAllocator, givenAlignmentBiggerThanFreeRangesWhenAllocatingThenDoesNotOverlapAllocatedRanges) {
+    Cal::Utils::AddressRange heapRange = {uintptr_t{4096U}, uintptr_t{4096U + 8 * Cal::Utils::MB}};
+    Cal::Allocators::AddressRangeAllocator heap(heapRange);
+    auto first = heap.allocate(4096U, 4096U);
+    auto second = heap.allocate(4096U, 4096U);
+    auto third = heap.allocate(8 * Cal::Utils::MB - 2 * 4096U, 4096U);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    ASSERT_NE(nullptr, third);
+    heap.free(first);
+
+    EXPECT_EQ(nullptr, heap.allocate(Cal::Utils::MB, Cal::Utils::pageSize2MB));
+
+    heap.free(third);
+    auto aligned = heap.allocate(Cal::Utils::MB, Cal::Utils::pageSize2MB);
+    ASSERT_NE(nullptr, aligned);
+    EXPECT_TRUE(Cal::Utils::isAlignedPow2<Cal::Utils::pageSize2MB>(aligned));
+}
+
+TEST(AddressRangeAllocator, givenFreedRangesOfDifferentSizesWhenTopOfTheHeapIsExhaustedThenReuseSmallestRangeThatFits) {
+    Cal::Utils::AddressRange heapRange = {uintptr_t{4096U}, uintptr_t{4096U + 1024U}};
+    Cal::Allocators::AddressRangeAllocator heap(heapRange);
+    auto big = heap.allocate(256U);
+    auto separator0 = heap.allocate(64U);
+    auto small = heap.allocate(128U);
+    auto separator1 = heap.allocate(1024U - 256U - 64U - 128U);
+    ASSERT_NE(nullptr, big);
+    ASSERT_NE(nullptr, separator0);
+    ASSERT_NE(nullptr, small);
+    ASSERT_NE(nullptr, separator1);
+
+    heap.free(big);
+    heap.free(small);
+    EXPECT_EQ(2U, heap.getFreeRangesCount());
+    EXPECT_EQ(256U, heap.getLargestFreeRangeSize());
+
+    EXPECT_EQ(small, heap.allocate(96U));
+    EXPECT_EQ(big, heap.allocate(192U));
+    EXPECT_EQ(nullptr, heap.allocate(128U));
+}
+
+TEST(AddressRangeAllocator, whenFreeingRangesThenAdjacentFreeRangesAreCoalesced) {
+    Cal::Utils::AddressRange heapRange = {uintptr_t{4096U}, uintptr_t{4096U + 256U}};
+    Cal::Allocators::AddressRangeAllocator heap(heapRange);
+    auto ptr0 = heap.allocate(64U);
+    auto ptr1 = heap.allocate(64U);
+    auto ptr2 = heap.allocate(64U);
+    auto ptr3 = heap.allocate(64U);
+    ASSERT_NE(nullptr, ptr3);
+    EXPECT_EQ(0U, heap.getFreeRangesCount());
+
+    heap.free(ptr0);
+    heap.free(ptr2);
+    EXPECT_EQ(2U, heap.getFreeRangesCount());
+    heap.free(ptr1);
+    EXPECT_EQ(1U, heap.getFreeRangesCount());
+    EXPECT_EQ(192U, heap.getLargestFreeRangeSize());
+
+    EXPECT_EQ(ptr0, heap.allocate(192U));
+    EXPECT_EQ(0U, heap.getFreeRangesCount());
+}
+
+TEST(AddressRangeAllocator, whenResizingRangeThenSizeUsedIsUpdatedAndRangeGrowsOnlyIntoFreeSpace) {
+    Cal::Utils::AddressRange heapRange = {uintptr_t{4096U}, uintptr_t{4096U + 1024U}};
+    Cal::Allocators::AddressRangeAllocator heap(heapRange);
+    auto ptr0 = heap.allocate(128U);
+    ASSERT_NE(nullptr, ptr0);
+
+    size_t oldSize = 0U;
+    EXPECT_EQ(ptr0, heap.resizeOrAllocate(ptr0, 256U, oldSize));
+    EXPECT_EQ(128U, oldSize);
+    EXPECT_EQ(256U, heap.getSizeUsed());
+
+    EXPECT_EQ(ptr0, heap.resizeOrAllocate(ptr0, 64U, oldSize));
+    EXPECT_EQ(256U, oldSize);
+    EXPECT_EQ(64U, heap.getSizeUsed());
+
+    auto ptr1 = heap.allocate(64U);
+    ASSERT_NE(nullptr, ptr1);
+    auto moved = heap.resizeOrAllocate(ptr0, 128U, oldSize);
+    EXPECT_NE(ptr0, moved);
+    EXPECT_EQ(64U, oldSize);
+    EXPECT_EQ(64U + 64U + 128U, heap.getSizeUsed());
+
+    heap.free(ptr0);
+    heap.free(ptr1);
+    heap.free(moved);
+    EXPECT_EQ(0U, heap.getSizeUsed());
+    EXPECT_EQ(1U, heap.getFreeRangesCount());
+    EXPECT_EQ(1024U, heap.getLargestFreeRangeSize());
+}
+
 TEST(BaseAllocation, whenQueuriedForRangeThenReturnsEmptyRange) {
     Cal::Allocators::BaseAllocation baseAlloc;
     EXPECT_TRUE(baseAlloc.getRange().empty());
@@ -747,18 +923,49 @@ TEST(AllocatorWithGlobalMmapToFd, whenRequestedNonPow2AlignmentThenReturnsInvali
     EXPECT_FALSE(logs.empty());
 }
 
-TEST(AllocatorWithGlobalMmapToFd, givenAlignmentGreaterThe4KBThenReturnsInvalidAllocationAndEmitsError) {
-    Cal::Mocks::LogCaptureContext logs;
+TEST(AllocatorWithGlobalMmapToFd, givenAlignmentGreaterThan4KBThenMapsFdAtAlignedAddressAndReleasesRestOfReservation) {
     Cal::Mocks::SysCallsContext tempSysCallsCtx;
 
     MockFdAllocator mockFdAllocator;
+    mockFdAllocator.fdToReturn = 7;
     AllocatorWithGlobalMmapToFd<MockFdAllocator, true> allocator{mockFdAllocator, MmapConfig{PROT_READ | PROT_WRITE, MAP_SHARED}};
 
-    auto alloc = allocator.allocate(4, 8192U);
-    EXPECT_FALSE(alloc.isValid());
+    auto alloc = allocator.allocate(4, Cal::Utils::pageSize64KB);
+    ASSERT_TRUE(alloc.isValid());
+    EXPECT_TRUE(Cal::Utils::isAlignedPow2<Cal::Utils::pageSize64KB>(alloc.getMmappedPtr()));
+    EXPECT_EQ(Cal::Utils::pageSize64KB, alloc.getMmappedSize());
+    EXPECT_EQ(Cal::Utils::pageSize64KB, mockFdAllocator.lastAllocationAlignment);
+    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.madvise.callCount);
 
-    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.mmap.callCount);
-    EXPECT_FALSE(logs.empty());
+    ASSERT_EQ(1U, tempSysCallsCtx.vma.getSubRanges().size());
+    EXPECT_EQ(alloc.getMmappedPtr(), tempSysCallsCtx.vma.getSubRanges()[0].getBoundingRange().base());
+    EXPECT_EQ(alloc.getMmappedSize(), tempSysCallsCtx.vma.getSubRanges()[0].getBoundingRange().size());
+    EXPECT_EQ(7, tempSysCallsCtx.vma.getSubRanges()[0].getTag().fd);
+
+    allocator.free(alloc);
+    EXPECT_TRUE(tempSysCallsCtx.vma.getSubRanges().empty());
+}
+
+TEST(AllocatorWithGlobalMmapToFd, givenHugePageAlignmentThenAdvisesHugePagesAndAlignsWholeGigabytesTo1GB) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+
+    MockFdAllocator mockFdAllocator;
+    AllocatorWithGlobalMmapToFd<MockFdAllocator, true> allocator{mockFdAllocator, MmapConfig{PROT_READ | PROT_WRITE, MAP_SHARED}};
+
+    auto alloc = allocator.allocate(4 * Cal::Utils::MB, Cal::Utils::pageSize2MB);
+    ASSERT_TRUE(alloc.isValid());
+    EXPECT_TRUE(Cal::Utils::isAlignedPow2<Cal::Utils::pageSize2MB>(alloc.getMmappedPtr()));
+    EXPECT_EQ(Cal::Utils::pageSize2MB, mockFdAllocator.lastAllocationAlignment);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.madvise.callCount);
+    allocator.free(alloc);
+
+    tempSysCallsCtx.apiConfig.madvise.returnValue = -1; // hugepages are only a hint
+    alloc = allocator.allocate(Cal::Utils::GB, Cal::Utils::pageSize2MB);
+    ASSERT_TRUE(alloc.isValid());
+    EXPECT_TRUE(Cal::Utils::isAlignedPow2<Cal::Utils::pageSize1GB>(alloc.getMmappedPtr()));
+    EXPECT_EQ(Cal::Utils::pageSize1GB, mockFdAllocator.lastAllocationAlignment);
+    EXPECT_EQ(2U, tempSysCallsCtx.apiConfig.madvise.callCount);
+    allocator.free(alloc);
 }
 
 TEST(AllocatorWithGlobalMmapToFd, whenUnderlyingFdAllocatorReturnedInvalidAllocationThenFails) {
@@ -1170,6 +1377,29 @@ TEST(ArenaAllocatorAllocate, whenHugeAllocationIsRequestedThenCreatesANonSharedB
     arenaAllocator.free(allocation);
 }
 
+TEST(ArenaAllocatorAllocate, givenArenaAlignmentThenNewArenasAndBigStandaloneAllocationsAreAlignedToIt) {
+    MockFdAllocator baseAllocator;
+    size_t allocationGranularity = 4 * Cal::Utils::MB;
+    size_t arenaAlignment = Cal::Utils::pageSize2MB;
+    ArenaAllocator<MockFdAllocator, true> arenaAllocator{baseAllocator, allocationGranularity, arenaAlignment};
+    EXPECT_EQ(arenaAlignment, arenaAllocator.getArenaAlignment());
+
+    auto inArena = arenaAllocator.allocate(8192U);
+    ASSERT_TRUE(inArena.isValid());
+    EXPECT_EQ(allocationGranularity, baseAllocator.lastAllocationSize);
+    EXPECT_EQ(arenaAlignment, baseAllocator.lastAllocationAlignment);
+
+    size_t standaloneSize = 3 * Cal::Utils::MB;
+    auto standalone = arenaAllocator.allocate(standaloneSize);
+    ASSERT_TRUE(standalone.isValid());
+    EXPECT_EQ(standaloneSize, standalone.getSubAllocationSize());
+    EXPECT_EQ(4 * Cal::Utils::MB, standalone.getSourceAllocation()->getFileSize());
+    EXPECT_EQ(arenaAlignment, baseAllocator.lastAllocationAlignment);
+
+    arenaAllocator.free(standalone);
+    arenaAllocator.free(inArena);
+}
+
 TEST(ArenaAllocatorAllocate, whenHugeAllocationIsRequestedButUnderlyingAllocatorFailsThenReturnsInvalidAllocation) {
     Cal::Mocks::LogCaptureContext logs;
     MockFdAllocator baseAllocator;
@@ -1406,4 +1636,206 @@ TEST(ArenaAllocatorFree, whenArenaOfFreedAllocationCanBeRecycledThenPlaceItInRec
     arenaAllocator.free(allocation6);
 }
 
+TEST(ArenaAllocatorSizeClasses, whenSizeIsRoundedToSizeClassThenClassesAreSpacedByQuarterOfPowerOf2) {
+    using ArenaAllocatorT = ArenaAllocator<MockFdAllocator, true>;
+    EXPECT_EQ(4096U, ArenaAllocatorT::getSizeClass(4096U));
+    EXPECT_EQ(12288U, ArenaAllocatorT::getSizeClass(12288U));
+    EXPECT_EQ(16384U, ArenaAllocatorT::getSizeClass(16384U));
+    EXPECT_EQ(20480U, ArenaAllocatorT::getSizeClass(20480U));
+    EXPECT_EQ(40960U, ArenaAllocatorT::getSizeClass(36864U));
+    EXPECT_EQ(Cal::Utils::MB + 256 * Cal::Utils::KB, ArenaAllocatorT::getSizeClass(Cal::Utils::MB + 4096U));
+    EXPECT_EQ(2 * Cal::Utils::MB, ArenaAllocatorT::getSizeClass(2 * Cal::Utils::MB));
+}
+
+TEST(ArenaAllocatorThreadCaches, givenThreadCachesDisabledByDefaultThenFreedChunksGoBackToArena) {
+    MockFdAllocator baseAllocator;
+    size_t allocationGranularity = 4096U * 4;
+    ArenaAllocator<MockFdAllocator, true> arenaAllocator{baseAllocator, allocationGranularity};
+    EXPECT_FALSE(arenaAllocator.usesThreadCaches());
+
+    auto allocation = arenaAllocator.allocate(4096U);
+    ASSERT_TRUE(allocation.isValid());
+    auto arena = static_cast<ArenaAllocator<MockFdAllocator, true>::ArenaT *>(allocation.getArena());
+    auto sizeLeft = arena->getSizeLeft();
+    arenaAllocator.free(allocation);
+    EXPECT_EQ(sizeLeft + 4096U, arena->getSizeLeft());
+}
+
+TEST(ArenaAllocatorThreadCaches, givenThreadCachesWhenChunkIsFreedThenItIsReusedBySameSizeClassWithoutReturningToArena) {
+    MockFdAllocator baseAllocator;
+    size_t allocationGranularity = Cal::Utils::MB;
+    using ArenaAllocatorT = ArenaAllocator<MockFdAllocator, true>;
+    ArenaAllocatorT arenaAllocator{baseAllocator, allocationGranularity, ArenaAllocatorT::minAlignment, true};
+    EXPECT_TRUE(arenaAllocator.usesThreadCaches());
+
+    auto allocation = arenaAllocator.allocate(36864U);
+    ASSERT_TRUE(allocation.isValid());
+    EXPECT_EQ(40960U, allocation.getSubAllocationSize());
+    auto arena = static_cast<ArenaAllocatorT::ArenaT *>(allocation.getArena());
+    auto sizeLeft = arena->getSizeLeft();
+
+    arenaAllocator.free(allocation);
+    EXPECT_EQ(sizeLeft, arena->getSizeLeft());
+
+    auto reused = arenaAllocator.allocate(40960U);
+    ASSERT_TRUE(reused.isValid());
+    EXPECT_EQ(allocation.getArena(), reused.getArena());
+    EXPECT_EQ(allocation.getSubAllocationOffset(), reused.getSubAllocationOffset());
+    EXPECT_EQ(sizeLeft, arena->getSizeLeft());
+
+    auto otherSizeClass = arenaAllocator.allocate(8192U);
+    ASSERT_TRUE(otherSizeClass.isValid());
+    EXPECT_NE(reused.getSubAllocationOffset(), otherSizeClass.getSubAllocationOffset());
+
+    arenaAllocator.free(reused);
+    arenaAllocator.free(otherSizeClass);
+}
+
+TEST(ArenaAllocatorThreadCaches, givenThreadCachesWhenCachedChunkIsNotAlignedEnoughThenAllocatesNewChunk) {
+    MockFdAllocator baseAllocator;
+    size_t allocationGranularity = Cal::Utils::MB;
+    using ArenaAllocatorT = ArenaAllocator<MockFdAllocator, true>;
+    ArenaAllocatorT arenaAllocator{baseAllocator, allocationGranularity, ArenaAllocatorT::minAlignment, true};
+
+    auto entryArenaPadding = arenaAllocator.allocate(4096U);
+    auto padding = arenaAllocator.allocate(4096U);
+    auto allocation = arenaAllocator.allocate(65536U);
+    ASSERT_TRUE(allocation.isValid());
+    ASSERT_FALSE(Cal::Utils::isAlignedPow2<65536U>(allocation.getSubAllocationOffset()));
+    arenaAllocator.free(allocation);
+
+    auto aligned = arenaAllocator.allocate(65536U, 65536U);
+    ASSERT_TRUE(aligned.isValid());
+    EXPECT_TRUE(Cal::Utils::isAlignedPow2<65536U>(aligned.getSubAllocationOffset()));
+
+    arenaAllocator.free(aligned);
+    arenaAllocator.free(padding);
+    arenaAllocator.free(entryArenaPadding);
+}
+
+TEST(ArenaAllocatorThreadCaches, givenThreadCachesWhenTooManyChunksOfSizeClassAreFreedThenOldestHalfIsReturnedToArenaInOneBatch) {
+    MockFdAllocator baseAllocator;
+    size_t allocationGranularity = Cal::Utils::MB;
+    using ArenaAllocatorT = ArenaAllocator<MockFdAllocator, true>;
+    ArenaAllocatorT arenaAllocator{baseAllocator, allocationGranularity, ArenaAllocatorT::minAlignment, true};
+
+    auto entryArenaPadding = arenaAllocator.allocate(4096U);
+    std::vector<ArenaAllocatorT::AllocationT> allocations;
+    for (size_t i = 0; i < ArenaAllocatorT::maxCachedChunksPerSizeClass + 1; ++i) {
+        allocations.push_back(arenaAllocator.allocate(4096U));
+        ASSERT_TRUE(allocations.back().isValid());
+    }
+    auto arena = static_cast<ArenaAllocatorT::ArenaT *>(allocations[0].getArena());
+    auto sizeLeft = arena->getSizeLeft();
+
+    for (size_t i = 0; i < ArenaAllocatorT::maxCachedChunksPerSizeClass; ++i) {
+        arenaAllocator.free(allocations[i]);
+    }
+    EXPECT_EQ(sizeLeft, arena->getSizeLeft());
+
+    arenaAllocator.free(allocations.back());
+    auto batchSize = (ArenaAllocatorT::maxCachedChunksPerSizeClass + 2) / 2;
+    EXPECT_EQ(sizeLeft + batchSize * 4096U, arena->getSizeLeft());
+
+    arenaAllocator.free(entryArenaPadding);
+}
+
+TEST(ArenaAllocatorThreadCaches, givenThreadCachesWhenMediumAllocationIsFreedThenItIsPooledAndReusedInsteadOfNewStandaloneAllocation) {
+    MockFdAllocator baseAllocator;
+    size_t allocationGranularity = 4096U * 16;
+    using ArenaAllocatorT = ArenaAllocator<MockFdAllocator, true>;
+    {
+        ArenaAllocatorT arenaAllocator{baseAllocator, allocationGranularity, ArenaAllocatorT::minAlignment, true};
+
+        auto medium = arenaAllocator.allocate(4096U * 9);
+        ASSERT_TRUE(medium.isValid());
+        EXPECT_EQ(nullptr, medium.getArena());
+        EXPECT_EQ(4096U * 10, medium.getSourceAllocation()->getFileSize());
+        auto mediumFd = medium.getSourceAllocation()->getFd();
+        arenaAllocator.free(medium);
+        EXPECT_EQ(0, baseAllocator.freeCallCount);
+
+        auto reused = arenaAllocator.allocate(4096U * 10);
+        ASSERT_TRUE(reused.isValid());
+        EXPECT_EQ(mediumFd, reused.getSourceAllocation()->getFd());
+        arenaAllocator.free(reused);
+
+        auto huge = arenaAllocator.allocate(allocationGranularity * 2);
+        ASSERT_TRUE(huge.isValid());
+        arenaAllocator.free(huge);
+        EXPECT_EQ(1, baseAllocator.freeCallCount);
+    }
+    EXPECT_EQ(3, baseAllocator.freeCallCount); // pooled medium allocation + entry arena
+}
+
+TEST(ArenaAllocatorIdleTrimming, givenIdleTrimmingWhenRecycledArenasStayUnusedForLongerThanIdleTimeoutThenTheirMemoryIsDiscardedExceptForLowWatermark) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    std::vector<std::pair<void *, int>> discarded;
+    tempSysCallsCtx.apiConfig.madvise.impl = [&discarded](void *addr, size_t length, int advice) {
+        discarded.emplace_back(addr, advice);
+        return 0;
+    };
+    MockShmemManager shmemManager;
+    size_t allocationGranularity = 4096U * 4;
+    using ArenaAllocatorT = MockArenaAllocator<Cal::Ipc::NonUsmMmappedShmemAllocator>;
+    {
+        ArenaAllocatorT arenaAllocator{Cal::Ipc::NonUsmMmappedShmemAllocator{shmemManager.shmemAllocator}, allocationGranularity};
+        std::vector<ArenaAllocatorT::AllocationT> allocations;
+        for (int i = 0; i < 6; ++i) { // 3 full arenas
+            allocations.push_back(arenaAllocator.allocate(allocationGranularity / 2));
+            ASSERT_TRUE(allocations.back().isValid());
+        }
+        auto firstArenaPtr = allocations[0].getSourceAllocation()->getMmappedPtr();
+        ASSERT_EQ(3U, std::set<void *>({firstArenaPtr, allocations[2].getSourceAllocation()->getMmappedPtr(), allocations[4].getSourceAllocation()->getMmappedPtr()}).size());
+
+        arenaAllocator.free(allocations[0]);
+        arenaAllocator.free(allocations[1]);
+        auto now = Cal::Utils::IdleTrimmer::ClockT::now();
+        EXPECT_EQ(0U, arenaAllocator.trimIdleArenas(now + std::chrono::hours(1))); // disabled by default
+
+        arenaAllocator.setIdleTrimming({std::chrono::milliseconds(1000), 1U});
+        EXPECT_EQ(0U, arenaAllocator.trimIdleArenas(now));
+        arenaAllocator.free(allocations[2]); // second arena becomes idle as well
+        arenaAllocator.free(allocations[3]);
+        EXPECT_TRUE(discarded.empty());
+
+        EXPECT_EQ(1U, arenaAllocator.trimIdleArenas(now + std::chrono::milliseconds(1000)));
+        ASSERT_EQ(1U, discarded.size());
+        EXPECT_EQ(firstArenaPtr, discarded[0].first);
+        EXPECT_EQ(MADV_REMOVE, discarded[0].second);
+
+        EXPECT_EQ(0U, arenaAllocator.trimIdleArenas(now + std::chrono::hours(1))); // low watermark
+        EXPECT_EQ(1U, discarded.size());
+
+        arenaAllocator.free(allocations[4]);
+        arenaAllocator.free(allocations[5]);
+    }
+}
+
+TEST(ArenaAllocatorIdleTrimming, givenIdleTrimmingWhenRecycledArenaIsInUseThenItsMemoryIsNotDiscarded) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    MockShmemManager shmemManager;
+    size_t allocationGranularity = 4096U * 4;
+    using ArenaAllocatorT = MockArenaAllocator<Cal::Ipc::NonUsmMmappedShmemAllocator>;
+    {
+        ArenaAllocatorT arenaAllocator{Cal::Ipc::NonUsmMmappedShmemAllocator{shmemManager.shmemAllocator}, allocationGranularity};
+        arenaAllocator.setIdleTrimming({std::chrono::milliseconds(1000), 0U});
+        std::vector<ArenaAllocatorT::AllocationT> allocations;
+        for (int i = 0; i < 4; ++i) { // 2 full arenas
+            allocations.push_back(arenaAllocator.allocate(allocationGranularity / 2));
+            ASSERT_TRUE(allocations.back().isValid());
+        }
+        arenaAllocator.free(allocations[0]); // first arena is recycled, but still in use
+
+        auto now = Cal::Utils::IdleTrimmer::ClockT::now();
+        EXPECT_EQ(1U, arenaAllocator.recycledArenas->size());
+        EXPECT_EQ(0U, arenaAllocator.trimIdleArenas(now + std::chrono::hours(1)));
+        EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.madvise.callCount);
+
+        for (int i = 1; i < 4; ++i) {
+            arenaAllocator.free(allocations[i]);
+        }
+    }
+}
+
 } // namespace Cal::Ult
@@ -423,6 +423,35 @@ TEST_F(MemoryBlockTest, GivenMemoryBlockWhichConsistsOfThreeChunksWhenGettingTwo
     EXPECT_EQ(memoryBlock.chunks[1].firstPageAddress, transferDescs[1].clientAddress);
 }
 
+TEST_F(MemoryBlockTest, GivenMemoryBlockWhichConsistsOfThreeChunksWhenGettingChunksOverlappingOnlyLastOneThenOnlyLastChunkIsReturned) {
+    const void *longerChunkPtr{reinterpret_cast<const void *>(pageBeginning - chunkSize)};
+    const size_t longerChunkSize{4 * chunkSize};
+
+    memoryBlock.extendBlockIfRequired(longerChunkPtr, longerChunkSize);
+    ASSERT_EQ(3u, memoryBlock.chunks.size());
+
+    const auto lastChunkBegin = memoryBlock.chunks[2].firstPageAddress;
+    const void *lastChunkOverlappingPtr{reinterpret_cast<const void *>(lastChunkBegin + 16)};
+    const size_t lastChunkOverlappingSize{pageSize};
+    EXPECT_EQ(1u, memoryBlock.getCountOfOverlappingChunks(lastChunkOverlappingPtr, lastChunkOverlappingSize));
+
+    const uint32_t transferDescsCount{1};
+    Cal::Rpc::TransferDesc transferDescs[transferDescsCount] = {};
+    uint32_t appendedTransfersCount{0};
+    EXPECT_TRUE(memoryBlock.appendOverlappingChunks(lastChunkOverlappingPtr,
+                                                    lastChunkOverlappingSize,
+                                                    appendedTransfersCount,
+                                                    transferDescs,
+                                                    transferDescsCount));
+    ASSERT_EQ(1u, appendedTransfersCount);
+    EXPECT_EQ(memoryBlock.chunks[2].shmem.getShmemId(), transferDescs[0].shmemId);
+    EXPECT_EQ(16u, transferDescs[0].offsetFromResourceStart);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(lastChunkOverlappingPtr), transferDescs[0].clientAddress);
+
+    const void *afterBlockPtr{reinterpret_cast<const void *>(memoryBlock.getBlockEndAddress())};
+    EXPECT_EQ(0u, memoryBlock.getCountOfOverlappingChunks(afterBlockPtr, pageSize));
+}
+
 TEST_F(MemoryBlocksManagerTest, DefaultConstructedMemoryBlocksManagerDoesNotContainAnyBlocks) {
     EXPECT_TRUE(memoryBlocksManager.memoryBlocks.empty());
 }
@@ -696,6 +725,19 @@ TEST_F(MemoryBlocksManagerTestWithThreeNonOverlappingBlocks, GivenThreeNonOverla
     EXPECT_TRUE(containsExpectedError) << output;
 }
 
+TEST_F(MemoryBlocksManagerTestWithThreeNonOverlappingBlocks, GivenThreeNonOverlappingMemoryBlocksInManagerWhenTranslatingTransferDescThenServiceMappingOfItsClientAddressIsReturned) {
+    Cal::Rpc::TransferDesc transferDesc{};
+    transferDesc.clientAddress = firstPageOfSecondChunk + pageSize + 16;
+    transferDesc.bytesCountToCopy = pageSize;
+
+    const auto memoryBlock = memoryBlocksManager.getMemoryBlockWhichIncludesChunk(reinterpret_cast<const void *>(transferDesc.clientAddress), transferDesc.bytesCountToCopy);
+    ASSERT_NE(nullptr, memoryBlock);
+    EXPECT_EQ(memoryBlock->translate(reinterpret_cast<const void *>(transferDesc.clientAddress)), memoryBlocksManager.translateTransferDesc(transferDesc));
+
+    transferDesc.clientAddress = firstPageOfThirdChunk + 8 * pageSize;
+    EXPECT_EQ(nullptr, memoryBlocksManager.translateTransferDesc(transferDesc));
+}
+
 TEST_F(MemoryBlocksManagerTest, GivenMemoryBlockInManagerWhenGettingBlockForChunkWhichDoesNotOverlapThenReturnNullptr) {
     const void *firstSrcAddress{reinterpret_cast<const void *>(firstPageAddress + 64)};
     const size_t firstChunkSize{pageSize};
@@ -801,6 +843,40 @@ TEST_F(MemoryBlocksManagerTestWithThreeUSMBlocks, GivenThreeUSMPairsInManagerWhe
     EXPECT_EQ(transferDescs[1].shmemId, -1);
 }
 
+TEST_F(MemoryBlocksManagerTest, GivenManyMemoryBlocksAndUSMPairsInManagerWhenGettingRequiredTransfersThenOnlyMatchingOnesAreReturnedAndUSMPairsAreConsumed) {
+    constexpr size_t blocksCount{256};
+    for (size_t i = 0; i < blocksCount; ++i) {
+        memoryBlocksManager.registerMemoryBlock(shmemManagerMock, reinterpret_cast<const void *>(firstPageAddress + (2 * i * pageSize)), pageSize);
+        memoryBlocksManager.registerUSMStaging(reinterpret_cast<const void *>(firstPageAddress + (2 * i * pageSize) + pageSize), 64);
+    }
+    ASSERT_EQ(blocksCount, memoryBlocksManager.memoryBlocks.size());
+    ASSERT_EQ(blocksCount, memoryBlocksManager.usmMemoryPairs.size());
+
+    const auto blockAddress = firstPageAddress + (2 * 100 * pageSize);
+    const void *usmAddress = reinterpret_cast<const void *>(firstPageAddress + (2 * 200 * pageSize) + pageSize);
+    const uint32_t chunksCount{2};
+    Cal::Rpc::MemChunk chunks[chunksCount] = {
+        {reinterpret_cast<const void *>(blockAddress + 32), 64},
+        {usmAddress, 64}};
+
+    uint32_t transferDescsCount{0};
+    ASSERT_TRUE(memoryBlocksManager.getCountOfRequiredTransferDescs(transferDescsCount, chunksCount, chunks));
+    ASSERT_EQ(2u, transferDescsCount);
+
+    Cal::Rpc::TransferDesc transferDescs[2] = {};
+    ASSERT_TRUE(memoryBlocksManager.getRequiredTransferDescs(transferDescsCount, transferDescs, chunksCount, chunks));
+    ASSERT_EQ(2u, transferDescsCount);
+    EXPECT_EQ(blockAddress + 32, transferDescs[0].clientAddress);
+    EXPECT_EQ(32u, transferDescs[0].offsetFromResourceStart);
+    EXPECT_EQ(reinterpret_cast<uint64_t>(usmAddress), transferDescs[1].offsetFromResourceStart);
+    EXPECT_EQ(-1, transferDescs[1].shmemId);
+    EXPECT_EQ(blocksCount - 1, memoryBlocksManager.usmMemoryPairs.size());
+
+    Cal::Mocks::LogCaptureContext logs;
+    EXPECT_FALSE(memoryBlocksManager.getRequiredTransferDescs(transferDescsCount, transferDescs, 1, &chunks[1]));
+    EXPECT_FALSE(logs.empty());
+}
+
 TEST_F(MemoryBlocksManagerTest, GivenNoMemoryBlocksWhenLookingForOverlappingBlocksBeginThenEndIsReturned) {
     const void *srcAddress{reinterpret_cast<const void *>(firstPageAddress + 64)};
     const size_t chunkSize{pageSize};
@@ -6,12 +6,19 @@
  */
 
 #include "gtest/gtest.h"
+#include "service/rpc_channels_workers_pool.h"
 #include "shared/rpc.h"
 #include "test/mocks/connection_mock.h"
 #include "test/mocks/log_mock.h"
 #include "test/mocks/shmem_manager_mock.h"
 #include "test/mocks/sys_mock.h"
 
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <set>
+#include <thread>
+
 namespace Cal {
 
 namespace Ult {
@@ -223,6 +230,7 @@ class CommandsChannelWhiteBox : public Cal::Rpc::CommandsChannel {
     using CommandsChannel::layout;
     using CommandsChannel::ownsSemaphores;
     using CommandsChannel::ring;
+    using CommandsChannel::ringTailWaiters;
     using CommandsChannel::semClient;
     using CommandsChannel::semServer;
     using CommandsChannel::shmem;
@@ -230,6 +238,7 @@ class CommandsChannelWhiteBox : public Cal::Rpc::CommandsChannel {
 
     using CommandsChannel::getAsLocalAddress;
     using CommandsChannel::getAsShmemOffset;
+    using CommandsChannel::getRingTailFutexWord;
     using CommandsChannel::partition;
 };
 
@@ -417,6 +426,7 @@ TEST(CommandsChannelPartitioUsingDefaultLayoutn, givenCorrectShmemSizeThenPartit
     EXPECT_EQ(layout.semClient, commandsChannel.layout.semClient);
 
     EXPECT_EQ(layout.ringTail, commandsChannel.layout.ringTail);
+    EXPECT_EQ(layout.ringTailWaiters, commandsChannel.layout.ringTailWaiters);
     EXPECT_EQ(layout.semServer, commandsChannel.layout.semServer);
 
     EXPECT_EQ(layout.ringStart, commandsChannel.layout.ringStart);
@@ -430,6 +440,8 @@ TEST(CommandsChannelPartitioUsingDefaultLayoutn, givenCorrectShmemSizeThenPartit
 
     EXPECT_EQ(commandsChannel.getAsLocalAddress<sem_t>(layout.semClient), commandsChannel.semClient);
     EXPECT_EQ(commandsChannel.getAsLocalAddress<sem_t>(layout.semServer), commandsChannel.semServer);
+    EXPECT_EQ(commandsChannel.getAsLocalAddress<uint32_t>(layout.ringTailWaiters), commandsChannel.ringTailWaiters);
+    EXPECT_EQ(commandsChannel.getAsLocalAddress<uint32_t>(layout.ringTail), commandsChannel.getRingTailFutexWord());
 
     EXPECT_EQ(layout.ringStart, commandsChannel.getAsShmemOffset(commandsChannel.ring.peekHead()));
     EXPECT_EQ((layout.ringEnd - layout.ringStart) / sizeof(Cal::Rpc::RingEntry), commandsChannel.ring.getCapacity());
@@ -591,7 +603,7 @@ TEST(CommandsChannelPartitionUsingGivenLayout, givenInvalidLayoutThenFailsAndEmi
 
     auto invalidLayout = validLayout;
 
-    Cal::Messages::OffsetWithinChannelT *offsetsToBreak[] = {&invalidLayout.semClient, &invalidLayout.semServer, &invalidLayout.ringHead, &invalidLayout.ringTail,
+    Cal::Messages::OffsetWithinChannelT *offsetsToBreak[] = {&invalidLayout.semClient, &invalidLayout.semServer, &invalidLayout.ringHead, &invalidLayout.ringTail, &invalidLayout.ringTailWaiters,
                                                              &invalidLayout.ringStart, &invalidLayout.completionStampsStart, &invalidLayout.clientHeapStart, &invalidLayout.clientHeapEnd};
 
     size_t *capacitiesToBreak[] = {&invalidLayout.ringCapacity, &invalidLayout.completionStampsCapacity};
@@ -599,6 +611,7 @@ TEST(CommandsChannelPartitionUsingGivenLayout, givenInvalidLayoutThenFailsAndEmi
     std::pair<Cal::Messages::OffsetWithinChannelT *, Cal::Messages::OffsetWithinChannelT *> overlapsToTest[] = {
         {&invalidLayout.semClient, &invalidLayout.semServer},
         {&invalidLayout.ringHead, &invalidLayout.ringTail},
+        {&invalidLayout.ringTail, &invalidLayout.ringTailWaiters},
     };
 
     for (auto offsetToBreak : offsetsToBreak) {
@@ -666,6 +679,7 @@ TEST(CommandsChannelPartitionUsingGivenLayout, givenValidLayoutThenUsesIt) {
     EXPECT_EQ(commandsChannel.layout.semClient, commandsChannel2.layout.semClient);
 
     EXPECT_EQ(commandsChannel.layout.ringTail, commandsChannel2.layout.ringTail);
+    EXPECT_EQ(commandsChannel.layout.ringTailWaiters, commandsChannel2.layout.ringTailWaiters);
     EXPECT_EQ(commandsChannel.layout.semServer, commandsChannel2.layout.semServer);
 
     EXPECT_EQ(commandsChannel.layout.ringStart, commandsChannel2.layout.ringStart);
@@ -742,6 +756,7 @@ class ChannelClientWhiteBox : public Cal::Rpc::ChannelClient {
     using CommandsChannel::layout;
     using CommandsChannel::ownsSemaphores;
     using CommandsChannel::ring;
+    using CommandsChannel::ringTailWaiters;
     using CommandsChannel::semClient;
     using CommandsChannel::semServer;
     using CommandsChannel::shmem;
@@ -749,14 +764,25 @@ class ChannelClientWhiteBox : public Cal::Rpc::ChannelClient {
 
     using CommandsChannel::getAsLocalAddress;
     using CommandsChannel::getAsShmemOffset;
+    using CommandsChannel::getRingTailFutexWord;
     using CommandsChannel::partition;
 
     using ChannelClient::ChannelClient;
     using ChannelClient::cmdHeap;
+    using ChannelClient::cmdHeapPendingReclaims;
+    using ChannelClient::reclaimCmdHeap;
+    using ChannelClient::clientSynchronizationMethod;
+    using ChannelClient::completionSlotsCount;
     using ChannelClient::completionStamp;
+    using ChannelClient::initCompletionSlots;
+    using ChannelClient::lastAsyncCompletionStamp;
+    using ChannelClient::lastSubmittedCallAsync;
+    using ChannelClient::maxBatchAge;
+    using ChannelClient::maxBatchedCallsCount;
     using ChannelClient::semaphoreWaitThreshold;
     using ChannelClient::serviceSynchronizationMethod;
     using ChannelClient::standaloneHeap;
+    using ChannelClient::useBatchedCalls;
     using ChannelClient::underlyingShmem;
 };
 
@@ -936,6 +962,15 @@ TEST(ChannelClientInit, whenInitializationIsSuccesfullThenSetsSemaphoreWaitThres
         EXPECT_TRUE(connection.encodeIssues.empty()) << " in messages issues : [" << connection.getEncodeLogFlat() << "]";
         EXPECT_EQ(Cal::Rpc::ChannelClient::SemaphoreThresholds::base, channelClient.semaphoreWaitThreshold);
     }
+
+    {
+        auto connection = connectionTemplate;
+        ChannelClientWhiteBox channelClient{connection, shmemManager, usmShmemImporter};
+        EXPECT_TRUE(channelClient.init(ChannelClientWhiteBox::ClientSynchronizationMethod::futex, false));
+        EXPECT_TRUE(connection.mismatchLogs.empty()) << " out messages issues : [" << connection.getMismatchLogFlat() << "]";
+        EXPECT_TRUE(connection.encodeIssues.empty()) << " in messages issues : [" << connection.getEncodeLogFlat() << "]";
+        EXPECT_EQ(Cal::Rpc::ChannelClient::SemaphoreThresholds::unreachableAlwaysActiveWait, channelClient.semaphoreWaitThreshold);
+    }
     shmemManager.free(commandsChannelShmem);
 }
 
@@ -970,6 +1005,16 @@ TEST(ChannelClientInit, whenInitializationIsSuccesfullThenSetsServiceWaitMethodB
         EXPECT_EQ(RespLaunchRpcShmemRingBuffer::semaphores, channelClient.serviceSynchronizationMethod);
     }
 
+    {
+        auto connection = connectionTemplate;
+        std::get<1>(connection.inMessages).serviceSynchronizationMethod = RespLaunchRpcShmemRingBuffer::futex;
+        ChannelClientWhiteBox channelClient{connection, shmemManager, usmShmemImporter};
+        EXPECT_TRUE(channelClient.init(ChannelClientWhiteBox::ClientSynchronizationMethod::activePolling, false));
+        EXPECT_TRUE(connection.mismatchLogs.empty()) << " out messages issues : [" << connection.getMismatchLogFlat() << "]";
+        EXPECT_TRUE(connection.encodeIssues.empty()) << " in messages issues : [" << connection.getEncodeLogFlat() << "]";
+        EXPECT_EQ(RespLaunchRpcShmemRingBuffer::futex, channelClient.serviceSynchronizationMethod);
+    }
+
     shmemManager.free(commandsChannelShmem);
 }
 
@@ -989,6 +1034,8 @@ TEST(ChannelClientInit, whenInitializationIsSuccesfullThenRingBufferIsLaunchedAn
 
     EXPECT_EQ(channelClient.getAsLocalAddress(channelClient.layout.completionStampsStart),
               channelClient.completionStamp);
+    EXPECT_LT(0U, channelClient.completionSlotsCount);
+    EXPECT_GE(channelClient.layout.completionStampsCapacity / 2, channelClient.completionSlotsCount);
 
     auto fullHeapRange = Cal::Utils::AddressRange{channelClient.getAsLocalAddress(channelClient.layout.clientHeapStart), static_cast<size_t>(channelClient.layout.clientHeapEnd - channelClient.layout.clientHeapStart)};
     EXPECT_EQ(fullHeapRange.base(), channelClient.cmdHeap.getRange().base());
@@ -1013,5 +1060,809 @@ TEST(ChannelClient, WhenBeingDestroyedThenReleasesUnderlyingShmem) {
     EXPECT_TRUE(shmemManager.allocatedShmems.empty());
 }
 
+TEST(ChannelClientCrossChannelOrdering, givenAsynchronousCallsPendingOnOtherChannelWhenSubmittingNewCallThenWaitsForThemToComplete) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+
+    Cal::Mocks::ConnectionMock connection;
+    Cal::Mocks::MockShmemManager shmemManager;
+    Cal::Usm::UsmShmemImporter usmShmemImporter{shmemManager};
+
+    Cal::Rpc::CommandsChannel::Layout defaultLayout;
+    std::vector<char> shmemA(defaultLayout.minShmemSize + 2 * Cal::Utils::pageSize4KB);
+    std::vector<char> shmemB(defaultLayout.minShmemSize + 2 * Cal::Utils::pageSize4KB);
+    size_t alignedShmemSize = defaultLayout.minShmemSize + Cal::Utils::pageSize4KB;
+
+    ChannelClientWhiteBox channelA{connection, shmemManager, usmShmemImporter};
+    ChannelClientWhiteBox channelB{connection, shmemManager, usmShmemImporter};
+    ASSERT_TRUE(channelA.partition(Cal::Utils::alignUpPow2<Cal::Utils::pageSize4KB>(shmemA.data()), alignedShmemSize, true, true));
+    ASSERT_TRUE(channelB.partition(Cal::Utils::alignUpPow2<Cal::Utils::pageSize4KB>(shmemB.data()), alignedShmemSize, true, true));
+    channelA.initCompletionSlots();
+    channelB.initCompletionSlots();
+
+    ChannelClientWhiteBox::CrossChannelOrdering ordering;
+    channelA.enableCrossChannelOrdering(ordering);
+    channelB.enableCrossChannelOrdering(ordering);
+
+    Cal::Rpc::RpcMessageHeader commandA = {};
+    Cal::Rpc::RpcMessageHeader commandB = {};
+    channelA.callAsynchronous(&commandA, false);
+    EXPECT_TRUE(channelA.lastSubmittedCallAsync);
+    ASSERT_NE(nullptr, channelA.lastAsyncCompletionStamp);
+    EXPECT_NE(channelA.completionStamp, channelA.lastAsyncCompletionStamp);
+    EXPECT_EQ(Cal::Rpc::CompletionStampNotReady, *channelA.lastAsyncCompletionStamp);
+
+    std::atomic_bool submittedB = false;
+    std::thread threadB([&]() {
+        channelB.callAsynchronous(&commandB, false);
+        submittedB = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(submittedB);
+    EXPECT_TRUE(channelB.ring.peekEmpty());
+
+    __atomic_store_n(channelA.lastAsyncCompletionStamp, Cal::Rpc::CompletionStampReady, __ATOMIC_RELEASE);
+    threadB.join();
+    EXPECT_TRUE(submittedB);
+    EXPECT_FALSE(channelB.ring.peekEmpty());
+}
+
+TEST(ChannelClientCrossChannelOrdering, givenCrossChannelOrderingEnabledThenBatchedCallsAreDisabled) {
+    Cal::Mocks::LogCaptureContext logs;
+    Cal::Mocks::ConnectionMock connection;
+    Cal::Mocks::MockShmemManager shmemManager;
+    Cal::Usm::UsmShmemImporter usmShmemImporter{shmemManager};
+    ChannelClientWhiteBox channel{connection, shmemManager, usmShmemImporter};
+    EXPECT_FALSE(channel.isCrossChannelOrderingEnabled());
+
+    channel.useBatchedCalls = true;
+    ChannelClientWhiteBox::CrossChannelOrdering ordering;
+    channel.enableCrossChannelOrdering(ordering);
+    EXPECT_TRUE(channel.isCrossChannelOrderingEnabled());
+    EXPECT_FALSE(channel.useBatchedCalls);
+}
+
+struct ChannelClientCompletionSlotsTest : public ::testing::Test {
+    void SetUp() override {
+        Cal::Rpc::CommandsChannel::Layout defaultLayout;
+        shmem.resize(defaultLayout.minShmemSize + 2 * Cal::Utils::pageSize4KB);
+        auto alignedShmem = Cal::Utils::alignUpPow2<Cal::Utils::pageSize4KB>(shmem.data());
+        size_t alignedShmemSize = defaultLayout.minShmemSize + Cal::Utils::pageSize4KB;
+
+        ASSERT_TRUE(channelClient.partition(alignedShmem, alignedShmemSize, true, false));
+        channelClient.initCompletionSlots();
+        channelClient.clientSynchronizationMethod = ChannelClientWhiteBox::ClientSynchronizationMethod::activePolling;
+        channelClient.serviceSynchronizationMethod = Cal::Messages::RespLaunchRpcShmemRingBuffer::activePolling;
+    }
+
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+    Cal::Mocks::ConnectionMock connection;
+    Cal::Mocks::MockShmemManager shmemManager;
+    Cal::Usm::UsmShmemImporter usmShmemImporter{shmemManager};
+    std::vector<char> shmem;
+    ChannelClientWhiteBox channelClient{connection, shmemManager, usmShmemImporter};
+};
+
+TEST_F(ChannelClientCompletionSlotsTest, whenAcquiringCompletionSlotsThenEachSlotIsUniqueNotReadyAndWithinSlotsTable) {
+    std::set<Cal::Rpc::CompletionStampT *> slots;
+    for (size_t i = 0; i < channelClient.completionSlotsCount; ++i) {
+        auto slot = channelClient.acquireCompletionSlot();
+        ASSERT_NE(nullptr, slot);
+        EXPECT_EQ(Cal::Rpc::CompletionStampNotReady, *slot);
+        EXPECT_LE(channelClient.completionStamp, slot);
+        EXPECT_GT(channelClient.completionStamp + channelClient.completionSlotsCount, slot);
+        EXPECT_TRUE(slots.insert(slot).second);
+    }
+
+    for (auto slot : slots) {
+        channelClient.releaseCompletionSlot(slot);
+    }
+}
+
+TEST_F(ChannelClientCompletionSlotsTest, givenAllCompletionSlotsInUseWhenAcquiringNewSlotThenWaitsUntilOneIsReleased) {
+    std::vector<Cal::Rpc::CompletionStampT *> slots;
+    for (size_t i = 0; i < channelClient.completionSlotsCount; ++i) {
+        slots.push_back(channelClient.acquireCompletionSlot());
+    }
+
+    std::atomic_bool acquired = false;
+    Cal::Rpc::CompletionStampT *newSlot = nullptr;
+    std::thread waiter([&]() {
+        newSlot = channelClient.acquireCompletionSlot();
+        acquired = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(acquired);
+
+    *slots[3] = Cal::Rpc::CompletionStampReady;
+    channelClient.releaseCompletionSlot(slots[3]);
+    waiter.join();
+    EXPECT_TRUE(acquired);
+    EXPECT_EQ(slots[3], newSlot);
+    EXPECT_EQ(Cal::Rpc::CompletionStampNotReady, *newSlot);
+}
+
+TEST_F(ChannelClientCompletionSlotsTest, givenMultipleSynchronousCallsInFlightWhenLaterCallCompletesFirstThenItsCallerDoesNotWaitForEarlierCalls) {
+    Cal::Rpc::RpcMessageHeader commandA = {};
+    Cal::Rpc::RpcMessageHeader commandB = {};
+    auto slotA = channelClient.submitSynchronous(&commandA);
+    auto slotB = channelClient.submitSynchronous(&commandB);
+    ASSERT_NE(nullptr, slotA);
+    ASSERT_NE(nullptr, slotB);
+    EXPECT_NE(slotA, slotB);
+
+    auto ringEntryA = *channelClient.ring.peekHead();
+    EXPECT_EQ(channelClient.getAsShmemOffset(slotA), ringEntryA.completionStampOffset);
+
+    __atomic_store_n(slotB, Cal::Rpc::CompletionStampReady, __ATOMIC_RELEASE);
+    EXPECT_TRUE(channelClient.waitForCompletion(slotB, commandB.flags));
+    EXPECT_EQ(Cal::Rpc::CompletionStampNotReady, *slotA);
+
+    __atomic_store_n(slotA, Cal::Rpc::CompletionStampReady, __ATOMIC_RELEASE);
+    EXPECT_TRUE(channelClient.waitForCompletion(slotA, commandA.flags));
+}
+
+TEST_F(ChannelClientCompletionSlotsTest, givenCrossChannelOrderingWhenAllocatingAsyncCompletionStampsThenTheyDoNotOverlapCompletionSlots) {
+    ChannelClientWhiteBox::CrossChannelOrdering ordering;
+    channelClient.enableCrossChannelOrdering(ordering);
+
+    auto asyncStampsCount = channelClient.layout.completionStampsCapacity - channelClient.completionSlotsCount;
+    for (size_t i = 0; i < 2 * asyncStampsCount; ++i) {
+        Cal::Rpc::RpcMessageHeader command = {};
+        channelClient.callAsynchronous(&command, false);
+        EXPECT_LE(channelClient.completionStamp + channelClient.completionSlotsCount, channelClient.lastAsyncCompletionStamp);
+        EXPECT_GT(channelClient.completionStamp + channelClient.layout.completionStampsCapacity, channelClient.lastAsyncCompletionStamp);
+        channelClient.ring.pop();
+    }
+}
+
+class ChannelServerWhiteBox : public Cal::Rpc::ChannelServer {
+  public:
+    using ChannelServer::ChannelServer;
+    using ChannelServer::serviceSynchronizationMethod;
+    using CommandsChannel::getAsLocalAddress;
+    using CommandsChannel::getRingTailFutexWord;
+    using CommandsChannel::layout;
+    using CommandsChannel::partition;
+    using CommandsChannel::ring;
+    using CommandsChannel::ringTailWaiters;
+};
+
+struct ChannelFutexSynchronizationTest : public ::testing::Test {
+    void SetUp() override {
+        Cal::Rpc::CommandsChannel::Layout defaultLayout;
+        shmem.resize(defaultLayout.minShmemSize + 2 * Cal::Utils::pageSize4KB);
+        auto alignedShmem = Cal::Utils::alignUpPow2<Cal::Utils::pageSize4KB>(shmem.data());
+        size_t alignedShmemSize = defaultLayout.minShmemSize + Cal::Utils::pageSize4KB;
+
+        ASSERT_TRUE(channelClient.partition(alignedShmem, alignedShmemSize, true, false));
+        channelClient.initCompletionSlots();
+        channelClient.clientSynchronizationMethod = ChannelClientWhiteBox::ClientSynchronizationMethod::futex;
+        channelClient.serviceSynchronizationMethod = Cal::Messages::RespLaunchRpcShmemRingBuffer::futex;
+
+        ASSERT_TRUE(channelServer.partition(alignedShmem, alignedShmemSize, channelClient.layout, false));
+        channelServer.serviceSynchronizationMethod = Cal::Messages::RespLaunchRpcShmemRingBuffer::futex;
+    }
+
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+    Cal::Mocks::ConnectionMock connection;
+    Cal::Mocks::MockShmemManager shmemManager;
+    Cal::Usm::UsmShmemImporter usmShmemImporter{shmemManager};
+    std::vector<char> shmem;
+    ChannelClientWhiteBox channelClient{connection, shmemManager, usmShmemImporter};
+    ChannelServerWhiteBox channelServer{connection, shmemManager};
+};
+
+TEST_F(ChannelFutexSynchronizationTest, givenNoSleepingServiceWhenSubmittingCommandThenFutexWakeIsNotCalled) {
+    Cal::Rpc::RpcMessageHeader command = {};
+    channelClient.callAsynchronous(&command, false);
+    EXPECT_FALSE(channelServer.ring.peekEmpty());
+    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.futex.callCount);
+}
+
+TEST_F(ChannelFutexSynchronizationTest, givenSleepingServiceWhenSubmittingCommandThenServiceIsWokenUpWithFutexOnRingTail) {
+    uint32_t *wokenUpWord = nullptr;
+    tempSysCallsCtx.apiConfig.futex.impl = [&](uint32_t *uaddr, int futexOp, uint32_t val, const struct timespec *timeout) -> long {
+        EXPECT_EQ(FUTEX_WAKE, futexOp);
+        wokenUpWord = uaddr;
+        return 0;
+    };
+    *channelServer.ringTailWaiters = 1U;
+
+    Cal::Rpc::RpcMessageHeader command = {};
+    channelClient.callAsynchronous(&command, false);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.futex.callCount);
+    EXPECT_EQ(channelServer.getRingTailFutexWord(), wokenUpWord);
+}
+
+TEST_F(ChannelFutexSynchronizationTest, givenEmptyRingWhenServiceWaitsForCommandThenItSleepsOnFutexUntilCommandIsSubmitted) {
+    std::atomic_bool commandReceived = false;
+    void *receivedCommand = nullptr;
+    std::thread service([&]() {
+        receivedCommand = channelServer.wait(false).command;
+        commandReceived = true;
+    });
+
+    while (0U == __atomic_load_n(channelServer.ringTailWaiters, __ATOMIC_SEQ_CST)) {
+        std::this_thread::yield();
+    }
+    EXPECT_FALSE(commandReceived);
+
+    Cal::Rpc::RpcMessageHeader command = {};
+    channelClient.callAsynchronous(&command, false);
+    service.join();
+    EXPECT_TRUE(commandReceived);
+    EXPECT_EQ(&command, receivedCommand);
+    EXPECT_EQ(0U, *channelServer.ringTailWaiters);
+    EXPECT_LE(2U, tempSysCallsCtx.apiConfig.futex.callCount);
+}
+
+TEST_F(ChannelFutexSynchronizationTest, givenStoppedServiceWhenWaitingForCommandThenReturnsEmptyPacket) {
+    std::thread service([&]() {
+        EXPECT_EQ(nullptr, channelServer.wait(false).command);
+    });
+    while (0U == __atomic_load_n(channelServer.ringTailWaiters, __ATOMIC_SEQ_CST)) {
+        std::this_thread::yield();
+    }
+    channelServer.stop();
+    service.join();
+}
+
+TEST_F(ChannelFutexSynchronizationTest, givenClientWaitingForCompletionThenItSleepsOnFutexAndIsWokenUpWhenServiceSignalsCompletion) {
+    Cal::Rpc::RpcMessageHeader command = {};
+    std::atomic_bool callCompleted = false;
+    std::thread client([&]() {
+        EXPECT_TRUE(channelClient.callSynchronous(&command));
+        callCompleted = true;
+    });
+
+    while (Cal::Rpc::CompletionStampNotReadyWithWaiter != __atomic_load_n(channelClient.completionStamp, __ATOMIC_SEQ_CST)) {
+        std::this_thread::yield();
+    }
+    EXPECT_FALSE(callCompleted);
+
+    auto packet = channelServer.wait(false);
+    EXPECT_EQ(&command, packet.command);
+    channelServer.signalCompletion(packet.completionStamp, command.flags);
+    client.join();
+    EXPECT_TRUE(callCompleted);
+    EXPECT_EQ(Cal::Rpc::CompletionStampReady, *channelClient.completionStamp);
+}
+
+TEST_F(ChannelFutexSynchronizationTest, givenNoClientWaitingForCompletionWhenServiceSignalsCompletionThenFutexWakeIsNotCalled) {
+    *channelClient.completionStamp = Cal::Rpc::CompletionStampNotReady;
+    channelServer.signalCompletion(channelClient.completionStamp, 0);
+    EXPECT_EQ(Cal::Rpc::CompletionStampReady, *channelClient.completionStamp);
+    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.futex.callCount);
+}
+
+struct ChannelClientCmdHeapTest : public ::testing::Test {
+    struct TestMessage {
+        Cal::Rpc::RpcMessageHeader header;
+        uint64_t sequenceNumber;
+    };
+
+    void SetUp() override {
+        Cal::Rpc::CommandsChannel::Layout defaultLayout;
+        shmem.resize(defaultLayout.minShmemSize + 2 * Cal::Utils::pageSize4KB);
+        auto alignedShmem = Cal::Utils::alignUpPow2<Cal::Utils::pageSize4KB>(shmem.data());
+        size_t alignedShmemSize = defaultLayout.minShmemSize + Cal::Utils::pageSize4KB;
+
+        ASSERT_TRUE(channelClient.partition(alignedShmem, alignedShmemSize, true, false));
+        channelClient.initCompletionSlots();
+        auto totalClientHeapSize = channelClient.layout.clientHeapEnd - channelClient.layout.clientHeapStart;
+        channelClient.cmdHeap = Cal::Allocators::CircularAllocator(Cal::Utils::AddressRange(channelClient.getAsLocalAddress(channelClient.layout.clientHeapStart), totalClientHeapSize / 4));
+        channelClient.clientSynchronizationMethod = ChannelClientWhiteBox::ClientSynchronizationMethod::activePolling;
+        channelClient.serviceSynchronizationMethod = Cal::Messages::RespLaunchRpcShmemRingBuffer::activePolling;
+
+        ASSERT_TRUE(channelServer.partition(alignedShmem, alignedShmemSize, channelClient.layout, false));
+        channelServer.serviceSynchronizationMethod = Cal::Messages::RespLaunchRpcShmemRingBuffer::activePolling;
+    }
+
+    void submitMessage(size_t dynamicSize) {
+        auto space = channelClient.getCmdSpace<TestMessage>(dynamicSize);
+        ASSERT_NE(nullptr, space);
+        auto message = new (space) TestMessage{};
+        message->sequenceNumber = submittedCount++;
+        channelClient.callAsynchronous(&message->header, false);
+    }
+
+    // emulates service - processes pending commands in order
+    void processPendingMessages(uint64_t maxProcessedCount = std::numeric_limits<uint64_t>::max()) {
+        while ((processedCount < maxProcessedCount) && (false == channelServer.ring.peekEmpty())) {
+            auto packet = channelServer.wait(false);
+            auto message = reinterpret_cast<TestMessage *>(packet.command);
+            EXPECT_EQ(processedCount, message->sequenceNumber);
+            ++processedCount;
+            ASSERT_NE(nullptr, packet.completionStamp);
+            channelServer.signalCompletion(packet.completionStamp, message->header.flags);
+        }
+    }
+
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+    Cal::Mocks::ConnectionMock connection;
+    Cal::Mocks::MockShmemManager shmemManager;
+    Cal::Usm::UsmShmemImporter usmShmemImporter{shmemManager};
+    std::vector<char> shmem;
+    ChannelClientWhiteBox channelClient{connection, shmemManager, usmShmemImporter};
+    ChannelServerWhiteBox channelServer{connection, shmemManager};
+    uint64_t submittedCount = 0U;
+    uint64_t processedCount = 0U;
+};
+
+TEST_F(ChannelClientCmdHeapTest, givenMillionsOfAsynchronousCallsWithoutSynchronizationThenCommandsHeapIsReclaimedAndNeverOverflows) {
+    // service gets notified about every command, but processes them in bulks
+    channelClient.serviceSynchronizationMethod = Cal::Messages::RespLaunchRpcShmemRingBuffer::semaphores;
+    auto ringCapacity = channelClient.ring.getCapacity();
+    auto heapSize = channelClient.cmdHeap.getRange().size();
+    constexpr size_t maxDynamicSize = 192U;
+    constexpr size_t maxMessageSize = sizeof(TestMessage) + maxDynamicSize + Cal::Utils::defaultAlignmentSize;
+    tempSysCallsCtx.apiConfig.sem_post.impl = [&](sem_t *sem) -> int {
+        auto pendingCount = submittedCount - processedCount;
+        if ((pendingCount >= ringCapacity / 2) || (channelClient.cmdHeap.getSizeUsed() + 2 * maxMessageSize > heapSize)) {
+            processPendingMessages();
+        }
+        return 0;
+    };
+
+    constexpr uint64_t messagesCount = 4'000'000U;
+    while (submittedCount < messagesCount) {
+        submitMessage((submittedCount * 8) % maxDynamicSize);
+        if (::testing::Test::HasFatalFailure()) {
+            return;
+        }
+    }
+    processPendingMessages();
+
+    EXPECT_EQ(messagesCount, processedCount);
+    EXPECT_GT(channelClient.cmdHeap.getAllocationsEnd(), 1000 * channelClient.cmdHeap.getRange().size());
+    channelClient.reclaimCmdHeap(false);
+    EXPECT_EQ(0U, channelClient.cmdHeap.getSizeUsed());
+    EXPECT_TRUE(channelClient.cmdHeapPendingReclaims.empty());
+}
+
+TEST_F(ChannelClientCmdHeapTest, givenCommandsHeapFullOfPendingAsynchronousCallsWhenAllocatingThenWaitsForServiceToCompleteOldestCall) {
+    auto ringCapacity = channelClient.ring.getCapacity();
+    auto heapSize = channelClient.cmdHeap.getRange().size();
+    size_t dynamicSize = Cal::Utils::alignUp(heapSize / (ringCapacity / 2), Cal::Utils::defaultAlignmentSize);
+    while (channelClient.cmdHeap.getSizeUsed() + 2 * (sizeof(TestMessage) + dynamicSize) <= heapSize) {
+        submitMessage(dynamicSize);
+    }
+    submitMessage(dynamicSize);
+    auto pendingBeforeWait = submittedCount;
+
+    std::thread service([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        processPendingMessages(pendingBeforeWait);
+    });
+    submitMessage(dynamicSize);
+    service.join();
+    EXPECT_EQ(pendingBeforeWait + 1, submittedCount);
+    EXPECT_EQ(pendingBeforeWait, processedCount);
+}
+
+TEST_F(ChannelClientCmdHeapTest, givenSynchronousCallWhenItCompletesThenWholeCommandsHeapIsReclaimed) {
+    for (int i = 0; i < 10; ++i) {
+        submitMessage(64);
+    }
+    EXPECT_NE(0U, channelClient.cmdHeap.getSizeUsed());
+
+    auto space = channelClient.getCmdSpace<TestMessage>(0);
+    auto syncMessage = new (space) TestMessage{};
+    syncMessage->sequenceNumber = submittedCount++;
+    std::thread service([&]() {
+        while (processedCount < submittedCount) {
+            processPendingMessages(submittedCount);
+            std::this_thread::yield();
+        }
+    });
+    EXPECT_TRUE(channelClient.callSynchronous(&syncMessage->header));
+    service.join();
+    EXPECT_EQ(0U, channelClient.cmdHeap.getSizeUsed());
+    EXPECT_TRUE(channelClient.cmdHeapPendingReclaims.empty());
+}
+
+TEST_F(ChannelClientCmdHeapTest, givenCommandLargerThanCommandsHeapThenAllocationFailsAndThereIsNothingToReclaim) {
+    EXPECT_EQ(nullptr, channelClient.cmdHeap.allocate(channelClient.cmdHeap.getRange().size() + 1, 8));
+    EXPECT_FALSE(channelClient.reclaimCmdHeap(true));
+}
+
+struct ChannelClientBatchedCallsTest : public ChannelClientCmdHeapTest {
+    template <bool isBatchable>
+    struct TestMessageT : TestMessage {
+        static constexpr bool batchable = isBatchable;
+    };
+
+    void SetUp() override {
+        ChannelClientCmdHeapTest::SetUp();
+        channelClient.serviceSynchronizationMethod = Cal::Messages::RespLaunchRpcShmemRingBuffer::semaphores;
+        channelClient.useBatchedCalls = true;
+        tempSysCallsCtx.apiConfig.sem_post.returnValue = 0;
+    }
+
+    void submitBatchedMessage() {
+        auto space = channelClient.getCmdSpace<TestMessage>(0);
+        ASSERT_NE(nullptr, space);
+        auto message = new (space) TestMessage{};
+        message->sequenceNumber = submittedCount++;
+        channelClient.callAsynchronous(&message->header, true);
+    }
+};
+
+TEST_F(ChannelClientBatchedCallsTest, givenBatchedCallsWhenMaxCallsCountIsReachedThenWholeBatchIsPublishedWithSingleNotification) {
+    channelClient.maxBatchedCallsCount = 4;
+    channelClient.maxBatchAge = std::chrono::hours(1);
+    for (int i = 0; i < 3; ++i) {
+        submitBatchedMessage();
+    }
+    EXPECT_TRUE(channelServer.ring.peekEmpty());
+    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.sem_post.callCount);
+
+    submitBatchedMessage();
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.sem_post.callCount);
+    processPendingMessages();
+    EXPECT_EQ(4U, processedCount);
+    EXPECT_EQ(0U, channelClient.ring.getBatchedCount());
+}
+
+TEST_F(ChannelClientBatchedCallsTest, givenBatchedCallsWhenBatchIsOlderThanMaxAgeThenItIsPublishedWhenNextCallIsAdded) {
+    channelClient.maxBatchedCallsCount = 100;
+    channelClient.maxBatchAge = std::chrono::milliseconds(1);
+    submitBatchedMessage();
+    EXPECT_TRUE(channelServer.ring.peekEmpty());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    submitBatchedMessage();
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.sem_post.callCount);
+    processPendingMessages();
+    EXPECT_EQ(2U, processedCount);
+}
+
+TEST_F(ChannelClientBatchedCallsTest, givenBatchedCallsWhenSubmittingSynchronousCallThenBatchIsPublishedBeforeIt) {
+    channelClient.maxBatchedCallsCount = 100;
+    channelClient.maxBatchAge = std::chrono::hours(1);
+    submitBatchedMessage();
+    submitBatchedMessage();
+    EXPECT_TRUE(channelServer.ring.peekEmpty());
+
+    auto space = channelClient.getCmdSpace<TestMessage>(0);
+    auto syncMessage = new (space) TestMessage{};
+    syncMessage->sequenceNumber = submittedCount++;
+    std::thread service([&]() {
+        while (processedCount < submittedCount) {
+            processPendingMessages(submittedCount);
+            std::this_thread::yield();
+        }
+    });
+    EXPECT_TRUE(channelClient.callSynchronous(&syncMessage->header));
+    service.join();
+    EXPECT_EQ(3U, processedCount);
+}
+
+TEST_F(ChannelClientBatchedCallsTest, givenBatchedCallsWhenFlushingExplicitlyThenBatchIsPublishedAndEmptyBatchIsNotFlushedAgain) {
+    channelClient.maxBatchedCallsCount = 100;
+    channelClient.maxBatchAge = std::chrono::hours(1);
+    submitBatchedMessage();
+    channelClient.flushBatchedCalls();
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.sem_post.callCount);
+    channelClient.flushBatchedCalls();
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.sem_post.callCount);
+    processPendingMessages();
+    EXPECT_EQ(1U, processedCount);
+}
+
+TEST_F(ChannelClientBatchedCallsTest, whenCallingAsynchronouslyThenOnlyBatchableMessagesAreBatched) {
+    channelClient.maxBatchedCallsCount = 100;
+    channelClient.maxBatchAge = std::chrono::hours(1);
+
+    auto batchable = new (channelClient.getCmdSpace<TestMessageT<true>>(0)) TestMessageT<true>{};
+    batchable->sequenceNumber = submittedCount++;
+    channelClient.callAsynchronous(batchable);
+    EXPECT_NE(0, batchable->header.flags & Cal::Rpc::RpcMessageHeader::batched);
+    EXPECT_TRUE(channelServer.ring.peekEmpty());
+
+    auto nonBatchable = new (channelClient.getCmdSpace<TestMessageT<false>>(0)) TestMessageT<false>{};
+    nonBatchable->sequenceNumber = submittedCount++;
+    channelClient.callAsynchronous(nonBatchable);
+    EXPECT_EQ(0, nonBatchable->header.flags & Cal::Rpc::RpcMessageHeader::batched);
+    processPendingMessages();
+    EXPECT_EQ(2U, processedCount);
+
+    channelClient.useBatchedCalls = false;
+    auto batchingDisabled = new (channelClient.getCmdSpace<TestMessageT<true>>(0)) TestMessageT<true>{};
+    batchingDisabled->sequenceNumber = submittedCount++;
+    channelClient.callAsynchronous(batchingDisabled);
+    EXPECT_EQ(0, batchingDisabled->header.flags & Cal::Rpc::RpcMessageHeader::batched);
+    processPendingMessages();
+    EXPECT_EQ(3U, processedCount);
+}
+
+using ChannelStatsTest = ChannelClientCmdHeapTest;
+
+TEST_F(ChannelStatsTest, givenStatsPageWhenCallingSynchronouslyThenClientWaitIsRecordedForThisCall) {
+    auto stats = std::make_unique<Cal::Stats::StatsPage>();
+    channelClient.setStats(stats.get());
+
+    auto space = channelClient.getCmdSpace<TestMessage>(0);
+    auto syncMessage = new (space) TestMessage{};
+    syncMessage->header.type = Cal::Rpc::RpcMessageHeader::messageTypeRpcOcl;
+    syncMessage->header.subtype = 3;
+    syncMessage->sequenceNumber = submittedCount++;
+    std::thread service([&]() {
+        while (processedCount < submittedCount) {
+            processPendingMessages(submittedCount);
+            std::this_thread::yield();
+        }
+    });
+    EXPECT_TRUE(channelClient.callSynchronous(&syncMessage->header));
+    service.join();
+
+    EXPECT_EQ(1U, stats->clientWaits[Cal::Rpc::RpcMessageHeader::messageTypeRpcOcl][3].count.load());
+    EXPECT_EQ(0U, stats->serviced[Cal::Rpc::RpcMessageHeader::messageTypeRpcOcl][3].count.load());
+}
+
+TEST_F(ChannelStatsTest, givenHostptrCopiesPushedToClientWhenAcquiringBytesCountThenReturnsBytesPushedSinceLastQuery) {
+    EXPECT_EQ(0U, channelServer.acquireHostptrCopiesBytesCount());
+
+    Cal::Rpc::TransferDesc transfer;
+    transfer.bytesCountToCopy = 64U;
+    EXPECT_TRUE(channelServer.pushHostptrCopyToUpdate(transfer));
+    transfer.bytesCountToCopy = 4096U;
+    EXPECT_TRUE(channelServer.pushHostptrCopyToUpdate(transfer));
+    EXPECT_EQ(4160U, channelServer.acquireHostptrCopiesBytesCount());
+    EXPECT_EQ(0U, channelServer.acquireHostptrCopiesBytesCount());
+}
+
+class ChannelClientPoolWhiteBox : public Cal::Rpc::ChannelClientPool {
+  public:
+    using ChannelClientPool::ChannelClientPool;
+    using ChannelClientPool::channels;
+    using ChannelClientPool::clientSynchronizationMethod;
+    using ChannelClientPool::maxChannelsCount;
+    using ChannelClientPool::usesSharedVaForRpcChannel;
+
+    std::unique_ptr<Cal::Rpc::ChannelClient> createChannel() override {
+        ++createChannelCallsCount;
+        if (failChannelCreation) {
+            return nullptr;
+        }
+        auto channel = std::make_unique<ChannelClientWhiteBox>(connection, globalShmemImporter, sharedVaShmemImporter);
+        if (maxChannelsCount > 1U) {
+            channel->enableCrossChannelOrdering(crossChannelOrdering);
+        }
+        return channel;
+    }
+
+    bool failChannelCreation = false;
+    int createChannelCallsCount = 0;
+};
+
+TEST(ChannelClientPoolInit, whenInitializingThenCreatesOnlyPrimaryChannel) {
+    Cal::Mocks::LogCaptureContext logs;
+    Cal::Mocks::ConnectionMock connection;
+    Cal::Mocks::MockShmemManager shmemManager;
+    Cal::Usm::UsmShmemImporter usmShmemImporter{shmemManager};
+    ChannelClientPoolWhiteBox pool{connection, shmemManager, usmShmemImporter, 4};
+    EXPECT_TRUE(pool.init(Cal::Rpc::ChannelClient::semaphores, true));
+    EXPECT_EQ(1, pool.createChannelCallsCount);
+    EXPECT_EQ(1U, pool.getChannelsCount());
+    EXPECT_EQ(4U, pool.getMaxChannelsCount());
+    EXPECT_EQ(Cal::Rpc::ChannelClient::semaphores, pool.clientSynchronizationMethod);
+    EXPECT_TRUE(pool.usesSharedVaForRpcChannel);
+    EXPECT_EQ(pool.channels[0].get(), &pool.getPrimaryChannel());
+}
+
+TEST(ChannelClientPoolInit, whenFailedToCreatePrimaryChannelThenFailsAndEmitsError) {
+    Cal::Mocks::LogCaptureContext logs;
+    Cal::Mocks::ConnectionMock connection;
+    Cal::Mocks::MockShmemManager shmemManager;
+    Cal::Usm::UsmShmemImporter usmShmemImporter{shmemManager};
+    ChannelClientPoolWhiteBox pool{connection, shmemManager, usmShmemImporter, 4};
+    pool.failChannelCreation = true;
+    EXPECT_FALSE(pool.init(Cal::Rpc::ChannelClient::semaphores, true));
+    EXPECT_FALSE(logs.empty());
+    EXPECT_EQ(0U, pool.getChannelsCount());
+}
+
+TEST(ChannelClientPool, givenZeroMaxChannelsCountThenUsesSingleChannel) {
+    Cal::Mocks::LogCaptureContext logs;
+    Cal::Mocks::ConnectionMock connection;
+    Cal::Mocks::MockShmemManager shmemManager;
+    Cal::Usm::UsmShmemImporter usmShmemImporter{shmemManager};
+    ChannelClientPoolWhiteBox pool{connection, shmemManager, usmShmemImporter, 0};
+    EXPECT_EQ(1U, pool.getMaxChannelsCount());
+}
+
+TEST(ChannelClientPool, givenSingleChannelPoolThenAllThreadsUsePrimaryChannelWithoutCrossChannelOrdering) {
+    Cal::Mocks::LogCaptureContext logs;
+    Cal::Mocks::ConnectionMock connection;
+    Cal::Mocks::MockShmemManager shmemManager;
+    Cal::Usm::UsmShmemImporter usmShmemImporter{shmemManager};
+    ChannelClientPoolWhiteBox pool{connection, shmemManager, usmShmemImporter, 1};
+    ASSERT_TRUE(pool.init(Cal::Rpc::ChannelClient::semaphores, false));
+
+    Cal::Rpc::ChannelClient *otherThreadChannel = nullptr;
+    std::thread([&]() { otherThreadChannel = &pool.getChannelForThisThread(); }).join();
+    EXPECT_EQ(&pool.getPrimaryChannel(), &pool.getChannelForThisThread());
+    EXPECT_EQ(&pool.getPrimaryChannel(), otherThreadChannel);
+    EXPECT_EQ(1U, pool.getChannelsCount());
+    EXPECT_FALSE(pool.getPrimaryChannel().isCrossChannelOrderingEnabled());
+}
+
+TEST(ChannelClientPool, givenMultipleChannelsPoolThenEachNewThreadIsBoundToNewChannelUntilLimitIsReachedAndThenChannelsAreShared) {
+    Cal::Mocks::LogCaptureContext logs;
+    Cal::Mocks::ConnectionMock connection;
+    Cal::Mocks::MockShmemManager shmemManager;
+    Cal::Usm::UsmShmemImporter usmShmemImporter{shmemManager};
+    ChannelClientPoolWhiteBox pool{connection, shmemManager, usmShmemImporter, 3};
+    ASSERT_TRUE(pool.init(Cal::Rpc::ChannelClient::semaphores, false));
+
+    auto &mainThreadChannel = pool.getChannelForThisThread();
+    EXPECT_EQ(&mainThreadChannel, &pool.getChannelForThisThread());
+    EXPECT_NE(&pool.getPrimaryChannel(), &mainThreadChannel);
+    EXPECT_EQ(2U, pool.getChannelsCount());
+
+    std::vector<Cal::Rpc::ChannelClient *> otherThreadsChannels;
+    for (int i = 0; i < 3; ++i) {
+        std::thread([&]() {
+            auto &channel = pool.getChannelForThisThread();
+            EXPECT_EQ(&channel, &pool.getChannelForThisThread());
+            otherThreadsChannels.push_back(&channel);
+        }).join();
+    }
+    EXPECT_EQ(3U, pool.getChannelsCount());
+    EXPECT_EQ(3, pool.createChannelCallsCount);
+    EXPECT_EQ(pool.channels[2].get(), otherThreadsChannels[0]);
+    EXPECT_EQ(pool.channels[0].get(), otherThreadsChannels[1]);
+    EXPECT_EQ(pool.channels[1].get(), otherThreadsChannels[2]);
+
+    for (auto &channel : pool.channels) {
+        EXPECT_TRUE(channel->isCrossChannelOrderingEnabled());
+    }
+}
+
+TEST(ChannelClientPool, whenFailedToCreateAdditionalChannelThenThreadIsBoundToExistingChannelAndPoolIsLimited) {
+    Cal::Mocks::LogCaptureContext logs;
+    Cal::Mocks::ConnectionMock connection;
+    Cal::Mocks::MockShmemManager shmemManager;
+    Cal::Usm::UsmShmemImporter usmShmemImporter{shmemManager};
+    ChannelClientPoolWhiteBox pool{connection, shmemManager, usmShmemImporter, 3};
+    ASSERT_TRUE(pool.init(Cal::Rpc::ChannelClient::semaphores, false));
+
+    pool.failChannelCreation = true;
+    EXPECT_EQ(&pool.getPrimaryChannel(), &pool.getChannelForThisThread());
+    EXPECT_FALSE(logs.empty());
+    EXPECT_EQ(1U, pool.maxChannelsCount);
+
+    std::thread([&]() { EXPECT_EQ(&pool.getPrimaryChannel(), &pool.getChannelForThisThread()); }).join();
+    EXPECT_EQ(2, pool.createChannelCallsCount);
+}
+
+TEST(ChannelClientPool, givenThreadBoundToDestroyedPoolWhenUsingNewPoolThenThreadIsBoundAgain) {
+    Cal::Mocks::LogCaptureContext logs;
+    Cal::Mocks::ConnectionMock connection;
+    Cal::Mocks::MockShmemManager shmemManager;
+    Cal::Usm::UsmShmemImporter usmShmemImporter{shmemManager};
+    {
+        ChannelClientPoolWhiteBox pool{connection, shmemManager, usmShmemImporter, 2};
+        ASSERT_TRUE(pool.init(Cal::Rpc::ChannelClient::semaphores, false));
+        pool.getChannelForThisThread();
+    }
+
+    ChannelClientPoolWhiteBox pool{connection, shmemManager, usmShmemImporter, 2};
+    ASSERT_TRUE(pool.init(Cal::Rpc::ChannelClient::semaphores, false));
+    auto &channel = pool.getChannelForThisThread();
+    EXPECT_EQ(pool.channels[1].get(), &channel);
+}
+
+struct RpcChannelsWorkersPoolTest : public ChannelClientCmdHeapTest {
+    Cal::Service::RpcChannelsWorkersPool::ServiceCommandFuncT createInOrderProcessor() {
+        return [this](Cal::Rpc::ChannelServer::CommandPacket &packet) {
+            auto message = reinterpret_cast<TestMessage *>(packet.command);
+            if (message->sequenceNumber != processedCount) {
+                outOfOrder = true;
+            }
+            channelServer.signalCompletion(packet.completionStamp, message->header.flags);
+            ++processedCount;
+            return false;
+        };
+    }
+
+    bool waitForProcessedCount(uint64_t expected) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (processedCount.load() < expected) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    std::atomic_uint64_t processedCount = 0U;
+    std::atomic_bool outOfOrder = false;
+};
+
+TEST_F(RpcChannelsWorkersPoolTest, givenMultipleWorkersThenCommandsOfChannelAreServicedExactlyOnceAndInOrder) {
+    Cal::Service::RpcChannelsWorkersPool pool{4, {}};
+    auto released = pool.add(&channelServer, createInOrderProcessor());
+
+    auto commandsCount = channelClient.ring.getCapacity() / 2;
+    for (size_t i = 0; i < commandsCount; ++i) {
+        submitMessage(0);
+    }
+
+    EXPECT_TRUE(waitForProcessedCount(commandsCount));
+    EXPECT_FALSE(outOfOrder);
+    EXPECT_EQ(commandsCount, processedCount.load());
+
+    channelServer.stop();
+    EXPECT_EQ(std::future_status::ready, released.wait_for(std::chrono::seconds(30)));
+}
+
+TEST_F(RpcChannelsWorkersPoolTest, givenStoppedChannelThenWorkersReleaseItAndStopServicingIt) {
+    Cal::Service::RpcChannelsWorkersPool pool{2, {}};
+    auto released = pool.add(&channelServer, createInOrderProcessor());
+    EXPECT_EQ(1U, pool.getChannelsCount());
+
+    channelServer.stop();
+    EXPECT_EQ(std::future_status::ready, released.wait_for(std::chrono::seconds(30)));
+    EXPECT_EQ(0U, pool.getChannelsCount());
+
+    submitMessage(0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(0U, processedCount.load());
+}
+
+TEST_F(RpcChannelsWorkersPoolTest, givenWorkerThatMustStayWithChannelThenItKeepsServicingItUntilReleased) {
+    Cal::Service::RpcChannelsWorkersPool pool{3, {}};
+    auto commandsCount = Cal::Service::RpcChannelsWorkersPool::maxCommandsPerOwnership * 2;
+    std::atomic<std::thread::id> batchOwner{};
+    std::atomic_bool batchServicedByMultipleThreads = false;
+    auto released = pool.add(&channelServer, [&](Cal::Rpc::ChannelServer::CommandPacket &packet) {
+        auto message = reinterpret_cast<TestMessage *>(packet.command);
+        bool inBatch = (message->sequenceNumber + 1 < commandsCount);
+        if (message->sequenceNumber > 0) {
+            batchServicedByMultipleThreads = batchServicedByMultipleThreads || (batchOwner.load() != std::this_thread::get_id());
+        }
+        batchOwner = std::this_thread::get_id();
+        channelServer.signalCompletion(packet.completionStamp, message->header.flags);
+        ++processedCount;
+        return inBatch;
+    });
+
+    for (size_t i = 0; i < commandsCount; ++i) {
+        submitMessage(0);
+        std::this_thread::yield();
+    }
+
+    EXPECT_TRUE(waitForProcessedCount(commandsCount));
+    EXPECT_FALSE(batchServicedByMultipleThreads);
+
+    channelServer.stop();
+    EXPECT_EQ(std::future_status::ready, released.wait_for(std::chrono::seconds(30)));
+}
+
+TEST(RpcChannelsWorkersPoolCpuList, givenValidCpuListThenAllCpusAreReturned) {
+    auto cpus = Cal::Service::RpcChannelsWorkersPool::parseCpuList("0,2,4-6");
+    ASSERT_TRUE(cpus.has_value());
+    EXPECT_EQ((std::vector<int>{0, 2, 4, 5, 6}), cpus.value());
+
+    cpus = Cal::Service::RpcChannelsWorkersPool::parseCpuList(nullptr);
+    ASSERT_TRUE(cpus.has_value());
+    EXPECT_TRUE(cpus->empty());
+}
+
+TEST(RpcChannelsWorkersPoolCpuList, givenMalformedCpuListThenNulloptIsReturned) {
+    EXPECT_FALSE(Cal::Service::RpcChannelsWorkersPool::parseCpuList("a").has_value());
+    EXPECT_FALSE(Cal::Service::RpcChannelsWorkersPool::parseCpuList("3-1").has_value());
+    EXPECT_FALSE(Cal::Service::RpcChannelsWorkersPool::parseCpuList("1-2-3").has_value());
+    EXPECT_FALSE(Cal::Service::RpcChannelsWorkersPool::parseCpuList("-1").has_value());
+}
+
 } // namespace Ult
 } // namespace Cal
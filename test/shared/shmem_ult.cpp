@@ -15,8 +15,12 @@
 
 #include <chrono>
 #include <future>
+#include <memory>
+#include <mutex>
 #include <pthread.h>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace Cal {
 
@@ -818,6 +822,110 @@ TEST(ShmemAllocatorFree, whenDoesNotOwnFdThenDoesNotCloseIt) {
     EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.close.callCount);
 }
 
+class ShmemImporterMappingsCacheTest : public ::testing::Test {
+  protected:
+    struct MockShmemImporter : Cal::Ipc::ShmemImporter {
+        using ShmemImporter::mappingsCacheMaxSize;
+    };
+
+    void SetUp() override {
+        tempSysCallsCtx.apiConfig.shm_open.returnValue = 3;
+        tempSysCallsCtx.apiConfig.close.returnValue = 0;
+        tempSysCallsCtx.apiConfig.munmap.impl = [this](void *addr, size_t) {
+            unmapped.push_back(addr);
+            return 0;
+        };
+        importer = std::make_unique<MockShmemImporter>();
+        importer->mappingsCacheMaxSize = 2 * Cal::Utils::pageSize4KB;
+    }
+
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+    std::vector<void *> unmapped;
+    std::unique_ptr<MockShmemImporter> importer;
+};
+
+TEST_F(ShmemImporterMappingsCacheTest, whenSameShmemIsOpenedAgainThenCachedMappingIsReused) {
+    auto first = importer->openCached(1, Cal::Utils::pageSize4KB);
+    ASSERT_TRUE(first.isValid());
+    importer->releaseCached(first);
+    auto second = importer->openCached(1, Cal::Utils::pageSize4KB);
+    ASSERT_TRUE(second.isValid());
+    EXPECT_EQ(first.getMmappedPtr(), second.getMmappedPtr());
+    importer->releaseCached(second);
+
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.shm_open.callCount);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.mmap.callCount);
+    EXPECT_TRUE(unmapped.empty());
+    EXPECT_EQ(Cal::Utils::pageSize4KB, importer->getMappingsCacheSize());
+
+    importer.reset();
+    ASSERT_EQ(1U, unmapped.size());
+    EXPECT_EQ(first.getMmappedPtr(), unmapped[0]);
+}
+
+TEST_F(ShmemImporterMappingsCacheTest, whenCacheExceedsItsLimitThenLeastRecentlyUsedMappingIsUnmapped) {
+    auto shmem1 = importer->openCached(1, Cal::Utils::pageSize4KB);
+    importer->releaseCached(shmem1);
+    auto shmem2 = importer->openCached(2, Cal::Utils::pageSize4KB);
+    importer->releaseCached(shmem2);
+    importer->releaseCached(importer->openCached(1, Cal::Utils::pageSize4KB));
+    EXPECT_TRUE(unmapped.empty());
+
+    auto shmem3 = importer->openCached(3, Cal::Utils::pageSize4KB);
+    importer->releaseCached(shmem3);
+    ASSERT_EQ(1U, unmapped.size());
+    EXPECT_EQ(shmem2.getMmappedPtr(), unmapped[0]);
+    EXPECT_EQ(2 * Cal::Utils::pageSize4KB, importer->getMappingsCacheSize());
+    EXPECT_EQ(3U, tempSysCallsCtx.apiConfig.mmap.callCount);
+    EXPECT_TRUE(logs.empty()) << logs.str();
+}
+
+TEST_F(ShmemImporterMappingsCacheTest, whenMappingIsInUseThenItIsNotEvicted) {
+    importer->mappingsCacheMaxSize = Cal::Utils::pageSize4KB;
+    auto shmem1 = importer->openCached(1, Cal::Utils::pageSize4KB);
+    auto shmem2 = importer->openCached(2, Cal::Utils::pageSize4KB);
+    EXPECT_TRUE(unmapped.empty());
+    EXPECT_EQ(2 * Cal::Utils::pageSize4KB, importer->getMappingsCacheSize());
+
+    importer->releaseCached(shmem1);
+    ASSERT_EQ(1U, unmapped.size());
+    EXPECT_EQ(shmem1.getMmappedPtr(), unmapped[0]);
+
+    importer->releaseCached(shmem2);
+    EXPECT_EQ(1U, unmapped.size());
+    EXPECT_EQ(Cal::Utils::pageSize4KB, importer->getMappingsCacheSize());
+}
+
+TEST_F(ShmemImporterMappingsCacheTest, givenCachedMappingInUseWhenShmemIsOpenedWithDifferentSizeThenNewMappingIsNotCached) {
+    auto small = importer->openCached(1, Cal::Utils::pageSize4KB);
+    auto large = importer->openCached(1, 2 * Cal::Utils::pageSize4KB);
+    ASSERT_TRUE(large.isValid());
+    EXPECT_NE(small.getMmappedPtr(), large.getMmappedPtr());
+    EXPECT_EQ(2 * Cal::Utils::pageSize4KB, large.getMmappedSize());
+
+    importer->releaseCached(large);
+    ASSERT_EQ(1U, unmapped.size());
+    EXPECT_EQ(large.getMmappedPtr(), unmapped[0]);
+
+    importer->releaseCached(small);
+    EXPECT_EQ(1U, unmapped.size());
+    EXPECT_EQ(Cal::Utils::pageSize4KB, importer->getMappingsCacheSize());
+}
+
+TEST_F(ShmemImporterMappingsCacheTest, givenCacheDisabledThenEveryTransferMapsAndUnmapsShmem) {
+    importer->mappingsCacheMaxSize = 0U;
+    for (int i = 0; i < 2; ++i) {
+        auto shmem = importer->openCached(1, Cal::Utils::pageSize4KB);
+        ASSERT_TRUE(shmem.isValid());
+        importer->releaseCached(shmem);
+    }
+
+    EXPECT_EQ(2U, tempSysCallsCtx.apiConfig.mmap.callCount);
+    EXPECT_EQ(2U, unmapped.size());
+    EXPECT_EQ(0U, importer->getMappingsCacheSize());
+}
+
 TEST(ShmemAllocatorFree, whenDoesNotOwnShmemThenDoesNotUnlinksShmemPath) {
     Cal::Mocks::SysCallsContext tempSysCallsCtx;
 
@@ -832,6 +940,365 @@ TEST(ShmemAllocatorFree, whenDoesNotOwnShmemThenDoesNotUnlinksShmemPath) {
     EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.shm_unlink.callCount);
 }
 
+template <typename ConditionT>
+bool waitFor(ConditionT condition) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (false == condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+TEST(ShmemAllocatorPool, givenPoolEnabledWhenPooledSizeIsAllocatedThenSpareFilesAreCreatedAndPrefaultedInBackground) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+
+    Cal::Ipc::ShmemAllocator::PoolConfig poolConfig;
+    poolConfig.highWatermark = 2U;
+    poolConfig.lowWatermark = 1U;
+    poolConfig.prefault = true;
+    Cal::Ipc::ShmemAllocator allocator("/test_base_path", poolConfig);
+    auto size = Cal::Ipc::ShmemAllocator::minPooledSize;
+
+    auto first = allocator.allocate(size);
+    EXPECT_TRUE(first.isValid());
+    ASSERT_TRUE(waitFor([&]() { return 2U == allocator.getSparePooledFilesCount(size); }));
+    EXPECT_EQ(3U, tempSysCallsCtx.apiConfig.shm_open.callCount);
+    EXPECT_EQ(2U, tempSysCallsCtx.apiConfig.mmap.callCount);
+    EXPECT_EQ(2U, tempSysCallsCtx.apiConfig.munmap.callCount);
+
+    auto second = allocator.allocate(size);
+    EXPECT_TRUE(second.isValid());
+    EXPECT_NE(first.getShmemId(), second.getShmemId());
+    EXPECT_EQ(size, second.getFileSize());
+    EXPECT_EQ(3U, tempSysCallsCtx.apiConfig.shm_open.callCount);
+    EXPECT_EQ(1U, allocator.getSparePooledFilesCount(size));
+
+    allocator.free(first);
+    allocator.free(second);
+    EXPECT_TRUE(logs.empty()) << logs.str();
+}
+
+TEST(ShmemAllocatorPool, givenPoolEnabledWhenPooledFileIsFreedThenItIsScrubbedAndReused) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+
+    Cal::Ipc::ShmemAllocator::PoolConfig poolConfig;
+    poolConfig.highWatermark = 1U;
+    poolConfig.lowWatermark = 0U;
+    poolConfig.prefault = false;
+    std::vector<off_t> truncations;
+    std::mutex truncationsMutex;
+    tempSysCallsCtx.apiConfig.ftruncate.impl = [&](int fd, off_t length) -> int {
+        std::lock_guard<std::mutex> lock(truncationsMutex);
+        truncations.push_back(length);
+        return 0;
+    };
+    Cal::Ipc::ShmemAllocator allocator("/test_base_path", poolConfig);
+    auto size = 2 * Cal::Ipc::ShmemAllocator::minPooledSize;
+
+    auto shmem = allocator.allocate(size);
+    ASSERT_TRUE(shmem.isValid());
+    allocator.free(shmem);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.shm_unlink.callCount);
+    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.close.callCount);
+    ASSERT_TRUE(waitFor([&]() { return 1U == allocator.getSparePooledFilesCount(size); }));
+    {
+        std::lock_guard<std::mutex> lock(truncationsMutex);
+        EXPECT_EQ((std::vector<off_t>{static_cast<off_t>(size), 0, static_cast<off_t>(size)}), truncations);
+    }
+
+    auto reused = allocator.allocate(size);
+    ASSERT_TRUE(reused.isValid());
+    EXPECT_EQ(shmem.getShmemId(), reused.getShmemId());
+    EXPECT_EQ(shmem.getFd(), reused.getFd());
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.shm_open.callCount);
+    EXPECT_EQ(0U, allocator.getSparePooledFilesCount(size));
+    allocator.free(reused);
+    EXPECT_TRUE(logs.empty()) << logs.str();
+}
+
+TEST(ShmemAllocatorPool, givenPoolEnabledWhenFreedFileWasUnlinkedByClientThenItIsDestroyed) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+
+    Cal::Ipc::ShmemAllocator::PoolConfig poolConfig;
+    poolConfig.highWatermark = 1U;
+    poolConfig.lowWatermark = 0U;
+    Cal::Ipc::ShmemAllocator allocator("/test_base_path", poolConfig);
+    auto size = Cal::Ipc::ShmemAllocator::minPooledSize;
+
+    tempSysCallsCtx.apiConfig.fstat.impl = [](int fd, struct stat *buf) -> int {
+        *buf = {};
+        buf->st_nlink = 0;
+        return 0;
+    };
+    auto shmem = allocator.allocate(size);
+    ASSERT_TRUE(shmem.isValid());
+    allocator.free(shmem);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.fstat.callCount);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.close.callCount);
+    EXPECT_EQ(2U, tempSysCallsCtx.apiConfig.shm_unlink.callCount);
+    EXPECT_EQ(0U, allocator.getSparePooledFilesCount(size));
+}
+
+TEST(ShmemAllocatorPool, givenPoolEnabledWhenSizeIsNotPooledThenFileIsCreatedAndDestroyedAsUsual) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+
+    Cal::Ipc::ShmemAllocator::PoolConfig poolConfig;
+    poolConfig.highWatermark = 4U;
+    poolConfig.lowWatermark = 4U;
+    Cal::Ipc::ShmemAllocator allocator("/test_base_path", poolConfig);
+
+    for (auto size : {Cal::Utils::pageSize4KB, 3 * Cal::Ipc::ShmemAllocator::minPooledSize, 2 * Cal::Ipc::ShmemAllocator::maxPooledSize}) {
+        auto shmem = allocator.allocate(size);
+        ASSERT_TRUE(shmem.isValid());
+        allocator.free(shmem);
+        EXPECT_EQ(0U, allocator.getSparePooledFilesCount(size));
+    }
+    EXPECT_EQ(3U, tempSysCallsCtx.apiConfig.shm_open.callCount);
+    EXPECT_EQ(3U, tempSysCallsCtx.apiConfig.close.callCount);
+    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.fstat.callCount);
+}
+
+TEST(ShmemAllocatorPool, whenReadingPoolConfigThenUsesEnvironmentVariables) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    {
+        auto config = Cal::Ipc::ShmemAllocator::readPoolConfig();
+        EXPECT_EQ(0U, config.highWatermark);
+        EXPECT_EQ(0U, config.lowWatermark);
+        EXPECT_TRUE(config.prefault);
+    }
+    tempSysCallsCtx.envVariables[std::string(calShmemPoolHighWatermarkEnvName)] = "5";
+    {
+        auto config = Cal::Ipc::ShmemAllocator::readPoolConfig();
+        EXPECT_EQ(5U, config.highWatermark);
+        EXPECT_EQ(3U, config.lowWatermark);
+    }
+    tempSysCallsCtx.envVariables[std::string(calShmemPoolLowWatermarkEnvName)] = "8";
+    tempSysCallsCtx.envVariables[std::string(calShmemPoolPrefaultEnvName)] = "0";
+    {
+        auto config = Cal::Ipc::ShmemAllocator::readPoolConfig();
+        EXPECT_EQ(5U, config.highWatermark);
+        EXPECT_EQ(5U, config.lowWatermark);
+        EXPECT_FALSE(config.prefault);
+    }
+}
+
+TEST(ShmemAllocatorMemfd, givenMemfdBackingWhenAllocatingShmemThenAnonymousFileIsCreatedAndCanBeImportedUntilFreed) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+
+    Cal::Ipc::ShmemAllocator allocator("/test_base_path", Cal::Ipc::ShmemAllocator::PoolConfig{}, true);
+    EXPECT_TRUE(allocator.usesMemfd());
+    auto shmem = allocator.allocate(4099);
+    ASSERT_TRUE(shmem.isValid());
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.memfd_create.callCount);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.ftruncate.callCount);
+    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.shm_open.callCount);
+    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.shm_unlink.callCount);
+    EXPECT_EQ(shmem.getFd(), allocator.withMemfd(shmem.getShmemId(), [](int fd) { return fd; }));
+
+    allocator.free(shmem);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.close.callCount);
+    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.shm_unlink.callCount);
+    EXPECT_EQ(-1, allocator.withMemfd(shmem.getShmemId(), [](int fd) { return fd; }));
+    EXPECT_TRUE(logs.empty()) << logs.str();
+}
+
+TEST(ShmemAllocatorMemfd, givenMemfdBackingWhenShmemIsFreedThenItsIdIsNotReused) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+
+    Cal::Ipc::ShmemAllocator allocator("/test_base_path", Cal::Ipc::ShmemAllocator::PoolConfig{}, true);
+    auto first = allocator.allocate(4096);
+    ASSERT_TRUE(first.isValid());
+    allocator.free(first);
+    auto second = allocator.allocate(4096);
+    ASSERT_TRUE(second.isValid());
+    EXPECT_NE(first.getShmemId(), second.getShmemId());
+    allocator.free(second);
+}
+
+TEST(ShmemAllocatorMemfd, givenMemfdBackingWhenMemfdCreationFailsThenReturnsInvalidAllocationAndEmitsError) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+
+    Cal::Ipc::ShmemAllocator allocator("/test_base_path", Cal::Ipc::ShmemAllocator::PoolConfig{}, true);
+    tempSysCallsCtx.apiConfig.memfd_create.returnValue = -1;
+    auto shmem = allocator.allocate(4096);
+    EXPECT_FALSE(shmem.isValid());
+    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.ftruncate.callCount);
+    EXPECT_FALSE(logs.empty());
+}
+
+TEST(ShmemAllocatorHugePages, givenMemfdBackingWithHugePagesWhenAllocatingWithHugePageAlignmentThenCreatesHugetlbMemfd) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+
+    std::vector<unsigned int> memfdFlags;
+    tempSysCallsCtx.apiConfig.memfd_create.impl = [&](const char *name, unsigned int flags) {
+        memfdFlags.push_back(flags);
+        return tempSysCallsCtx.memfd_createBaseImpl(name, flags);
+    };
+
+    Cal::Ipc::ShmemAllocator allocator("/test_base_path", Cal::Ipc::ShmemAllocator::PoolConfig{}, true, true);
+    EXPECT_EQ(Cal::Utils::pageSize2MB, allocator.getHugePageSize());
+    auto shmem = allocator.allocate(4 * Cal::Utils::MB, Cal::Utils::pageSize2MB);
+    ASSERT_TRUE(shmem.isValid());
+    ASSERT_EQ(1U, memfdFlags.size());
+    EXPECT_EQ(MFD_CLOEXEC | MFD_HUGETLB | (21U << MAP_HUGE_SHIFT), memfdFlags[0]);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.mmap.callCount);   // reservation of hugepages
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.munmap.callCount); // reservation stays with the file
+    EXPECT_EQ(shmem.getFd(), allocator.withMemfd(shmem.getShmemId(), [](int fd) { return fd; }));
+
+    allocator.free(shmem);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.close.callCount);
+    EXPECT_TRUE(logs.empty()) << logs.str();
+}
+
+TEST(ShmemAllocatorHugePages, givenMemfdBackingWithHugePagesWhenAllocatingWholeGigabytesWith1GBAlignmentThenTriesGiganticPagesFirst) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+
+    std::vector<unsigned int> memfdFlags;
+    tempSysCallsCtx.apiConfig.memfd_create.impl = [&](const char *name, unsigned int flags) {
+        memfdFlags.push_back(flags);
+        return tempSysCallsCtx.memfd_createBaseImpl(name, flags);
+    };
+
+    Cal::Ipc::ShmemAllocator allocator("/test_base_path", Cal::Ipc::ShmemAllocator::PoolConfig{}, true, true);
+    auto shmem = allocator.allocate(Cal::Utils::GB, Cal::Utils::pageSize1GB);
+    ASSERT_TRUE(shmem.isValid());
+    ASSERT_EQ(1U, memfdFlags.size());
+    EXPECT_EQ(MFD_CLOEXEC | MFD_HUGETLB | (30U << MAP_HUGE_SHIFT), memfdFlags[0]);
+    allocator.free(shmem);
+}
+
+TEST(ShmemAllocatorHugePages, givenMemfdBackingWithHugePagesWhenHugePagesCantBeReservedThenFallsBackToRegularMemfd) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+
+    std::vector<unsigned int> memfdFlags;
+    tempSysCallsCtx.apiConfig.memfd_create.impl = [&](const char *name, unsigned int flags) {
+        memfdFlags.push_back(flags);
+        return tempSysCallsCtx.memfd_createBaseImpl(name, flags);
+    };
+    tempSysCallsCtx.apiConfig.mmap.returnValue = MAP_FAILED;
+
+    Cal::Ipc::ShmemAllocator allocator("/test_base_path", Cal::Ipc::ShmemAllocator::PoolConfig{}, true, true);
+    auto shmem = allocator.allocate(4 * Cal::Utils::MB, Cal::Utils::pageSize2MB);
+    ASSERT_TRUE(shmem.isValid());
+    ASSERT_EQ(2U, memfdFlags.size());
+    EXPECT_NE(0U, memfdFlags[0] & MFD_HUGETLB);
+    EXPECT_EQ(static_cast<unsigned int>(MFD_CLOEXEC), memfdFlags[1]);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.close.callCount);
+    EXPECT_EQ(shmem.getFd(), allocator.withMemfd(shmem.getShmemId(), [](int fd) { return fd; }));
+    allocator.free(shmem);
+}
+
+TEST(ShmemAllocatorHugePages, givenHugePagesWhenHugePageAlignmentIsNotRequestedOrShmemsAreNotMemfdsThenRegularFileIsCreated) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+
+    std::vector<unsigned int> memfdFlags;
+    tempSysCallsCtx.apiConfig.memfd_create.impl = [&](const char *name, unsigned int flags) {
+        memfdFlags.push_back(flags);
+        return tempSysCallsCtx.memfd_createBaseImpl(name, flags);
+    };
+
+    {
+        Cal::Ipc::ShmemAllocator allocator("/test_base_path", Cal::Ipc::ShmemAllocator::PoolConfig{}, true, true);
+        auto shmem = allocator.allocate(4 * Cal::Utils::MB);
+        ASSERT_TRUE(shmem.isValid());
+        allocator.free(shmem);
+        ASSERT_EQ(1U, memfdFlags.size());
+        EXPECT_EQ(0U, memfdFlags[0] & MFD_HUGETLB);
+    }
+    {
+        Cal::Ipc::ShmemAllocator allocator("/test_base_path", Cal::Ipc::ShmemAllocator::PoolConfig{}, false, true);
+        auto shmem = allocator.allocate(4 * Cal::Utils::MB, Cal::Utils::pageSize2MB);
+        ASSERT_TRUE(shmem.isValid());
+        EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.shm_open.callCount);
+        EXPECT_EQ(1U, memfdFlags.size());
+        allocator.free(shmem);
+    }
+}
+
+TEST(ShmemAllocatorHugePages, givenPoolWhenHugetlbMemfdIsFreedThenItIsDestroyedInsteadOfBeingPooled) {
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+
+    Cal::Ipc::ShmemAllocator::PoolConfig poolConfig;
+    poolConfig.highWatermark = 2U;
+    poolConfig.lowWatermark = 0U;
+    Cal::Ipc::ShmemAllocator allocator("/test_base_path", poolConfig, true, true);
+    auto shmem = allocator.allocate(4 * Cal::Utils::MB, Cal::Utils::pageSize2MB);
+    ASSERT_TRUE(shmem.isValid());
+    allocator.free(shmem);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.close.callCount);
+    EXPECT_EQ(-1, allocator.withMemfd(shmem.getShmemId(), [](int fd) { return fd; }));
+}
+
+class ShmemImporterMemfdTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        tempSysCallsCtx.apiConfig.close.returnValue = 0;
+        connection.apiConfig.send.impl = [this](const void *data, size_t dataSize) -> int {
+            auto request = reinterpret_cast<const Cal::Messages::ReqImportShmem *>(data);
+            EXPECT_EQ(sizeof(Cal::Messages::ReqImportShmem), dataSize);
+            EXPECT_FALSE(request->isInvalid());
+            requestedIds.push_back(request->id);
+            return static_cast<int>(dataSize);
+        };
+        connection.apiConfig.receive.impl = [this](void *data, size_t dataSize) -> int {
+            Cal::Messages::RespImportShmem response;
+            response.available = available;
+            memcpy(data, &response, sizeof(response));
+            return static_cast<int>(sizeof(response));
+        };
+        connection.apiConfig.receiveFds.impl = [](int *fds, uint32_t count) -> bool {
+            EXPECT_EQ(1U, count);
+            fds[0] = importedFd;
+            return true;
+        };
+    }
+
+    static constexpr int importedFd = 9;
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+    Cal::Mocks::ConnectionMock connection;
+    std::vector<int> requestedIds;
+    bool available = true;
+};
+
+TEST_F(ShmemImporterMemfdTest, givenMemfdConnectionWhenOpeningShmemThenFdIsImportedFromServiceOnceAndClosedOnLastRelease) {
+    Cal::Ipc::ShmemImporter importer("/test_base_path", &connection);
+    auto first = importer.open(5, Cal::Utils::pageSize4KB, nullptr);
+    auto second = importer.open(5, Cal::Utils::pageSize4KB, nullptr);
+    ASSERT_TRUE(first.isValid());
+    ASSERT_TRUE(second.isValid());
+    EXPECT_EQ(importedFd, first.getFd());
+    EXPECT_EQ(importedFd, second.getFd());
+    EXPECT_EQ(std::vector<int>{5}, requestedIds);
+    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.shm_open.callCount);
+
+    importer.release(first);
+    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.close.callCount);
+    importer.release(second);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.close.callCount);
+    EXPECT_TRUE(logs.empty()) << logs.str();
+}
+
+TEST_F(ShmemImporterMemfdTest, givenMemfdConnectionWhenServiceDoesNotKnowShmemThenReturnsInvalidShmemAndEmitsError) {
+    Cal::Ipc::ShmemImporter importer("/test_base_path", &connection);
+    available = false;
+    auto shmem = importer.open(5, Cal::Utils::pageSize4KB, nullptr);
+    EXPECT_FALSE(shmem.isValid());
+    EXPECT_EQ(std::vector<int>{5}, requestedIds);
+    EXPECT_EQ(0U, tempSysCallsCtx.apiConfig.mmap.callCount);
+    EXPECT_FALSE(logs.empty());
+}
+
 TEST(NonUsmMmappedShmemAllocator, givenAllocatorThenUsesProperMmapConfig) {
     Cal::Mocks::SysCallsContext tempSysCallsCtx;
 
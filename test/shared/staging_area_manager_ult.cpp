@@ -7,6 +7,8 @@
 
 #include "gtest/gtest.h"
 #include "shared/staging_area_manager.h"
+
+#include <chrono>
 namespace Cal {
 namespace Ult {
 
@@ -18,6 +20,11 @@ class TestStagingAreaManager {
 
     TestStagingAreaManager() : stagingAreaManager([this](size_t size) { return this->testAllocator(size); },
                                                   [this](void *ptr) { return this->testDeallocator(ptr); }) {}
+
+    TestStagingAreaManager(int *deallocationCounter, const Cal::Utils::IdleTrimmer::Config &idleTrimming)
+        : stagingAreaManager([this](size_t size) { return this->testAllocator(size); },
+                             [this](void *ptr) { return this->testDeallocatorWithCounter(ptr); }, idleTrimming),
+          deallocationCounter(deallocationCounter) {}
     void *testAllocator(size_t size) {
         void *alloc = malloc(size);
         testAllocatorCalled++;
@@ -74,5 +81,30 @@ TEST(StagingAreaManager, givenStagingAreaManagerWhenAllocatingAreaOfSameSizeAndU
         EXPECT_EQ(secondAlloc.get(), ptrToFirstStagingArea);
     }
 }
+
+TEST(StagingAreaManager, givenIdleTrimmingWhenStagingAreasAreUnusedForLongerThanIdleTimeoutThenTheyAreDeallocatedExceptForLowWatermark) {
+    int deallocationCounter = 0;
+    TestStagingAreaManager manager(&deallocationCounter, {std::chrono::milliseconds(1000), 1U});
+    auto &stagingAreaManager = manager.stagingAreaManager;
+
+    auto inUse = stagingAreaManager.allocateStagingArea(16);
+    auto first = stagingAreaManager.allocateStagingArea(32);
+    auto second = stagingAreaManager.allocateStagingArea(64);
+    stagingAreaManager.releaseStagingArea(first);
+    stagingAreaManager.releaseStagingArea(second);
+    auto now = Cal::Utils::IdleTrimmer::ClockT::now();
+
+    EXPECT_EQ(0U, stagingAreaManager.trimIdleStagingAreas(now));
+    EXPECT_EQ(0, deallocationCounter);
+
+    EXPECT_EQ(1U, stagingAreaManager.trimIdleStagingAreas(now + std::chrono::milliseconds(1000)));
+    EXPECT_EQ(1, deallocationCounter);
+
+    EXPECT_EQ(second, stagingAreaManager.allocateStagingArea(64)); // most recently used one is kept
+    EXPECT_EQ(3, manager.testAllocatorCalled);
+    EXPECT_NE(nullptr, stagingAreaManager.allocateStagingArea(32));
+    EXPECT_EQ(4, manager.testAllocatorCalled);
+    EXPECT_NE(nullptr, inUse);
+}
 } // namespace Ult
 } // namespace Cal
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "gtest/gtest.h"
+#include "shared/stats.h"
+#include "test/mocks/log_mock.h"
+#include "test/mocks/sys_mock.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace Cal {
+
+namespace Ult {
+
+TEST(CallStatsGetLatencyBucket, thenLatenciesAreBucketedByPowersOfTwoAndHugeLatenciesLandInLastBucket) {
+    EXPECT_EQ(0U, Cal::Stats::CallStats::getLatencyBucket(0U));
+    EXPECT_EQ(1U, Cal::Stats::CallStats::getLatencyBucket(1U));
+    EXPECT_EQ(2U, Cal::Stats::CallStats::getLatencyBucket(2U));
+    EXPECT_EQ(2U, Cal::Stats::CallStats::getLatencyBucket(3U));
+    EXPECT_EQ(11U, Cal::Stats::CallStats::getLatencyBucket(1024U));
+    EXPECT_EQ(11U, Cal::Stats::CallStats::getLatencyBucket(2047U));
+    EXPECT_EQ(Cal::Stats::CallStats::latencyBucketsCount - 1, Cal::Stats::CallStats::getLatencyBucket(std::numeric_limits<uint64_t>::max()));
+
+    for (size_t bucket = 0; bucket < Cal::Stats::CallStats::latencyBucketsCount; ++bucket) {
+        EXPECT_EQ(bucket, Cal::Stats::CallStats::getLatencyBucket(Cal::Stats::CallStats::getLatencyBucketLowerBound(bucket)));
+    }
+}
+
+TEST(CallStatsRecord, thenCountLatencyHistogramAndBytesCopiedAreAccumulated) {
+    Cal::Stats::CallStats stats = {};
+    stats.record(1000U, 0U);
+    stats.record(900U, 64U);
+    stats.record(5U, 16U);
+
+    EXPECT_EQ(3U, stats.count.load());
+    EXPECT_EQ(1905U, stats.totalLatencyNs.load());
+    EXPECT_EQ(80U, stats.bytesCopied.load());
+    EXPECT_EQ(2U, stats.latencyHistogram[Cal::Stats::CallStats::getLatencyBucket(1000U)].load());
+    EXPECT_EQ(1U, stats.latencyHistogram[Cal::Stats::CallStats::getLatencyBucket(5U)].load());
+}
+
+TEST(StatsPage, givenMessageOutOfStatsPageRangeThenNoStatsAreReturned) {
+    auto page = std::make_unique<Cal::Stats::StatsPage>();
+    Cal::Rpc::RpcMessageHeader header;
+    header.type = Cal::Rpc::RpcMessageHeader::messageTypeRpcLevelZero;
+    header.subtype = 7;
+    EXPECT_EQ(&page->serviced[header.type][7], page->getServiced(header));
+    EXPECT_EQ(&page->clientWaits[header.type][7], page->getClientWaits(header));
+
+    header.subtype = Cal::Stats::StatsPage::messageSubtypesCount;
+    EXPECT_EQ(nullptr, page->getServiced(header));
+    EXPECT_EQ(nullptr, page->getClientWaits(header));
+
+    header.subtype = 7;
+    header.type = Cal::Stats::StatsPage::messageTypesCount;
+    EXPECT_EQ(nullptr, page->getServiced(header));
+    EXPECT_EQ(nullptr, page->getClientWaits(header));
+}
+
+TEST(GetStatsShmemPath, thenPathIsBasedOnServicePidAndClientOrdinal) {
+    EXPECT_EQ(std::string(calShmemPathPrefix) + "stats_123_7", Cal::Stats::getStatsShmemPath(123, 7));
+    EXPECT_EQ(0U, Cal::Stats::getStatsShmemPath(123, 7).find(Cal::Stats::getStatsShmemPathPrefix()));
+}
+
+struct StatsShmemTest : public ::testing::Test {
+    void SetUp() override {
+        backingMemory = std::make_unique<Cal::Stats::StatsPage>();
+        tempSysCallsCtx.apiConfig.mmap.impl = [this](void *addr, size_t length, int prot, int flags, int fd, off_t offset) -> void * {
+            EXPECT_EQ(sizeof(Cal::Stats::StatsPage), length);
+            EXPECT_NE(0, flags & MAP_SHARED);
+            lastMmapProt = prot;
+            return backingMemory.get();
+        };
+    }
+
+    Cal::Mocks::SysCallsContext tempSysCallsCtx;
+    Cal::Mocks::LogCaptureContext logs;
+    std::unique_ptr<Cal::Stats::StatsPage> backingMemory;
+    int lastMmapProt = 0;
+};
+
+TEST_F(StatsShmemTest, whenCreatingThenHeaderIsFilledAndShmemIsUnlinkedWhenDestroyed) {
+    auto stats = Cal::Stats::StatsShmem::create(123, 7, 456, "app");
+    ASSERT_NE(nullptr, stats);
+    EXPECT_EQ(Cal::Stats::getStatsShmemPath(123, 7), stats->getPath());
+    EXPECT_EQ(backingMemory.get(), &stats->getPage());
+    EXPECT_TRUE(backingMemory->isValid());
+    EXPECT_EQ(456, backingMemory->clientPid);
+    EXPECT_EQ(7U, backingMemory->clientOrdinal);
+    EXPECT_STREQ("app", backingMemory->clientProcessName);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.ftruncate.callCount);
+    EXPECT_EQ(PROT_READ | PROT_WRITE, lastMmapProt);
+
+    auto unlinksBeforeDestroy = tempSysCallsCtx.apiConfig.shm_unlink.callCount;
+    stats.reset();
+    EXPECT_EQ(unlinksBeforeDestroy + 1, tempSysCallsCtx.apiConfig.shm_unlink.callCount);
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.munmap.callCount);
+}
+
+TEST_F(StatsShmemTest, whenFailedToCreateShmemThenReturnsNullAndEmitsError) {
+    tempSysCallsCtx.apiConfig.shm_open.returnValue = -1;
+    EXPECT_EQ(nullptr, Cal::Stats::StatsShmem::create(123, 7, 456, "app"));
+    EXPECT_FALSE(logs.empty());
+}
+
+TEST_F(StatsShmemTest, whenOpeningExistingStatsThenPageIsMappedWithRequestedAccessAndIsNotUnlinkedWhenDestroyed) {
+    auto created = Cal::Stats::StatsShmem::create(123, 7, 456, "app");
+    ASSERT_NE(nullptr, created);
+
+    auto opened = Cal::Stats::StatsShmem::open(created->getPath(), true);
+    ASSERT_NE(nullptr, opened);
+    EXPECT_EQ(PROT_READ, lastMmapProt);
+    EXPECT_EQ(456, opened->getPage().clientPid);
+
+    auto unlinksBeforeDestroy = tempSysCallsCtx.apiConfig.shm_unlink.callCount;
+    opened.reset();
+    EXPECT_EQ(unlinksBeforeDestroy, tempSysCallsCtx.apiConfig.shm_unlink.callCount);
+}
+
+TEST_F(StatsShmemTest, whenOpeningStatsWithUnknownFormatThenFailsAndUnmapsIt) {
+    auto created = Cal::Stats::StatsShmem::create(123, 7, 456, "app");
+    ASSERT_NE(nullptr, created);
+    backingMemory->version = Cal::Stats::StatsPage::currentVersion + 1;
+
+    EXPECT_EQ(nullptr, Cal::Stats::StatsShmem::open(created->getPath(), false));
+    EXPECT_EQ(1U, tempSysCallsCtx.apiConfig.munmap.callCount);
+    EXPECT_FALSE(logs.empty());
+}
+
+} // namespace Ult
+
+} // namespace Cal
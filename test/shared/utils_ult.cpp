@@ -8,12 +8,18 @@
 #include "gtest/gtest.h"
 #include "service/service.h"
 #include "shared/allocators.h"
+#include "shared/idle_trimmer.h"
+#include "shared/parallel_copy.h"
+#include "shared/transfer_copy.h"
 #include "shared/utils.h"
 #include "test/mocks/log_mock.h"
 #include "test/mocks/sys_mock.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <string>
+#include <vector>
 
 namespace Cal {
 
@@ -991,5 +997,151 @@ TEST(intAsPath, givenUint64ThenConvertsBackAndForthProperly) {
     }
 }
 
+TEST(StreamingHash64, givenDataFedInDifferentChunksThenHashIsTheSame) {
+    std::vector<uint8_t> data(67);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 7);
+    }
+    auto expected = Cal::Utils::StreamingHash64{}.update(data.data(), data.size()).finalize();
+
+    for (size_t chunkSize : {1U, 3U, 8U, 13U, 64U}) {
+        Cal::Utils::StreamingHash64 hash;
+        for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+            hash.update(data.data() + offset, std::min(chunkSize, data.size() - offset));
+        }
+        EXPECT_EQ(expected, hash.finalize()) << chunkSize;
+    }
+}
+
+TEST(StreamingHash64, givenDifferentDataOrSeedThenHashIsDifferent) {
+    uint8_t data[16] = {};
+    auto base = Cal::Utils::StreamingHash64{}.update(data, sizeof(data)).finalize();
+    EXPECT_NE(base, Cal::Utils::StreamingHash64{}.update(data, sizeof(data) - 1).finalize());
+    EXPECT_NE(base, Cal::Utils::StreamingHash64{1U}.update(data, sizeof(data)).finalize());
+    data[15] = 1;
+    EXPECT_NE(base, Cal::Utils::StreamingHash64{}.update(data, sizeof(data)).finalize());
+}
+
+TEST(StreamingHash64, givenStringsThenNullAndEmptyStringsAreDistinguishedAndBoundariesAreEncoded) {
+    auto hashStrings = [](const char *a, const char *b) {
+        return Cal::Utils::StreamingHash64{}.updateString(a).updateString(b).finalize();
+    };
+    EXPECT_NE(hashStrings(nullptr, "a"), hashStrings("", "a"));
+    EXPECT_NE(hashStrings("ab", "c"), hashStrings("a", "bc"));
+    EXPECT_EQ(hashStrings("ab", "c"), hashStrings("ab", "c"));
+}
+
+TEST(TransferCopy, givenSupportedInstructionSetsThenStreamingCopiesCopyMisalignedRangesExactly) {
+    using Isa = Cal::Utils::TransferCopy::Isa;
+    std::vector<uint8_t> src(64 * Cal::Utils::KB);
+    for (size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<uint8_t>(i * 13 + 1);
+    }
+    for (auto isa : {Isa::libc, Isa::sse2, Isa::avx2, Isa::avx512}) {
+        if (false == Cal::Utils::TransferCopy::isSupported(isa)) {
+            continue;
+        }
+        auto copy = Cal::Utils::TransferCopy::getStreamingCopyFunction(isa);
+        for (size_t offset : {0U, 1U, 31U, 63U}) {
+            for (size_t size : {size_t{0U}, size_t{7U}, size_t{255U}, size_t{4096U}, 32 * Cal::Utils::KB + 17}) {
+                std::vector<uint8_t> dst(src.size(), 0U);
+                copy(dst.data() + offset, src.data() + offset, size);
+                EXPECT_TRUE(std::equal(src.begin() + offset, src.begin() + offset + size, dst.begin() + offset)) << Cal::Utils::TransferCopy::getIsaName(isa);
+                EXPECT_TRUE(std::all_of(dst.begin(), dst.begin() + offset, [](uint8_t byte) { return 0U == byte; }));
+                EXPECT_TRUE(std::all_of(dst.begin() + offset + size, dst.end(), [](uint8_t byte) { return 0U == byte; }));
+            }
+        }
+    }
+    EXPECT_TRUE(Cal::Utils::TransferCopy::isSupported(Cal::Utils::TransferCopy::detectIsa()));
+}
+
+TEST(TransferCopy, givenStreamingThresholdThenStreamingCopyIsSelectedOnlyForTransfersNotSmallerThanIt) {
+    Cal::Utils::TransferCopy::Config config;
+    config.streamingThreshold = 4096U;
+    config.streamingCopy = Cal::Utils::TransferCopy::getStreamingCopyFunction(Cal::Utils::TransferCopy::Isa::sse2);
+    EXPECT_EQ(&Cal::Utils::TransferCopy::copyWithLibc, config.select(4095U));
+    EXPECT_EQ(config.streamingCopy, config.select(4096U));
+
+    config.streamingThreshold = 0U;
+    EXPECT_FALSE(config.isStreamingUsed(1 * Cal::Utils::GB));
+    EXPECT_EQ(&Cal::Utils::TransferCopy::copyWithLibc, config.select(1 * Cal::Utils::GB));
+}
+
+TEST(ParallelCopy, givenCopiesBelowThresholdThenCopiesThemWithoutStartingHelpers) {
+    Cal::Utils::ParallelCopy parallelCopy(2U);
+    std::vector<uint8_t> src(Cal::Utils::ParallelCopy::defaultMinBytesToSplit / 2, 7U);
+    std::vector<uint8_t> dst(src.size(), 0U);
+    parallelCopy.copy({{dst.data(), src.data(), src.size()}});
+    EXPECT_EQ(src, dst);
+    EXPECT_EQ(0U, parallelCopy.getStartedHelpersCount());
+}
+
+TEST(ParallelCopy, givenNoHelpersThenCopiesLargeTransfersSerially) {
+    Cal::Utils::ParallelCopy parallelCopy(0U);
+    std::vector<uint8_t> src(2 * Cal::Utils::ParallelCopy::defaultMinBytesToSplit, 7U);
+    std::vector<uint8_t> dst(src.size(), 0U);
+    parallelCopy.copy({{dst.data(), src.data(), src.size()}});
+    EXPECT_EQ(src, dst);
+    EXPECT_EQ(0U, parallelCopy.getStartedHelpersCount());
+}
+
+TEST(ParallelCopy, givenLargeTransfersThenSplitsThemIntoChunksCopiedWithHelpers) {
+    Cal::Utils::ParallelCopy parallelCopy(3U, Cal::Utils::ParallelCopy::chunkSize);
+    std::vector<std::vector<uint8_t>> srcs;
+    std::vector<std::vector<uint8_t>> dsts;
+    std::vector<Cal::Utils::ParallelCopy::CopyDesc> copies;
+    for (size_t size : {5 * Cal::Utils::ParallelCopy::chunkSize + 13, size_t{4096U}, 3 * Cal::Utils::ParallelCopy::chunkSize}) {
+        srcs.emplace_back(size);
+        for (size_t i = 0; i < size; ++i) {
+            srcs.back()[i] = static_cast<uint8_t>(i * 31 + srcs.size());
+        }
+        dsts.emplace_back(size, 0U);
+    }
+    for (size_t i = 0; i < srcs.size(); ++i) {
+        copies.push_back({dsts[i].data(), srcs[i].data(), srcs[i].size()});
+    }
+
+    for (int iteration = 0; iteration < 3; ++iteration) {
+        for (auto &dst : dsts) {
+            std::fill(dst.begin(), dst.end(), 0U);
+        }
+        parallelCopy.copy(copies);
+        EXPECT_EQ(srcs, dsts);
+    }
+    EXPECT_EQ(3U, parallelCopy.getStartedHelpersCount());
+}
+
+TEST(IdleTrimmer, givenDefaultConfigThenTrimmingIsDisabled) {
+    Cal::Utils::IdleTrimmer trimmer;
+    auto now = Cal::Utils::IdleTrimmer::ClockT::now();
+    EXPECT_FALSE(trimmer.isEnabled());
+    EXPECT_FALSE(trimmer.shouldTrim(now));
+    EXPECT_TRUE(trimmer.selectEntriesToTrim({now - std::chrono::hours(1)}, now).empty());
+}
+
+TEST(IdleTrimmer, givenIdleTimeoutThenTrimsAtMostOncePerHalfOfIt) {
+    Cal::Utils::IdleTrimmer trimmer{{std::chrono::milliseconds(1000), 0U}};
+    auto now = Cal::Utils::IdleTrimmer::ClockT::now();
+    EXPECT_TRUE(trimmer.shouldTrim(now));
+    EXPECT_FALSE(trimmer.shouldTrim(now));
+    EXPECT_FALSE(trimmer.shouldTrim(now + std::chrono::milliseconds(499)));
+    EXPECT_TRUE(trimmer.shouldTrim(now + std::chrono::milliseconds(500)));
+    EXPECT_FALSE(trimmer.shouldTrim(now + std::chrono::milliseconds(600)));
+}
+
+TEST(IdleTrimmer, givenIdleEntriesThenSelectsOnesIdleForTooLongExceptForLowWatermarkOfMostRecentlyUsedOnes) {
+    Cal::Utils::IdleTrimmer trimmer{{std::chrono::milliseconds(1000), 1U}};
+    auto now = Cal::Utils::IdleTrimmer::ClockT::now();
+    std::vector<Cal::Utils::IdleTrimmer::ClockT::time_point> idleSince = {now - std::chrono::milliseconds(3000), now - std::chrono::milliseconds(100),
+                                                                         now - std::chrono::milliseconds(2000), now - std::chrono::milliseconds(1500)};
+    EXPECT_EQ((std::vector<size_t>{0U, 2U, 3U}), trimmer.selectEntriesToTrim(idleSince, now));
+
+    idleSince[1] = now - std::chrono::milliseconds(5000);
+    EXPECT_EQ((std::vector<size_t>{0U, 1U, 2U}), trimmer.selectEntriesToTrim(idleSince, now));
+
+    Cal::Utils::IdleTrimmer trimmerWithBigWatermark{{std::chrono::milliseconds(1000), 4U}};
+    EXPECT_TRUE(trimmerWithBigWatermark.selectEntriesToTrim(idleSince, now).empty());
+}
+
 } // namespace Ult
 } // namespace Cal